@@ -0,0 +1,120 @@
+/**
+ * @brief Implementation details of the generated benchmark input data.
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "benchmark_data.h"
+
+namespace language
+{
+namespace benchmarks
+{
+namespace
+{
+/**
+ * @brief Phrase file written on first use and removed at exit.
+ */
+struct PhraseFile
+{
+    PhraseFile(const std::string& name, const std::size_t pairCount, const bool duplicates)
+        : path{(std::filesystem::temp_directory_path() / name).string()}
+        , size{}
+    {
+        std::ofstream ofstream{path, std::ios::binary};
+        std::uniform_int_distribution<std::size_t> lengths{8U, 60U};
+        static const char* const kLineEndings[]{"\n", "\n", "\n", "  \n", "\r\n"};
+
+        for (std::size_t i{}; i < pairCount; ++i)
+        {
+            // Every pair is created from its own seed, so that a duplicate repeats an earlier pair 
+            // which isn't a duplicate itself.
+            const auto ending{kLineEndings[i % 5U]};
+            const auto pair{static_cast<unsigned int>((duplicates && (9U == i % 10U)) ? i / 20U * 10U : i)};
+            std::minstd_rand generator{pair + 1U};
+            ofstream << randomText(lengths(generator), 2U * pair) << ending
+                     << randomText(lengths(generator), 2U * pair + 1U) << ending << ending;
+        }
+        size = static_cast<std::size_t>(ofstream.tellp());
+    }
+
+    ~PhraseFile() { std::remove(path.c_str()); }
+
+    /** Path to the file. */
+    std::string path;
+
+    /** The file size in bytes. */
+    std::size_t size;
+};
+
+// ---------------------------------------------------------------------------
+const PhraseFile& generatedPhraseFile()
+{
+    static const PhraseFile phraseFile{"language_benchmark_phrases.txt", kPhraseCount, false};
+    return phraseFile;
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+const std::string& phraseFile() { return generatedPhraseFile().path; }
+
+// ---------------------------------------------------------------------------
+std::size_t phraseFileSize() { return generatedPhraseFile().size; }
+
+// ---------------------------------------------------------------------------
+const std::string& corpusFile(const std::size_t pairCount, const bool duplicates)
+{
+    // Corpora are generated on the benchmark thread, one at a time.
+    static std::map<std::pair<std::size_t, bool>, std::unique_ptr<PhraseFile>> corpora{};
+    auto& corpus{corpora[{pairCount, duplicates}]};
+
+    if (!corpus)
+    {
+        const auto name{"language_benchmark_corpus_" + std::to_string(pairCount) + (duplicates ? "d" : "u") + ".txt"};
+        corpus = std::make_unique<PhraseFile>(name, pairCount, duplicates);
+    }
+    return corpus->path;
+}
+
+// ---------------------------------------------------------------------------
+void corpusSizes(benchmark::internal::Benchmark* benchmark)
+{
+    const auto* const maxPairs{std::getenv("LANGUAGE_BENCHMARK_MAX_PAIRS")};
+    const auto maxCorpusSize{maxPairs ? std::strtoull(maxPairs, nullptr, 10) : kDefaultMaxCorpusSize};
+
+    for (auto size{kMinCorpusSize}; size <= maxCorpusSize; size *= 10U) 
+    { 
+        benchmark->Arg(static_cast<std::int64_t>(size)); 
+    }
+}
+
+// ---------------------------------------------------------------------------
+std::string randomText(const std::size_t size, const unsigned int seed)
+{
+    std::minstd_rand generator{seed + 1U};
+    std::uniform_int_distribution<int> letters{'a', 'z'};
+    std::uniform_int_distribution<int> wordLengths{1, 9};
+
+    std::string text{};
+    text.reserve(size);
+    while (text.size() < size)
+    {
+        if (!text.empty()) { text.push_back(' '); }
+        for (auto length{wordLengths(generator)}; (0 < length) && (text.size() < size); --length)
+        {
+            text.push_back(static_cast<char>(letters(generator)));
+        }
+    }
+    text.resize(size);
+    if (!text.empty() && (' ' == text.back())) { text.back() = 'x'; }
+    return text;
+}
+} // namespace benchmarks
+} // namespace language
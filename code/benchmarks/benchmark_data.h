@@ -0,0 +1,77 @@
+/**
+ * @brief Generated input data shared by the benchmarks.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace language
+{
+namespace benchmarks
+{
+/** The number of phrase pairs in the generated phrase file. */
+constexpr std::size_t kPhraseCount{500000U};
+
+/**
+ * @brief Get the path to a generated phrase file.
+ *
+ *        The file is written to the temporary directory on first use and removed at exit.
+ *        It holds kPhraseCount pairs of phrases separated by blank lines, some of them with
+ *        trailing whitespaces and carriage returns.
+ *
+ * @return Path to the phrase file.
+ */
+const std::string& phraseFile();
+
+/**
+ * @brief Get the size of the generated phrase file.
+ *
+ * @return The file size in bytes.
+ */
+std::size_t phraseFileSize();
+
+/** The number of phrase pairs in the smallest generated corpus. */
+constexpr std::size_t kMinCorpusSize{1000U};
+
+/** The number of phrase pairs in the biggest generated corpus, unless set otherwise. */
+constexpr std::size_t kDefaultMaxCorpusSize{1000000U};
+
+/**
+ * @brief Get the path to a generated corpus of given size.
+ *
+ *        Corpora are written to the temporary directory on first use and removed at exit. 
+ *        They are formatted like the phrase file, but every tenth pair repeats an earlier pair
+ *        if duplicates are requested.
+ *
+ * @param[in] pairCount The number of phrase pairs in the corpus.
+ * @param[in] duplicates Indicate whether the corpus contains duplicates (default = true).
+ *
+ * @return Path to the corpus.
+ */
+const std::string& corpusFile(std::size_t pairCount, bool duplicates = true);
+
+/**
+ * @brief Register the corpus sizes as arguments of a benchmark.
+ *
+ *        Sizes grow by a factor of 10 from kMinCorpusSize up to kDefaultMaxCorpusSize pairs.
+ *        Set environment variable LANGUAGE_BENCHMARK_MAX_PAIRS to change the biggest size,
+ *        e.g. to 10000000 to benchmark corpora of up to 10M pairs.
+ *
+ * @param[in] benchmark Pointer to the benchmark to register the sizes for.
+ */
+void corpusSizes(benchmark::internal::Benchmark* benchmark);
+
+/**
+ * @brief Create a text of random words.
+ *
+ * @param[in] size The size of the text in bytes.
+ * @param[in] seed Seed for the random generator, the same seed creates the same text.
+ *
+ * @return The text.
+ */
+std::string randomText(std::size_t size, unsigned int seed = 1U);
+} // namespace benchmarks
+} // namespace language
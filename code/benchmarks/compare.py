@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Compare Google Benchmark JSON results against a stored baseline.
+
+Record a baseline and compare a later run against it:
+
+    ./benchmark/LanguageBenchmark --benchmark_out=baseline.json --benchmark_out_format=json
+    ./benchmark/LanguageBenchmark --benchmark_out=current.json --benchmark_out_format=json
+    python3 code/benchmarks/compare.py baseline.json current.json --threshold=10
+
+Every benchmark found in both files is listed with its change in time. Benchmarks which are
+slower than the baseline by more than the threshold in percent are flagged as regressions,
+and the script then exits with status 1. Repetition aggregates other than the mean are ignored.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_results(path, metric):
+    """Load benchmark times in nanoseconds by name, preferring means of repeated runs."""
+    with open(path, encoding="utf-8") as file:
+        benchmarks = json.load(file)["benchmarks"]
+
+    units = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+    results = {}
+    for benchmark in benchmarks:
+        if benchmark.get("error_occurred"):
+            continue
+        aggregate = benchmark.get("aggregate_name")
+        if aggregate not in (None, "mean"):
+            continue
+        name = benchmark.get("run_name", benchmark["name"])
+        if aggregate is None and name in results:
+            continue
+        results[name] = benchmark[metric] * units[benchmark.get("time_unit", "ns")]
+    return results
+
+
+def format_time(nanoseconds):
+    """Format a time in nanoseconds with a suitable unit."""
+    for unit, factor in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if nanoseconds >= factor:
+            return f"{nanoseconds / factor:.3f} {unit}"
+    return f"{nanoseconds:.1f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flag benchmark regressions against a baseline.")
+    parser.add_argument("baseline", help="JSON results of the baseline run")
+    parser.add_argument("current", help="JSON results of the run to check")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="allowed slowdown in percent before flagging a regression (default 10)")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="cpu_time",
+                        help="time to compare (default cpu_time)")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline, args.metric)
+    current = load_results(args.current, args.metric)
+    names = [name for name in current if name in baseline]
+    if not names:
+        print("No common benchmarks found.")
+        return 1
+
+    width = max(len(name) for name in names)
+    regressions = 0
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Current':>12}  {'Change':>8}")
+
+    for name in names:
+        change = (current[name] / baseline[name] - 1.0) * 100.0 if baseline[name] else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print(f"{name:<{width}}  {format_time(baseline[name]):>12}  {format_time(current[name]):>12}  "
+              f"{change:>+7.1f}%{flag}")
+
+    for name in sorted(set(baseline) - set(current)):
+        print(f"{name:<{width}}  missing from current results")
+
+    print(f"\n{regressions} regression(s) above {args.threshold:g}% in {len(names)} benchmark(s).")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
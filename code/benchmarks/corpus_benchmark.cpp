@@ -0,0 +1,128 @@
+/**
+ * @brief Benchmarks of loading, deduplicating and writing corpora of growing size.
+ */
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data.h"
+#include "dictionary/adapter.h"
+#include "utils/phrase.h"
+#include "utils/utils.h"
+
+namespace
+{
+using language::Phrase;
+using language::benchmarks::corpusFile;
+
+// ---------------------------------------------------------------------------
+std::size_t pairCount(const benchmark::State& state) { return static_cast<std::size_t>(state.range(0)); }
+
+// ---------------------------------------------------------------------------
+void setPairsProcessed(benchmark::State& state)
+{
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+// ---------------------------------------------------------------------------
+void retrieveCorpus(benchmark::State& state)
+{
+    const auto& filePath{corpusFile(pairCount(state))};
+
+    for (auto _ : state)
+    {
+        std::vector<std::string> lines{};
+        language::utils::retrieveFromFile(filePath, lines);
+        benchmark::DoNotOptimize(lines.data());
+    }
+    setPairsProcessed(state);
+}
+
+// ---------------------------------------------------------------------------
+void loadPhraseList(benchmark::State& state)
+{
+    const auto& filePath{corpusFile(pairCount(state))};
+
+    for (auto _ : state)
+    {
+        std::list<Phrase> phrases{};
+        benchmark::DoNotOptimize(language::utils::loadPhrasesFromFile(filePath, phrases));
+    }
+    setPairsProcessed(state);
+}
+
+// ---------------------------------------------------------------------------
+void loadPhraseVector(benchmark::State& state)
+{
+    const auto& filePath{corpusFile(pairCount(state))};
+
+    for (auto _ : state)
+    {
+        std::vector<Phrase> phrases{};
+        benchmark::DoNotOptimize(language::utils::loadPhrasesFromFile(filePath, phrases));
+    }
+    setPairsProcessed(state);
+}
+
+// ---------------------------------------------------------------------------
+void removeDuplicates(benchmark::State& state)
+{
+    // Every tenth pair is a duplicate, the list is copied outside of the measurement.
+    std::list<Phrase> corpus{};
+    language::utils::loadPhrasesFromFile(corpusFile(pairCount(state)), corpus);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto phrases{corpus};
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(language::utils::removeDuplicates(phrases));
+        state.PauseTiming();
+        phrases.clear();
+        state.ResumeTiming();
+    }
+    setPairsProcessed(state);
+}
+
+// ---------------------------------------------------------------------------
+void writePhrases(benchmark::State& state)
+{
+    std::list<Phrase> phrases{};
+    language::utils::loadPhrasesFromFile(corpusFile(pairCount(state)), phrases);
+    const auto filePath{(std::filesystem::temp_directory_path() / "language_benchmark_written.txt").string()};
+
+    for (auto _ : state) { benchmark::DoNotOptimize(language::utils::writePhrasesToFile(filePath, phrases)); }
+    std::remove(filePath.c_str());
+    setPairsProcessed(state);
+}
+
+// ---------------------------------------------------------------------------
+void constructAdapter(benchmark::State& state)
+{
+    // Use a corpus without duplicates, the adapter would rewrite the file otherwise.
+    // The messages printed while loading are discarded.
+    const auto& filePath{corpusFile(pairCount(state), false)};
+    auto* const coutBuffer{std::cout.rdbuf(nullptr)};
+
+    for (auto _ : state)
+    {
+        language::dictionary::Adapter adapter{filePath};
+        benchmark::DoNotOptimize(adapter.phraseCount());
+    }
+    std::cout.rdbuf(coutBuffer);
+    std::cout.clear();
+    setPairsProcessed(state);
+}
+} // namespace
+
+BENCHMARK(retrieveCorpus)->Apply(language::benchmarks::corpusSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(loadPhraseList)->Apply(language::benchmarks::corpusSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(loadPhraseVector)->Apply(language::benchmarks::corpusSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(removeDuplicates)->Apply(language::benchmarks::corpusSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(writePhrases)->Apply(language::benchmarks::corpusSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(constructAdapter)->Apply(language::benchmarks::corpusSizes)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,42 @@
+/**
+ * @brief Benchmarks of preparing game sessions for corpora of growing size.
+ */
+#include <list>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data.h"
+#include "dictionary/adapter.h"
+#include "game/options.h"
+#include "game_impl.h"
+#include "utils/phrase.h"
+#include "utils/utils.h"
+
+namespace
+{
+// ---------------------------------------------------------------------------
+void prepareSession(benchmark::State& state, const std::size_t choiceCount)
+{
+    // Select and shuffle the phrases of a new game, and index the answer choices if enabled.
+    std::list<language::Phrase> phrases{};
+    language::utils::loadPhrasesFromFile(language::benchmarks::corpusFile(static_cast<std::size_t>(state.range(0))), 
+                                         phrases);
+    language::dictionary::Adapter adapter{phrases};
+    language::game::Options options{};
+    options.choiceCount = choiceCount;
+
+    for (auto _ : state)
+    {
+        language::game::GameImpl game{adapter, options};
+        const auto session{game.prepareSession(false)};
+        benchmark::DoNotOptimize(session.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+} // namespace
+
+BENCHMARK_CAPTURE(prepareSession, text, 0U)
+    ->Apply(language::benchmarks::corpusSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(prepareSession, choices, 4U)
+    ->Apply(language::benchmarks::corpusSizes)->Unit(benchmark::kMillisecond);
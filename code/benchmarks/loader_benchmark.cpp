@@ -0,0 +1,82 @@
+/**
+ * @brief Benchmarks of loading phrase files.
+ */
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data.h"
+#include "utils/phrase.h"
+#include "utils/phrase_reader.h"
+#include "utils/scan.h"
+#include "utils/utils.h"
+
+namespace
+{
+using language::utils::SimdLevel;
+
+// ---------------------------------------------------------------------------
+void retrieveFromFile(benchmark::State& state)
+{
+    // Load all non-empty lines of the generated phrase file.
+    const auto& filePath{language::benchmarks::phraseFile()};
+    const auto level{static_cast<SimdLevel>(state.range(0))};
+    if (level != language::utils::setSimdLevel(level)) { state.SkipWithError("Instruction set not supported"); }
+    static const char* const kNames[]{"scalar", "sse2", "avx2"};
+    state.SetLabel(kNames[state.range(0)]);
+
+    for (auto _ : state)
+    {
+        std::vector<std::string> lines{};
+        language::utils::retrieveFromFile(filePath, lines);
+        benchmark::DoNotOptimize(lines.data());
+    }
+    language::utils::setSimdLevel(SimdLevel::Avx2);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * language::benchmarks::phraseFileSize()));
+}
+
+// ---------------------------------------------------------------------------
+void retrieveFromFileGetline(benchmark::State& state)
+{
+    // Reference: reading line by line with std::getline and trimming byte by byte.
+    const auto& filePath{language::benchmarks::phraseFile()};
+
+    for (auto _ : state)
+    {
+        std::vector<std::string> lines{};
+        std::ifstream ifstream{filePath};
+        std::string line{};
+        while (std::getline(ifstream, line))
+        {
+            line.erase(std::find_if(line.rbegin(), line.rend(), [](unsigned char ch)
+                { return !std::isspace(ch); }).base(), line.end());
+            if (std::string::npos != line.find_first_not_of(' ')) { lines.push_back(line); }
+        }
+        benchmark::DoNotOptimize(lines.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * language::benchmarks::phraseFileSize()));
+}
+
+// ---------------------------------------------------------------------------
+void readPhrases(benchmark::State& state)
+{
+    // Stream all phrase pairs of the generated phrase file.
+    const auto& filePath{language::benchmarks::phraseFile()};
+
+    for (auto _ : state)
+    {
+        language::utils::PhraseReader reader{filePath};
+        language::Phrase phrase{};
+        while (reader.next(phrase)) { benchmark::DoNotOptimize(phrase.primary.data()); }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * language::benchmarks::phraseFileSize()));
+}
+} // namespace
+
+BENCHMARK(retrieveFromFile)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+BENCHMARK(retrieveFromFileGetline)->Unit(benchmark::kMillisecond);
+BENCHMARK(readPhrases)->Unit(benchmark::kMillisecond);
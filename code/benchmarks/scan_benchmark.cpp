@@ -0,0 +1,167 @@
+/**
+ * @brief Benchmarks of the vectorized scanning functions.
+ */
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data.h"
+#include "utils/scan.h"
+#include "utils/utf8.h"
+
+namespace
+{
+using language::utils::SimdLevel;
+
+/** Size of the scanned texts in bytes. */
+constexpr std::size_t kTextSize{1024U * 1024U};
+
+// ---------------------------------------------------------------------------
+void selectSimdLevel(benchmark::State& state)
+{
+    // Skip instruction sets the CPU doesn't support.
+    const auto level{static_cast<SimdLevel>(state.range(0))};
+    if (level != language::utils::setSimdLevel(level)) { state.SkipWithError("Instruction set not supported"); }
+    static const char* const kNames[]{"scalar", "sse2", "avx2"};
+    state.SetLabel(kNames[state.range(0)]);
+}
+
+// ---------------------------------------------------------------------------
+void restoreSimdLevel(benchmark::State& state)
+{
+    language::utils::setSimdLevel(SimdLevel::Avx2);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kTextSize));
+}
+
+// ---------------------------------------------------------------------------
+void findNewline(benchmark::State& state)
+{
+    // Find every line break in a text with lines of 40 bytes on average.
+    auto text{language::benchmarks::randomText(kTextSize)};
+    for (std::size_t i{40U}; i < text.size(); i += 40U) { text[i] = '\n'; }
+    selectSimdLevel(state);
+
+    for (auto _ : state)
+    {
+        std::size_t lineCount{};
+        const auto last{text.data() + text.size()};
+        for (const char* p{text.data()}; last != p; ++lineCount)
+        {
+            p = language::utils::findFirstOf(p, last, "\n");
+            if (last != p) { ++p; }
+        }
+        benchmark::DoNotOptimize(lineCount);
+    }
+    restoreSimdLevel(state);
+}
+
+// ---------------------------------------------------------------------------
+void findNewlineMemchr(benchmark::State& state)
+{
+    // Reference: the same search with the C library.
+    auto text{language::benchmarks::randomText(kTextSize)};
+    for (std::size_t i{40U}; i < text.size(); i += 40U) { text[i] = '\n'; }
+
+    for (auto _ : state)
+    {
+        std::size_t lineCount{};
+        const auto last{text.data() + text.size()};
+        for (const char* p{text.data()}; last != p; ++lineCount)
+        {
+            const auto end{static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(last - p)))};
+            p = end ? end + 1 : last;
+        }
+        benchmark::DoNotOptimize(lineCount);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kTextSize));
+}
+
+// ---------------------------------------------------------------------------
+void trimTrailingWhitespaces(benchmark::State& state)
+{
+    // Trim a text ending with a long run of whitespaces.
+    std::string text(kTextSize, ' ');
+    for (std::size_t i{}; i < text.size(); i += 7U) { text[i] = '\t'; }
+    text.front() = 'x';
+    selectSimdLevel(state);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(language::utils::trimTrailingWhitespaces(text.data(), text.data() + text.size()));
+    }
+    restoreSimdLevel(state);
+}
+
+// ---------------------------------------------------------------------------
+void trimTrailingWhitespacesFindIf(benchmark::State& state)
+{
+    // Reference: the previous implementation of removeTrailingWhitespaces.
+    std::string text(kTextSize, ' ');
+    for (std::size_t i{}; i < text.size(); i += 7U) { text[i] = '\t'; }
+    text.front() = 'x';
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::find_if(text.rbegin(), text.rend(), [](unsigned char ch)
+            { return !std::isspace(ch); }).base());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kTextSize));
+}
+
+// ---------------------------------------------------------------------------
+void isBlank(benchmark::State& state)
+{
+    // Check a text consisting of whitespaces only.
+    std::string text(kTextSize, ' ');
+    for (std::size_t i{}; i < text.size(); i += 5U) { text[i] = '\r'; }
+    selectSimdLevel(state);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(language::utils::isBlank(text.data(), text.data() + text.size()));
+    }
+    restoreSimdLevel(state);
+}
+
+// ---------------------------------------------------------------------------
+void isValidUtf8(benchmark::State& state)
+{
+    // Validate text with a two-byte or three-byte sequence in every word.
+    std::string text{};
+    while (text.size() < kTextSize) { text.append("Gr\xC3\xBC\xC3\x9F""e vom Fr\xC3\xB6sch, 5 \xE2\x82\xAC!\n"); }
+    text.resize(kTextSize - 1U);
+    text.push_back('\n');
+    selectSimdLevel(state);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(language::utils::isValidUtf8(text.data(), text.data() + text.size()));
+    }
+    restoreSimdLevel(state);
+}
+
+// ---------------------------------------------------------------------------
+void isValidUtf8Ascii(benchmark::State& state)
+{
+    // Validate ASCII text.
+    const auto text{language::benchmarks::randomText(kTextSize)};
+    selectSimdLevel(state);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(language::utils::isValidUtf8(text.data(), text.data() + text.size()));
+    }
+    restoreSimdLevel(state);
+}
+} // namespace
+
+BENCHMARK(findNewline)->DenseRange(0, 2);
+BENCHMARK(findNewlineMemchr);
+BENCHMARK(trimTrailingWhitespaces)->DenseRange(0, 2);
+BENCHMARK(trimTrailingWhitespacesFindIf);
+BENCHMARK(isBlank)->DenseRange(0, 2);
+BENCHMARK(isValidUtf8)->DenseRange(0, 2);
+BENCHMARK(isValidUtf8Ascii)->DenseRange(0, 2);
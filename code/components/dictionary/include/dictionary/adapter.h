@@ -6,6 +6,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "adapter_interface.h"
 #include "utils/phrase.h"
@@ -60,6 +61,68 @@ public:
      */
     const std::list<Phrase> &phrases() const override;
 
+    /**
+     * @brief Get the number of phrases in the dictionary.
+     * 
+     * @return The number of phrases.
+     */
+    std::size_t phraseCount() const noexcept override;
+
+    /**
+     * @brief Get a phrase by its index in the dictionary.
+     * 
+     * @param[in] index The index of the phrase, must be smaller than the number of phrases.
+     * 
+     * @return The phrase.
+     */
+    Phrase phrase(std::size_t index) const override;
+
+    /**
+     * @brief Get consecutive phrases by their index in the dictionary.
+     * 
+     * @param[in] first The index of the first phrase.
+     * @param[in] count The number of phrases, cut at the end of the dictionary.
+     * @param[out] phrases Vector the phrases are appended to.
+     * 
+     * @return True if the phrases were read, else false.
+     */
+    bool phrases(std::size_t first, std::size_t count, std::vector<Phrase> &phrases) const override;
+
+    /**
+     * @brief Check if reading a phrase has failed.
+     * 
+     * @return Always false, the phrases are stored in the process.
+     */
+    bool failed() const noexcept override;
+
+    /**
+     * @brief Get the phrases as token IDs, if stored that way.
+     * 
+     * @return Pointer to the tokenized phrases, or nullptr if the phrases are stored as text.
+     */
+    const TokenizedCorpus *tokenizedPhrases() const noexcept override;
+
+    /**
+     * @brief Get the phrases as a multi-language corpus, if loaded that way.
+     * 
+     * @return Pointer to the corpus, or nullptr if the phrases are stored as pairs.
+     */
+    const Corpus *corpus() const noexcept override;
+
+    /**
+     * @brief Get the corpus column used as primary language.
+     * 
+     * @return The column of the primary language, 0 if the phrases are stored as pairs.
+     */
+    std::size_t primaryColumn() const noexcept override;
+
+    /**
+     * @brief Get the corpus column used as target language.
+     * 
+     * @return The column of the target language, 1 if the phrases are stored as pairs.
+     */
+    std::size_t targetColumn() const noexcept override;
+
     /**
      * @brief Get the number of phrases to use during the game.
      * 
@@ -3,7 +3,9 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <list>
+#include <vector>
 
 #include "utils/phrase.h"
 
@@ -11,6 +13,12 @@ namespace language
 {
 namespace dictionary
 {
+/** Phrases stored as token IDs. */
+class TokenizedCorpus;
+
+/** Multi-language corpus. */
+class Corpus;
+
 /**
  * @brief Dictionary adapter interface for providing the file path from which to load phrases
  *        and the number of phrases to run.
@@ -26,12 +34,77 @@ public:
     /**
      * @brief Get phrases to put in the dictionary. 
      * 
-     *        The phrases are paired in target and primary language.
+     *        The phrases are paired in target and primary language. Compatibility path for 
+     *        consumers that need the whole list, adapters not storing the phrases as a list 
+     *        build a full copy of them. Prefer phraseCount(), phrase() and phrases(first, 
+     *        count, phrases).
      * 
      * @return Phrases to put in the dictionary.
      */
     virtual const std::list<Phrase> &phrases() const = 0;
 
+    /**
+     * @brief Get the number of phrases in the dictionary.
+     * 
+     * @return The number of phrases.
+     */
+    virtual std::size_t phraseCount() const noexcept = 0;
+
+    /**
+     * @brief Get a phrase by its index in the dictionary.
+     * 
+     * @param[in] index The index of the phrase, must be smaller than the number of phrases.
+     * 
+     * @return The phrase.
+     */
+    virtual Phrase phrase(std::size_t index) const = 0;
+
+    /**
+     * @brief Get consecutive phrases by their index in the dictionary.
+     * 
+     * @param[in] first The index of the first phrase.
+     * @param[in] count The number of phrases, cut at the end of the dictionary.
+     * @param[out] phrases Vector the phrases are appended to.
+     * 
+     * @return True if the phrases were read, else false.
+     */
+    virtual bool phrases(std::size_t first, std::size_t count, std::vector<Phrase> &phrases) const = 0;
+
+    /**
+     * @brief Check if reading a phrase has failed, after which the phrases are incomplete.
+     * 
+     * @return True if a phrase couldn't be read, else false.
+     */
+    virtual bool failed() const noexcept = 0;
+
+    /**
+     * @brief Get the phrases as token IDs, if stored that way.
+     * 
+     * @return Pointer to the tokenized phrases, or nullptr if the phrases are stored as text.
+     */
+    virtual const TokenizedCorpus *tokenizedPhrases() const noexcept = 0;
+
+    /**
+     * @brief Get the phrases as a multi-language corpus, if loaded that way.
+     * 
+     * @return Pointer to the corpus, or nullptr if the phrases are stored as pairs.
+     */
+    virtual const Corpus *corpus() const noexcept = 0;
+
+    /**
+     * @brief Get the corpus column used as primary language.
+     * 
+     * @return The column of the primary language, 0 if the phrases are stored as pairs.
+     */
+    virtual std::size_t primaryColumn() const noexcept = 0;
+
+    /**
+     * @brief Get the corpus column used as target language.
+     * 
+     * @return The column of the target language, 1 if the phrases are stored as pairs.
+     */
+    virtual std::size_t targetColumn() const noexcept = 0;
+
     /**
      * @brief Get the number of phrases to use during the game.
      * 
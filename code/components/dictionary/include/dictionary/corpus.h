@@ -0,0 +1,124 @@
+/**
+ * @brief Columnar multi-language corpus for language game.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace language
+{
+namespace dictionary
+{
+/**
+ * @brief Corpus of entries holding the same phrase in any number of languages.
+ *
+ *        The entries are stored column by column, with the texts of each language stored
+ *        back-to-back in one contiguous buffer. Accessing a pair of languages therefore only
+ *        touches the two columns involved, regardless of the number of languages.
+ */
+class Corpus final
+{
+public:
+    /**
+     * @brief Create empty corpus.
+     *
+     * @param[in] columnCount The number of languages per entry.
+     */
+    explicit Corpus(std::size_t columnCount);
+
+    /**
+     * @brief Delete corpus.
+     */
+    ~Corpus() noexcept = default;
+
+    /**
+     * @brief Add an entry to the corpus.
+     *
+     * @param[in] texts The text of each language, missing texts are stored as empty texts
+     *                  and texts beyond the number of columns are ignored.
+     */
+    void add(const std::vector<std::string_view> &texts);
+
+    /**
+     * @brief Remove the last entry of the corpus, if any.
+     */
+    void removeLast() noexcept;
+
+    /**
+     * @brief Get the number of entries in the corpus.
+     *
+     * @return The number of entries.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * @brief Check if the corpus is empty.
+     *
+     * @return True if the corpus holds no entries, else false.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Get the number of languages per entry.
+     *
+     * @return The number of columns.
+     */
+    std::size_t columnCount() const noexcept;
+
+    /**
+     * @brief Get the text of an entry in one language.
+     *
+     * @param[in] index The index of the entry, must be smaller than the corpus size.
+     * @param[in] column The column of the language, must be smaller than the column count.
+     *
+     * @return View of the text, valid until the next entry is added.
+     */
+    std::string_view text(std::size_t index, std::size_t column) const noexcept;
+
+    /**
+     * @brief Check if two entries are equal in all languages.
+     *
+     * @param[in] x The index of the first entry.
+     * @param[in] y The index of the second entry.
+     *
+     * @return True if the entries are equal, else false.
+     */
+    bool equal(std::size_t x, std::size_t y) const noexcept;
+
+    /**
+     * @brief Calculate the hash of an entry over all languages.
+     *
+     * @param[in] index The index of the entry.
+     *
+     * @return The hash of the entry.
+     */
+    std::size_t hash(std::size_t index) const noexcept;
+
+    /**
+     * @brief Get the approximate memory usage of the corpus.
+     *
+     * @return The approximate memory usage in bytes.
+     */
+    std::size_t memoryUsage() const noexcept;
+
+private:
+    /**
+     * @brief Texts of all entries in one language.
+     */
+    struct Column
+    {
+        /** The texts stored back-to-back. */
+        std::string text;
+
+        /** Offset of each text in the buffer, followed by the buffer size. */
+        std::vector<std::size_t> offsets;
+    };
+
+    /** The columns, one per language. */
+    std::vector<Column> myColumns;
+};
+} // namespace dictionary
+} // namespace language
@@ -0,0 +1,128 @@
+/**
+ * @brief External-memory merge of phrase files for language game.
+ */
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace language
+{
+namespace dictionary
+{
+/**
+ * @brief Merge of phrase files into one file without duplicates, for corpora larger than memory.
+ *
+ *        The merge works as an external sort in two passes:
+ *        1. Phrase pairs are read in order and numbered. Batches filling a share of the memory
+ *           budget are sorted by hash on worker threads, deduplicated and spilled to run files.
+ *        2. The runs are merged, keeping the first occurrence of each pair. The remaining pairs
+ *           are sorted by their number into new runs, which are merged into the output file.
+ *
+ *        The output therefore holds each pair once, in order of its first occurrence, just like
+ *        loading all files into one dictionary. Runs are merged at most kMaxMergeWidth at a time,
+ *        so the number of open files is bounded. The inputs are read completely before the
+ *        output is written, so the output may replace one of the inputs.
+ */
+class CorpusMerge final
+{
+public:
+    /** Default memory budget in bytes. */
+    static constexpr std::size_t kDefaultMemoryBudget{256U * 1024U * 1024U};
+
+    /** The maximum number of runs merged at once. */
+    static constexpr std::size_t kMaxMergeWidth{64U};
+
+    /**
+     * @brief Create corpus merge.
+     *
+     * @param[in] memoryBudget Memory used for batches of phrases in bytes (default = 256 MB).
+     * @param[in] threadCount The maximum number of threads sorting batches, 0 uses all available
+     *                        cores (default = 0).
+     * @param[in] tempDirectory Directory to store the runs in, the system's temporary directory
+     *                          is used if empty (default = empty).
+     */
+    explicit CorpusMerge(std::size_t memoryBudget = kDefaultMemoryBudget, std::size_t threadCount = 0U,
+                         const std::string &tempDirectory = "");
+
+    /**
+     * @brief Remove remaining runs and delete corpus merge.
+     */
+    ~CorpusMerge() noexcept;
+
+    /**
+     * @brief Merge phrase files into one file.
+     *
+     *        Inputs are read like phrase files loaded into the dictionary: line-based files hold
+     *        pairs on consecutive lines, TSV, CSV and JSON Lines files hold one pair per record.
+     *        The output is written in the line-based format.
+     *
+     * @param[in] inputPaths Paths to the files to merge, in order of precedence.
+     * @param[in] outputPath Path to the file to write the merged phrases to.
+     * @param[in] skipHeaders Indicate whether to skip the first record of tabular files
+     *                        (default = false).
+     *
+     * @return True if the files were merged, false if a file couldn't be read or written.
+     */
+    bool merge(const std::vector<std::string> &inputPaths, const std::string &outputPath,
+               bool skipHeaders = false);
+
+    /**
+     * @brief Get the number of phrase pairs read by the last merge.
+     *
+     * @return The number of read phrase pairs.
+     */
+    std::size_t phraseCount() const noexcept;
+
+    /**
+     * @brief Get the number of unique phrase pairs written by the last merge.
+     *
+     * @return The number of written phrase pairs.
+     */
+    std::size_t uniquePhraseCount() const noexcept;
+
+    /**
+     * @brief Get the number of runs spilled to disk by the last merge.
+     *
+     * @return The number of runs.
+     */
+    std::size_t runCount() const noexcept;
+
+    CorpusMerge(const CorpusMerge &)             = delete; // No copy constructor.
+    CorpusMerge(CorpusMerge &&)                  = delete; // No move constructor.
+    CorpusMerge & operator=(const CorpusMerge &) = delete; // No copy assignment.
+    CorpusMerge & operator=(CorpusMerge &&)      = delete; // No move assignment.
+
+private:
+    bool createRunDirectory();
+    bool generateRuns(const std::vector<std::string> &inputPaths, bool skipHeaders,
+                      std::vector<std::string> &runPaths);
+    bool removeDuplicates(std::vector<std::string> &runPaths);
+    bool writeOutput(std::vector<std::string> &runPaths, const std::string &outputPath);
+    std::string nextRunPath();
+
+    /** Memory used for batches of phrases in bytes. */
+    std::size_t myMemoryBudget;
+
+    /** The number of threads sorting batches. */
+    std::size_t myThreadCount;
+
+    /** Directory to create the run directory in. */
+    std::filesystem::path myTempDirectory;
+
+    /** Directory holding the runs of the current merge, empty if not created. */
+    std::filesystem::path myRunDirectory;
+
+    /** The number of runs created by the current merge. */
+    std::size_t myRunCount;
+
+    /** The number of phrase pairs read. */
+    std::size_t myPhraseCount;
+
+    /** The number of unique phrase pairs written. */
+    std::size_t myUniquePhraseCount;
+};
+} // namespace dictionary
+} // namespace language
@@ -5,16 +5,30 @@
 
 #include <iostream>
 #include <list>
+#include <memory>
+#include <vector>
 
 #include "utils/phrase.h"
 
 namespace language
 {
+namespace utils
+{
+/** Timer-driven task scheduler. */
+class Scheduler;
+} // namespace utils
+
 namespace dictionary
 {
 /** Dictionary adapter implementation. */
 class AdapterInterface;
 
+/** Phrases stored as token IDs. */
+class TokenizedCorpus;
+
+/** Multi-language corpus. */
+class Corpus;
+
 /**
  * @brief Implementation of dictionary for a translation game.
  */
@@ -33,13 +47,79 @@ public:
      */
     ~Dictionary() noexcept = default;
 
+    /** The number of phrases read at a time by forEachPhrase(). */
+    static constexpr std::size_t kPhraseBlockSize{1024U};
+
     /**
      * @brief Provide all phrases stored in the dictionary.
      *
+     *        Compatibility path for consumers that need the whole list. If the phrases aren't
+     *        stored as a list, e.g. as token IDs, as corpus columns or by shard workers, a full
+     *        copy of the phrases is built on the first call and kept. Use phraseCount(), 
+     *        phrase(), phrases(first, count, phrases) or forEachPhrase() instead.
+     *
      * @return Vector storing all stored phrases in pairs.
      */
     const std::list<Phrase>& phrases() const noexcept;
 
+    /**
+     * @brief Provide a phrase stored in the dictionary.
+     *
+     * @param[in] index The index of the phrase, must be smaller than the number of phrases.
+     *
+     * @return The phrase.
+     */
+    Phrase phrase(std::size_t index) const;
+
+    /**
+     * @brief Provide consecutive phrases stored in the dictionary, in as few lookups as possible.
+     *
+     * @param[in] first The index of the first phrase.
+     * @param[in] count The number of phrases, cut at the end of the dictionary.
+     * @param[out] phrases Vector the phrases are appended to.
+     *
+     * @return True if the phrases were read, else false.
+     */
+    bool phrases(std::size_t first, std::size_t count, std::vector<Phrase>& phrases) const;
+
+    /**
+     * @brief Visit all phrases stored in the dictionary in order, reading kPhraseBlockSize 
+     *        phrases at a time.
+     *
+     * @param[in] visit Function called with each phrase, which it may move from.
+     *
+     * @return True if all phrases were visited, false if a block of phrases couldn't be read.
+     */
+    template <typename Visitor>
+    bool forEachPhrase(Visitor&& visit) const
+    {
+        std::vector<Phrase> block{};
+        for (std::size_t first{}; first < phraseCount(); first += kPhraseBlockSize)
+        {
+            block.clear();
+            if (!phrases(first, kPhraseBlockSize, block)) { return false; }
+            for (auto& phrase : block) { visit(phrase); }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Provide the phrases stored in the dictionary as token IDs, if stored that way.
+     *
+     * @return Pointer to the tokenized phrases, or nullptr if the phrases are stored as text.
+     */
+    const TokenizedCorpus* tokenizedPhrases() const noexcept;
+
+    /**
+     * @brief Provide the multi-language corpus the phrases are taken from, if loaded that way.
+     *
+     *        The phrases of the dictionary consist of the primary and target columns of the
+     *        corpus, as selected by the adapter.
+     *
+     * @return Pointer to the corpus, or nullptr if the phrases are stored as pairs.
+     */
+    const Corpus* corpus() const noexcept;
+
     /**
      * @brief Provide the number of phrases stored in the dictionary.
      *
@@ -68,13 +148,47 @@ public:
      */
     bool empty() const noexcept;
 
+    /**
+     * @brief Check if reading a phrase has failed, e.g. because a shard worker has ended.
+     *
+     * @return True if a phrase couldn't be read, else false.
+     */
+    bool failed() const noexcept;
+
     /**
      * @brief Print phrases stored in the dictionary.
+     * 
+     *        Phrases are printed with the print interval between each pair. If the print
+     *        interval is 0 ms, the phrases are exported in large buffered blocks.
+     *        This function blocks until all phrases have been printed.
      *
      * @param[in] ostream Reference to the output stream (default = stdout).
      */
     void print(std::ostream& ostream = std::cout) const;
 
+    /**
+     * @brief Schedule printing of phrases stored in the dictionary without blocking.
+     * 
+     *        Phrases are printed with the print interval between each pair from a dedicated
+     *        scheduler thread. The dictionary and the stream must outlive the returned scheduler.
+     *
+     * @param[in] ostream Reference to the output stream (default = stdout).
+     * 
+     * @return The started scheduler, which can be used to wait for or stop the printing.
+     */
+    std::unique_ptr<utils::Scheduler> schedulePrint(std::ostream& ostream = std::cout) const;
+
+    /**
+     * @brief Export phrases stored in the dictionary without delay.
+     * 
+     *        The phrases are written in large buffered blocks, regardless of the print interval.
+     *
+     * @param[in] ostream Reference to the output stream (default = stdout).
+     * 
+     * @return The number of exported phrases.
+     */
+    std::size_t exportPhrases(std::ostream& ostream = std::cout) const;
+
     Dictionary()                             = delete; // No default constructor.
     Dictionary(const Dictionary&)            = delete; // No copy constructor.
     Dictionary(Dictionary&&)                 = delete; // No move constructor.
@@ -0,0 +1,239 @@
+/**
+ * @brief Dictionary adapter serving phrases compiled into the executable.
+ */
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "adapter_interface.h"
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace dictionary
+{
+/**
+ * @brief Phrase pair stored in a constant table, pointing to string literals.
+ */
+struct EmbeddedPhrase
+{
+    /** Primary language phrase. */
+    std::string_view primary;
+
+    /** Target language phrase. */
+    std::string_view target;
+};
+
+/**
+ * @brief Dictionary adapter serving a constant table of phrases compiled into the executable.
+ *
+ *        The table is generated at build time by the 'EmbedCorpus' tool, which already removes
+ *        duplicates and annotations. Creating the adapter neither parses nor allocates: the
+ *        phrases are only copied into strings when requested, and the phrase list is only built
+ *        for consumers that need the whole list. The adapter therefore isn't split into an
+ *        implementation class like the file-based adapter.
+ */
+class EmbeddedAdapter final : public AdapterInterface
+{
+public:
+    /**
+     * @brief Create dictionary adapter for a table of phrases.
+     *
+     * @param[in] phrases Pointer to the first phrase of the table, which must outlive the adapter.
+     * @param[in] phraseCount The number of phrases in the table.
+     * @param[in] phraseCountToUse The number of phrases to use during the game, 0 uses all phrases
+     *                             (default = 0).
+     */
+    EmbeddedAdapter(const EmbeddedPhrase *phrases, std::size_t phraseCount,
+                    std::size_t phraseCountToUse = 0U) noexcept;
+
+    /**
+     * @brief Create dictionary adapter for a table of phrases and input arguments.
+     *
+     *        The first argument which isn't an option is the number of phrases to use, like the
+     *        second argument of the file-based adapter. '--no-delay' disables the print interval.
+     *
+     * @param[in] phrases Pointer to the first phrase of the table, which must outlive the adapter.
+     * @param[in] phraseCount The number of phrases in the table.
+     * @param[in] argc The number of input arguments entered from the terminal at runtime.
+     * @param[in] argv Vector storing all input arguments entered from the terminal at runtime.
+     */
+    EmbeddedAdapter(const EmbeddedPhrase *phrases, std::size_t phraseCount, int argc,
+                    const char **argv) noexcept;
+
+    /**
+     * @brief Create dictionary adapter for a table of phrases.
+     *
+     * @param[in] phrases The table of phrases, which must outlive the adapter.
+     * @param[in] phraseCountToUse The number of phrases to use during the game, 0 uses all phrases
+     *                             (default = 0).
+     */
+    template <std::size_t N>
+    explicit EmbeddedAdapter(const EmbeddedPhrase (&phrases)[N],
+                             const std::size_t phraseCountToUse = 0U) noexcept
+        : EmbeddedAdapter{phrases, N, phraseCountToUse}
+    {}
+
+    /**
+     * @brief Create dictionary adapter for a table of phrases and input arguments.
+     *
+     * @param[in] phrases The table of phrases, which must outlive the adapter.
+     * @param[in] argc The number of input arguments entered from the terminal at runtime.
+     * @param[in] argv Vector storing all input arguments entered from the terminal at runtime.
+     */
+    template <std::size_t N>
+    EmbeddedAdapter(const EmbeddedPhrase (&phrases)[N], const int argc, const char **argv) noexcept
+        : EmbeddedAdapter{phrases, N, argc, argv}
+    {}
+
+    /**
+     * @brief Delete dictionary adapter.
+     */
+    ~EmbeddedAdapter() noexcept override = default;
+
+    /**
+     * @brief Get phrases to put in the dictionary.
+     *
+     *        The list is built from the table on the first call.
+     *
+     * @return Phrases to put in the dictionary.
+     */
+    const std::list<Phrase> &phrases() const override;
+
+    /**
+     * @brief Get the number of phrases in the dictionary.
+     *
+     * @return The number of phrases.
+     */
+    std::size_t phraseCount() const noexcept override;
+
+    /**
+     * @brief Get a phrase by its index in the dictionary.
+     *
+     * @param[in] index The index of the phrase, must be smaller than the number of phrases.
+     *
+     * @return The phrase.
+     */
+    Phrase phrase(std::size_t index) const override;
+
+    /**
+     * @brief Get consecutive phrases by their index in the dictionary.
+     *
+     * @param[in] first The index of the first phrase.
+     * @param[in] count The number of phrases, cut at the end of the dictionary.
+     * @param[out] phrases Vector the phrases are appended to.
+     *
+     * @return True if the phrases were read, else false.
+     */
+    bool phrases(std::size_t first, std::size_t count, std::vector<Phrase> &phrases) const override;
+
+    /**
+     * @brief Check if reading a phrase has failed.
+     *
+     * @return Always false, the phrases are compiled into the executable.
+     */
+    bool failed() const noexcept override;
+
+    /**
+     * @brief Get the phrases as token IDs, if stored that way.
+     *
+     * @return Always nullptr, embedded phrases are stored as text.
+     */
+    const TokenizedCorpus *tokenizedPhrases() const noexcept override;
+
+    /**
+     * @brief Get the phrases as a multi-language corpus, if loaded that way.
+     *
+     * @return Always nullptr, embedded phrases are stored as pairs.
+     */
+    const Corpus *corpus() const noexcept override;
+
+    /**
+     * @brief Get the corpus column used as primary language.
+     *
+     * @return Always 0, embedded phrases are stored as pairs.
+     */
+    std::size_t primaryColumn() const noexcept override;
+
+    /**
+     * @brief Get the corpus column used as target language.
+     *
+     * @return Always 1, embedded phrases are stored as pairs.
+     */
+    std::size_t targetColumn() const noexcept override;
+
+    /**
+     * @brief Get the number of phrases to use during the game.
+     *
+     * @return Number of phrases to use during the game.
+     */
+    std::size_t phraseCountToUse() const noexcept override;
+
+    /**
+     * @brief Get the print interval in milliseconds.
+     *
+     * @return The print interval in milliseconds.
+     */
+    std::size_t printIntervalMs() const noexcept override;
+
+    EmbeddedAdapter()                                    = delete; // No default constructor.
+    EmbeddedAdapter(const EmbeddedAdapter &)             = delete; // No copy constructor.
+    EmbeddedAdapter(EmbeddedAdapter &&)                  = delete; // No move constructor.
+    EmbeddedAdapter & operator=(const EmbeddedAdapter &) = delete; // No copy assignment.
+    EmbeddedAdapter & operator=(EmbeddedAdapter &&)      = delete; // No move assignment.
+
+private:
+    /** Default print interval in milliseconds. */
+    static constexpr std::size_t kDefaultPrintIntervalMs{2000U};
+
+    /** Pointer to the first phrase of the table. */
+    const EmbeddedPhrase *myPhrases;
+
+    /** The number of phrases in the table. */
+    std::size_t myPhraseCount;
+
+    /** The number of phrases to use during a game. */
+    std::size_t myPhraseCountToUse;
+
+    /** Print interval in milliseconds. */
+    std::size_t myPrintIntervalMs;
+
+    /** Phrases built on first request for the phrase list. */
+    mutable std::list<Phrase> myPhraseList;
+
+    /** Flag ensuring that the phrase list is only built once. */
+    mutable std::once_flag myPhraseListFlag;
+};
+
+/**
+ * @brief Prepare lines of a phrase file for embedding.
+ *
+ *        Annotation lines, starting with '#', are removed. The remaining lines are paired like
+ *        in a phrase file, and only the first occurrence of duplicate pairs is kept.
+ *
+ * @param[in] lines Non-empty lines of the phrase file, without trailing whitespaces.
+ *
+ * @return The phrases to embed, in order of first occurrence.
+ */
+std::vector<Phrase> embeddablePhrases(const std::vector<std::string> &lines);
+
+/**
+ * @brief Write phrases as a header defining a constant table for the embedded adapter.
+ *
+ *        The header defines 'language::embedded::kPhrases', an array of EmbeddedPhrase, with
+ *        every text written as an escaped string literal of explicit length.
+ *
+ * @param[in] ostream Reference to the output stream to write the header to.
+ * @param[in] phrases The phrases to write, must not be empty.
+ * @param[in] source Name of the phrase file, mentioned in the header.
+ */
+void writeEmbeddedPhrases(std::ostream &ostream, const std::vector<Phrase> &phrases,
+                          const std::string &source);
+} // namespace dictionary
+} // namespace language
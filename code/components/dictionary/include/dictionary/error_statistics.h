@@ -0,0 +1,115 @@
+/**
+ * @brief Statistics of the phrases missed in the error files of language game.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace dictionary
+{
+/**
+ * @brief Phrase with the number of times it was missed.
+ */
+struct MissedPhrase
+{
+    /** The phrase. */
+    Phrase phrase;
+
+    /** The number of times the phrase was missed. */
+    std::uint64_t missCount;
+};
+
+/**
+ * @brief Counter of how often each phrase was missed, over the error files written by the game.
+ *
+ *        Error files are scanned in parallel, each task handles a batch of files: every file is
+ *        opened relative to the already open directory, read with a single call into a buffer
+ *        reused by the thread, and parsed in place. Only phrases a thread sees for the first
+ *        time are copied. Each thread counts in its own hash map, and the maps are merged once
+ *        all files have been scanned.
+ */
+class ErrorStatistics final
+{
+public:
+    /** The number of files scanned per task. */
+    static constexpr std::size_t kFilesPerTask{256U};
+
+    /**
+     * @brief Create empty statistics.
+     *
+     * @param[in] threadCount The number of scanning threads, 0 uses all available cores
+     *                        (default = 0).
+     */
+    explicit ErrorStatistics(std::size_t threadCount = 0U);
+
+    /**
+     * @brief Scan the error files of a directory, i.e. files named 'errors<N>.txt'.
+     *
+     *        Files are parsed like phrase files: trailing whitespaces are removed, empty lines
+     *        are skipped and consecutive lines form pairs.
+     *
+     * @param[in] directory Path to the directory.
+     *
+     * @return True if the directory was read, else false.
+     */
+    bool scan(const std::string &directory);
+
+    /**
+     * @brief Get the most often missed phrases.
+     *
+     * @param[in] count The maximum number of phrases to get.
+     *
+     * @return The phrases, most often missed first. Phrases missed equally often are ordered
+     *         by text.
+     */
+    std::vector<MissedPhrase> hardest(std::size_t count) const;
+
+    /**
+     * @brief Get the number of scanned files.
+     *
+     * @return The number of files.
+     */
+    std::size_t fileCount() const noexcept;
+
+    /**
+     * @brief Get the number of missed phrases, counting repeated misses.
+     *
+     * @return The number of misses.
+     */
+    std::uint64_t missCount() const noexcept;
+
+    /**
+     * @brief Get the number of different missed phrases.
+     *
+     * @return The number of phrases.
+     */
+    std::size_t phraseCount() const noexcept;
+
+    ErrorStatistics(const ErrorStatistics &)             = delete; // No copy constructor.
+    ErrorStatistics(ErrorStatistics &&)                  = delete; // No move constructor.
+    ErrorStatistics & operator=(const ErrorStatistics &) = delete; // No copy assignment.
+    ErrorStatistics & operator=(ErrorStatistics &&)      = delete; // No move assignment.
+
+private:
+    /** The number of scanning threads. */
+    std::size_t myThreadCount;
+
+    /** The number of misses by phrase. */
+    std::unordered_map<Phrase, std::uint64_t, PhraseHash> myMissCounts;
+
+    /** The number of scanned files. */
+    std::size_t myFileCount;
+
+    /** The number of misses. */
+    std::uint64_t myMissCount;
+};
+} // namespace dictionary
+} // namespace language
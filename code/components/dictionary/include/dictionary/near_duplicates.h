@@ -0,0 +1,50 @@
+/**
+ * @brief Near-duplicate detection for phrases loaded into the dictionary.
+ */
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <vector>
+
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace dictionary
+{
+/** Cluster of near-duplicate phrases, holding phrase indexes in ascending order. */
+using Cluster = std::vector<std::size_t>;
+
+/**
+ * @brief Find clusters of near-duplicate phrases.
+ * 
+ *        Each pair is normalized by converting ASCII letters to lowercase and ignoring
+ *        punctuation and spacing, after which a MinHash signature is calculated over the 
+ *        character trigrams of both languages. Signatures are split into bands, and phrases
+ *        sharing any band are verified as near-duplicates if their estimated similarity reaches 
+ *        the threshold. This finds candidates in roughly linear time, without comparing all pairs.
+ *        Signatures are calculated on multiple threads.
+ *
+ * @param[in] phrases The phrases to search, indexes are assigned in list order.
+ * @param[in] threshold The minimum estimated Jaccard similarity of near-duplicates, in [0, 1]
+ *                      (default = 0.7).
+ * @param[in] threadCount The maximum number of threads to use, 0 uses all available cores
+ *                        (default = 0).
+ * 
+ * @return Clusters holding at least two phrases, ordered by their first phrase.
+ */
+std::vector<Cluster> findNearDuplicates(const std::list<Phrase> &phrases, double threshold = 0.7, 
+                                        std::size_t threadCount = 0U);
+
+/**
+ * @brief Merge clusters of near-duplicate phrases by keeping only the first phrase of each cluster.
+ * 
+ * @param[in,out] phrases The phrases to merge.
+ * @param[in] clusters The clusters to merge, as returned by findNearDuplicates.
+ * 
+ * @return The number of removed phrases.
+ */
+std::size_t mergeNearDuplicates(std::list<Phrase> &phrases, const std::vector<Cluster> &clusters);
+} // namespace dictionary
+} // namespace language
@@ -0,0 +1,179 @@
+/**
+ * @brief Dictionary adapter partitioning the phrases across worker processes.
+ */
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "adapter_interface.h"
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace dictionary
+{
+/** Sharded dictionary adapter implementation. */
+class ShardedAdapterImpl;
+
+/**
+ * @brief Dictionary adapter partitioning the phrases by hash across local worker processes.
+ *
+ *        The adapter is the coordinator: it streams the phrase file and sends each phrase to
+ *        the worker owning the shard of its hash. Each worker stores only its shard, so the
+ *        memory of the phrases per process shrinks with the number of shards. Duplicates always
+ *        hash to the same shard, which removes them like the file-based adapter, but the file is
+ *        never rewritten. The phrases are numbered shard by shard, and each lookup by position is
+ *        routed to the worker owning the phrase over a Unix socket.
+ *
+ *        The workers only serve lookups by position. Indexes built over the phrases, like the
+ *        distractor index of the multiple-choice mode, are still built by the coordinator from
+ *        all phrases. Files with more than two columns and the search for near-duplicates
+ *        aren't supported.
+ */
+class ShardedAdapter final : public AdapterInterface
+{
+public:
+    /**
+     * @brief Create sharded dictionary adapter.
+     *
+     * @param[in] filePath Path to the file from where to load the phrases.
+     * @param[in] shardCount The number of shards, i.e. of worker processes.
+     */
+    ShardedAdapter(const std::string &filePath, std::size_t shardCount);
+
+    /**
+     * @brief Create sharded dictionary adapter.
+     *
+     *        The arguments are those of the file-based adapter, the number of shards is set
+     *        with '--shards=<count>'.
+     *
+     * @param[in] argc The number of input arguments entered from the terminal at runtime.
+     * @param[in] argv Vector storing all input arguments entered from the terminal at runtime.
+     */
+    ShardedAdapter(int argc, const char **argv);
+
+    /**
+     * @brief Stop the worker processes and delete the dictionary adapter.
+     */
+    ~ShardedAdapter() noexcept override;
+
+    /**
+     * @brief Get phrases to put in the dictionary.
+     *
+     *        The list is fetched from the workers on the first call.
+     *
+     * @return Phrases to put in the dictionary.
+     */
+    const std::list<Phrase> &phrases() const override;
+
+    /**
+     * @brief Get the number of phrases in the dictionary.
+     *
+     * @return The number of phrases in all shards.
+     */
+    std::size_t phraseCount() const noexcept override;
+
+    /**
+     * @brief Get a phrase by its index in the dictionary, from the worker owning it.
+     *
+     * @param[in] index The index of the phrase, must be smaller than the number of phrases.
+     *
+     * @return The phrase, or an empty phrase if the worker doesn't respond, which marks the
+     *         adapter as failed.
+     */
+    Phrase phrase(std::size_t index) const override;
+
+    /**
+     * @brief Get consecutive phrases by their index in the dictionary, fetched in ranges from
+     *        the workers owning them.
+     *
+     * @param[in] first The index of the first phrase.
+     * @param[in] count The number of phrases, cut at the end of the dictionary.
+     * @param[out] phrases Vector the phrases are appended to.
+     *
+     * @return True if the phrases were read, false if a worker doesn't respond, which marks the
+     *         adapter as failed.
+     */
+    bool phrases(std::size_t first, std::size_t count, std::vector<Phrase> &phrases) const override;
+
+    /**
+     * @brief Check if a worker hasn't responded, after which the phrases are incomplete.
+     *
+     * @return True if a phrase couldn't be read from a worker, else false.
+     */
+    bool failed() const noexcept override;
+
+    /**
+     * @brief Get the phrases as token IDs, if stored that way.
+     *
+     * @return Always nullptr, the phrases are stored by the workers.
+     */
+    const TokenizedCorpus *tokenizedPhrases() const noexcept override;
+
+    /**
+     * @brief Get the phrases as a multi-language corpus, if loaded that way.
+     *
+     * @return Always nullptr, sharded phrases are stored as pairs.
+     */
+    const Corpus *corpus() const noexcept override;
+
+    /**
+     * @brief Get the corpus column used as primary language.
+     *
+     * @return Always 0, sharded phrases are stored as pairs.
+     */
+    std::size_t primaryColumn() const noexcept override;
+
+    /**
+     * @brief Get the corpus column used as target language.
+     *
+     * @return Always 1, sharded phrases are stored as pairs.
+     */
+    std::size_t targetColumn() const noexcept override;
+
+    /**
+     * @brief Get the number of phrases to use during the game.
+     *
+     * @return Number of phrases to use during the game.
+     */
+    std::size_t phraseCountToUse() const noexcept override;
+
+    /**
+     * @brief Get the print interval in milliseconds.
+     *
+     * @return The print interval in milliseconds.
+     */
+    std::size_t printIntervalMs() const noexcept override;
+
+    /**
+     * @brief Get the number of shards.
+     *
+     * @return The number of shards, 0 if the phrases couldn't be loaded.
+     */
+    std::size_t shardCount() const noexcept;
+
+    /**
+     * @brief Get the number of phrases owned by a shard.
+     *
+     * @param[in] shard The shard, must be smaller than the number of shards.
+     *
+     * @return The number of phrases of the shard.
+     */
+    std::size_t shardPhraseCount(std::size_t shard) const noexcept;
+
+    ShardedAdapter()                                   = delete; // No default constructor.
+    ShardedAdapter(const ShardedAdapter &)             = delete; // No copy constructor.
+    ShardedAdapter(ShardedAdapter &&)                  = delete; // No move constructor.
+    ShardedAdapter & operator=(const ShardedAdapter &) = delete; // No copy assignment.
+    ShardedAdapter & operator=(ShardedAdapter &&)      = delete; // No move assignment.
+
+private:
+    /** Sharded dictionary adapter implementation. */
+    std::unique_ptr<ShardedAdapterImpl> myImpl;
+};
+} // namespace dictionary
+} // namespace language
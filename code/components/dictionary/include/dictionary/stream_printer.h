@@ -0,0 +1,118 @@
+/**
+ * @brief Constant-memory phrase printer streaming phrases directly from a file.
+ */
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace utils
+{
+/** Bloom filter for approximate membership tests. */
+class BloomFilter;
+
+/** Buffered terminal output. */
+class Output;
+
+/** Streaming phrase reader. */
+class PhraseReader;
+} // namespace utils
+
+namespace dictionary
+{
+/**
+ * @brief Phrase printer parsing and printing phrase pairs while reading the file.
+ * 
+ *        Unlike the dictionary, no phrases are stored, so printing starts immediately and 
+ *        memory usage stays flat regardless of the file size. Duplicates can optionally be
+ *        skipped by an approximate dedupe with a fixed memory budget, in which case a small
+ *        fraction of unique phrases may be skipped as well.
+ */
+class StreamPrinter final
+{
+public:
+    /**
+     * @brief Create stream printer.
+     *
+     *        The same positional arguments as for the dictionary adapter are used, i.e. the file
+     *        path, the number of phrases to print and the print interval in milliseconds.
+     *        The following options are supported:
+     *        --no-delay        Print without delay in large buffered blocks.
+     *        --dedupe[=<MB>]   Skip duplicates using a Bloom filter of the given size 
+     *                          (default = 16 MB).
+     * 
+     * @param[in] argc The number of input arguments entered from the terminal at runtime.
+     * @param[in] argv Vector storing all input arguments entered from the terminal at runtime.
+     */
+    StreamPrinter(int argc, const char **argv);
+
+    /**
+     * @brief Delete stream printer.
+     */
+    ~StreamPrinter() noexcept = default;
+
+    /**
+     * @brief Print phrases from the file, blocks until all phrases have been printed.
+     *
+     * @param[in] ostream Reference to the output stream (default = stdout).
+     * 
+     * @return True if the file was read, otherwise false.
+     */
+    bool print(std::ostream& ostream = std::cout);
+
+    /**
+     * @brief Get the number of printed phrases.
+     * 
+     * @return The number of printed phrases.
+     */
+    std::size_t printedPhraseCount() const noexcept;
+
+    /**
+     * @brief Get the number of phrases skipped as duplicates.
+     * 
+     * @return The number of skipped phrases.
+     */
+    std::size_t skippedPhraseCount() const noexcept;
+
+    StreamPrinter()                                  = delete; // No default constructor.
+    StreamPrinter(const StreamPrinter &)             = delete; // No copy constructor.
+    StreamPrinter(StreamPrinter &&)                  = delete; // No move constructor.
+    StreamPrinter & operator=(const StreamPrinter &) = delete; // No copy assignment.
+    StreamPrinter & operator=(StreamPrinter &&)      = delete; // No move assignment.
+
+private:
+    bool printNext(utils::PhraseReader &reader, utils::BloomFilter *filter, utils::Output &output);
+
+    /** Default print interval in milliseconds. */
+    static constexpr std::size_t kDefaultPrintIntervalMs{2000U};
+
+    /** Default dedupe filter size in megabytes. */
+    static constexpr std::size_t kDefaultDedupeSizeMb{16U};
+
+    /** Path to the file to print phrases from. */
+    std::string myFilePath;
+
+    /** The maximum number of phrases to print, 0 prints all phrases. */
+    std::size_t myPhraseCountToUse;
+
+    /** Print interval in milliseconds. */
+    std::size_t myPrintIntervalMs;
+
+    /** Dedupe filter size in bytes, 0 disables the dedupe. */
+    std::size_t myDedupeSize;
+
+    /** The number of printed phrases. */
+    std::size_t myPrintedPhraseCount;
+
+    /** The number of phrases skipped as duplicates. */
+    std::size_t mySkippedPhraseCount;
+
+    /** Phrase reused for each read pair. */
+    Phrase myPhrase;
+};
+} // namespace dictionary
+} // namespace language
@@ -0,0 +1,174 @@
+/**
+ * @brief Token-ID representation of phrases for language game.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/phrase.h"
+#include "utils/vocabulary.h"
+
+namespace language
+{
+namespace dictionary
+{
+/**
+ * @brief Range of token IDs making up one text of a phrase.
+ */
+struct TokenRange
+{
+    /** Pointer to the first token ID. */
+    const utils::Vocabulary::Token *first;
+
+    /** Pointer past the last token ID. */
+    const utils::Vocabulary::Token *last;
+
+    /** @brief Get pointer to the first token ID. */
+    const utils::Vocabulary::Token *begin() const noexcept { return first; }
+
+    /** @brief Get pointer past the last token ID. */
+    const utils::Vocabulary::Token *end() const noexcept { return last; }
+
+    /** @brief Get the number of token IDs in the range. */
+    std::size_t size() const noexcept { return static_cast<std::size_t>(last - first); }
+
+    /** @brief Check if the range is empty. */
+    bool empty() const noexcept { return first == last; }
+
+    /** @brief Get the token ID at given position in the range. */
+    utils::Vocabulary::Token operator[](const std::size_t i) const noexcept { return first[i]; }
+};
+
+/**
+ * @brief Phrases stored as sequences of token IDs into a shared vocabulary.
+ *
+ *        Each text is split on single spaces and every word is stored once in the vocabulary,
+ *        so the phrases take up four bytes per word instead of one string per text. The text
+ *        is rebuilt on request by joining the words with single spaces, which reproduces the
+ *        original text exactly, including repeated spaces.
+ */
+class TokenizedCorpus final
+{
+public:
+    /** Column of the primary language text. */
+    static constexpr std::size_t kPrimaryColumn{0U};
+
+    /** Column of the target language text. */
+    static constexpr std::size_t kTargetColumn{1U};
+
+    /**
+     * @brief Create empty corpus.
+     *
+     * @param[in] vocabulary Vocabulary to intern words into, may be shared between corpora
+     *                       (default = new vocabulary).
+     */
+    explicit TokenizedCorpus(std::shared_ptr<utils::Vocabulary> vocabulary = 
+                                 std::make_shared<utils::Vocabulary>());
+
+    /**
+     * @brief Create corpus holding given phrases.
+     *
+     * @param[in] phrases The phrases to tokenize.
+     * @param[in] vocabulary Vocabulary to intern words into (default = new vocabulary).
+     */
+    explicit TokenizedCorpus(const std::list<Phrase> &phrases,
+                             std::shared_ptr<utils::Vocabulary> vocabulary = 
+                                 std::make_shared<utils::Vocabulary>());
+
+    /**
+     * @brief Delete corpus.
+     */
+    ~TokenizedCorpus() noexcept = default;
+
+    /**
+     * @brief Tokenize and add a phrase to the corpus.
+     *
+     * @param[in] phrase The phrase to add.
+     */
+    void add(const Phrase &phrase);
+
+    /**
+     * @brief Get the number of phrases in the corpus.
+     *
+     * @return The number of phrases.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * @brief Check if the corpus is empty.
+     *
+     * @return True if the corpus holds no phrases, else false.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Get the token IDs of one text of a phrase.
+     *
+     * @param[in] index The index of the phrase, must be smaller than the corpus size.
+     * @param[in] column The column of the text (kPrimaryColumn or kTargetColumn).
+     *
+     * @return Range of token IDs, valid until the next phrase is added.
+     */
+    TokenRange tokens(std::size_t index, std::size_t column) const noexcept;
+
+    /**
+     * @brief Rebuild one text of a phrase.
+     *
+     * @param[in] index The index of the phrase, must be smaller than the corpus size.
+     * @param[in] column The column of the text (kPrimaryColumn or kTargetColumn).
+     *
+     * @return The text.
+     */
+    std::string text(std::size_t index, std::size_t column) const;
+
+    /**
+     * @brief Rebuild a phrase.
+     *
+     * @param[in] index The index of the phrase, must be smaller than the corpus size.
+     *
+     * @return The phrase.
+     */
+    Phrase phrase(std::size_t index) const;
+
+    /**
+     * @brief Get the vocabulary of the corpus.
+     *
+     * @return Reference to the vocabulary.
+     */
+    const utils::Vocabulary &vocabulary() const noexcept;
+
+    /**
+     * @brief Get the approximate memory usage of the corpus, including the vocabulary.
+     *
+     * @return The approximate memory usage in bytes.
+     */
+    std::size_t memoryUsage() const noexcept;
+
+    TokenizedCorpus(const TokenizedCorpus&)            = delete; // No copy constructor.
+    TokenizedCorpus(TokenizedCorpus&&)                 = delete; // No move constructor.
+    TokenizedCorpus& operator=(const TokenizedCorpus&) = delete; // No copy assignment.
+    TokenizedCorpus& operator=(TokenizedCorpus&&)      = delete; // No move assignment.
+
+private:
+    /** The number of columns per phrase. */
+    static constexpr std::size_t kColumnCount{2U};
+
+    void addText(std::string_view text);
+
+    /** Vocabulary holding the words of the corpus. */
+    std::shared_ptr<utils::Vocabulary> myVocabulary;
+
+    /** Token IDs of all texts, stored back-to-back. */
+    std::vector<utils::Vocabulary::Token> myTokens;
+
+    /** Offset of the first token ID of each text, followed by the total number of token IDs. */
+    std::vector<std::size_t> myOffsets;
+};
+} // namespace dictionary
+} // namespace language
@@ -4,6 +4,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "dictionary/adapter.h"
 #include "adapter_impl.h"
@@ -33,6 +34,37 @@ Adapter::~Adapter() noexcept = default;
 // ---------------------------------------------------------------------------
 const std::list<Phrase> &Adapter::phrases() const { return myImpl->phrases(); }
 
+// ---------------------------------------------------------------------------
+std::size_t Adapter::phraseCount() const noexcept { return myImpl->phraseCount(); }
+
+// ---------------------------------------------------------------------------
+Phrase Adapter::phrase(const std::size_t index) const { return myImpl->phrase(index); }
+
+// ---------------------------------------------------------------------------
+bool Adapter::phrases(const std::size_t first, const std::size_t count, std::vector<Phrase> &phrases) const
+{
+    for (auto i{first}; (i < myImpl->phraseCount()) && (i - first < count); ++i) { phrases.push_back(myImpl->phrase(i)); }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool Adapter::failed() const noexcept { return false; }
+
+// ---------------------------------------------------------------------------
+const TokenizedCorpus *Adapter::tokenizedPhrases() const noexcept 
+{ 
+    return myImpl->tokenizedPhrases(); 
+}
+
+// ---------------------------------------------------------------------------
+const Corpus *Adapter::corpus() const noexcept { return myImpl->corpus(); }
+
+// ---------------------------------------------------------------------------
+std::size_t Adapter::primaryColumn() const noexcept { return myImpl->primaryColumn(); }
+
+// ---------------------------------------------------------------------------
+std::size_t Adapter::targetColumn() const noexcept { return myImpl->targetColumn(); }
+
 // ---------------------------------------------------------------------------
 std::size_t Adapter::phraseCountToUse() const noexcept { return myImpl->phraseCountToUse(); }
 
@@ -1,13 +1,27 @@
 /**
  * @brief Implementation details of class language::dictionary::AdapterImpl.
  */
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <limits>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
 
 #include "adapter_impl.h"
+#include "dictionary/corpus.h"
+#include "dictionary/near_duplicates.h"
+#include "dictionary/tokenized_corpus.h"
+#include "utils/arguments.h"
+#include "utils/metrics.h"
+#include "utils/output.h"
 #include "utils/phrase.h"
+#include "utils/record_reader.h"
 #include "utils/utils.h"
 
 namespace language
@@ -16,25 +30,76 @@ namespace dictionary
 {
 namespace
 {
-bool removeDuplicates(std::list<Phrase> &phrases);
+/**
+ * @brief Hash function for corpus entries referred to by index.
+ */
+struct EntryHash
+{
+    /** The corpus holding the entries. */
+    const Corpus *corpus;
+
+    /** @brief Calculate hash of the entry at given index. */
+    std::size_t operator()(const std::size_t i) const noexcept { return corpus->hash(i); }
+};
+
+/**
+ * @brief Comparison function for corpus entries referred to by index.
+ */
+struct EntryEqual
+{
+    /** The corpus holding the entries. */
+    const Corpus *corpus;
+
+    /** @brief Check if the entries at given indexes are equal. */
+    bool operator()(const std::size_t x, const std::size_t y) const noexcept { return corpus->equal(x, y); }
+};
+
+/** Set of unique corpus entries referred to by index. */
+using EntrySet = std::unordered_set<std::size_t, EntryHash, EntryEqual>;
+
+bool addUniqueEntry(Corpus &corpus, EntrySet &entries, const std::vector<std::string_view> &entry);
 void updateFile(const std::string &filePath, const std::list<Phrase> &phrases);
+void updateFile(const std::string &filePath, const Corpus &corpus);
 } // namespace
 
 // ---------------------------------------------------------------------------
 AdapterImpl::AdapterImpl(const std::list<Phrase> &phrases)
     : myPhrases{phrases}
+    , myPhraseIndex{}
+    , myTokenizedPhrases{}
+    , myCorpus{}
+    , myPrimaryColumn{0U}
+    , myTargetColumn{1U}
+    , myRebuiltPhrases{}
+    , myRebuiltPhrasesFlag{}
     , myPhraseCountToUse{}
     , myPrintIntervalMs{kDefaultPrintIntervalMs}
+    , myNearDuplicateMode{NearDuplicateMode::Off}
+    , myNearDuplicateSimilarity{kDefaultNearDuplicateSimilarity}
+    , mySkipHeader{false}
+    , myUtf8Policy{utils::Utf8Policy::Report}
 {
-    removeDuplicates(myPhrases);
+    utils::removeDuplicates(myPhrases);
+    indexPhrases();
     setPhraseCountToUse();
 }
 
 // ---------------------------------------------------------------------------
 AdapterImpl::AdapterImpl(const std::string &filePath)
     : myPhrases{}
+    , myPhraseIndex{}
+    , myTokenizedPhrases{}
+    , myCorpus{}
+    , myPrimaryColumn{0U}
+    , myTargetColumn{1U}
+    , myRebuiltPhrases{}
+    , myRebuiltPhrasesFlag{}
     , myPhraseCountToUse{}
     , myPrintIntervalMs{kDefaultPrintIntervalMs}
+    , myNearDuplicateMode{NearDuplicateMode::Off}
+    , myNearDuplicateSimilarity{kDefaultNearDuplicateSimilarity}
+    , mySkipHeader{false}
+    , myUtf8Policy{utils::Utf8Policy::Report}
 {
     load(filePath);
 }
@@ -42,14 +107,69 @@ AdapterImpl::AdapterImpl(const std::string &filePath)
 // ---------------------------------------------------------------------------
 AdapterImpl::AdapterImpl(const int argc, const char **argv)
     : myPhrases{}
+    , myPhraseIndex{}
+    , myTokenizedPhrases{}
+    , myCorpus{}
+    , myPrimaryColumn{0U}
+    , myTargetColumn{1U}
+    , myRebuiltPhrases{}
+    , myRebuiltPhrasesFlag{}
     , myPhraseCountToUse{}
     , myPrintIntervalMs{kDefaultPrintIntervalMs}
+    , myNearDuplicateMode{NearDuplicateMode::Off}
+    , myNearDuplicateSimilarity{kDefaultNearDuplicateSimilarity}
+    , mySkipHeader{false}
+    , myUtf8Policy{utils::Utf8Policy::Report}
 {
     load(argc, argv);
 }
 
 // ---------------------------------------------------------------------------
-const std::list<Phrase> &AdapterImpl::phrases() const { return myPhrases; }
+const std::list<Phrase> &AdapterImpl::phrases() const 
+{ 
+    if (!myTokenizedPhrases && !myCorpus) { return myPhrases; }
+
+    // Tokenized phrases and corpus entries are only rebuilt as a list for consumers that need 
+    // the whole list.
+    std::call_once(myRebuiltPhrasesFlag, [this]()
+    {
+        for (std::size_t i{}; i < phraseCount(); ++i) { myRebuiltPhrases.push_back(phrase(i)); }
+    });
+    return myRebuiltPhrases;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t AdapterImpl::phraseCount() const noexcept
+{
+    if (myCorpus) { return myCorpus->size(); }
+    return myTokenizedPhrases ? myTokenizedPhrases->size() : myPhraseIndex.size();
+}
+
+// ---------------------------------------------------------------------------
+Phrase AdapterImpl::phrase(const std::size_t index) const
+{
+    if (myCorpus)
+    {
+        return Phrase{std::string{myCorpus->text(index, myPrimaryColumn)}, 
+                      std::string{myCorpus->text(index, myTargetColumn)}};
+    }
+    return myTokenizedPhrases ? myTokenizedPhrases->phrase(index) : *myPhraseIndex[index];
+}
+
+// ---------------------------------------------------------------------------
+const TokenizedCorpus *AdapterImpl::tokenizedPhrases() const noexcept 
+{ 
+    return myTokenizedPhrases.get(); 
+}
+
+// ---------------------------------------------------------------------------
+const Corpus *AdapterImpl::corpus() const noexcept { return myCorpus.get(); }
+
+// ---------------------------------------------------------------------------
+std::size_t AdapterImpl::primaryColumn() const noexcept { return myPrimaryColumn; }
+
+// ---------------------------------------------------------------------------
+std::size_t AdapterImpl::targetColumn() const noexcept { return myTargetColumn; }
 
 // ---------------------------------------------------------------------------
 std::size_t AdapterImpl::phraseCountToUse() const noexcept { return myPhraseCountToUse; }
@@ -60,14 +180,120 @@ std::size_t AdapterImpl::printIntervalMs() const noexcept { return myPrintInterv
 // ---------------------------------------------------------------------------
 bool AdapterImpl::load(const std::string& filePath)
 {
-    if (0U == utils::loadPhrasesFromFile(filePath, myPhrases))
+    LANGUAGE_METRICS_TIME("load", "Time spent loading phrase files.");
+
+    // Parse tabular files directly, they are never rewritten.
+    const auto format{utils::recordFormat(filePath)};
+    if (utils::RecordFormat::Lines != format) { return load(filePath, format, 2U); }
+
+    std::vector<std::size_t> invalidLines{};
+    const auto phraseCount{utils::loadPhrasesFromFile(filePath, myPhrases, myUtf8Policy, invalidLines)};
+    if (!checkUtf8(filePath, invalidLines, "line", myUtf8Policy)) { return false; }
+    if (0U == phraseCount)
     {
         std::cerr << "\nFile \"" << filePath << "\" wasn't found or contains insufficient data!\n\n";
         return false;
     }
 
     // Remove duplicate phrases, update file is duplicates were found.
-    if (removeDuplicates(myPhrases)) { updateFile(filePath, myPhrases); }
+    const auto duplicatesRemoved{utils::removeDuplicates(myPhrases)};
+    const auto nearDuplicatesMerged{handleNearDuplicates()};
+    if (duplicatesRemoved || nearDuplicatesMerged) { updateFile(filePath, myPhrases); }
+    indexPhrases();
+    setPhraseCountToUse();
+
+    std::cout << "\nLanguage data from file \"" << filePath << "\" successfully loaded!\n\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool AdapterImpl::load(const std::string &filePath, const std::size_t columnCount)
+{
+    LANGUAGE_METRICS_TIME("load", "Time spent loading phrase files.");
+
+    const auto format{utils::recordFormat(filePath)};
+    if (utils::RecordFormat::Lines != format) { return load(filePath, format, columnCount); }
+
+    std::vector<std::string> lines{};
+    std::vector<std::size_t> invalidLines{};
+    const auto loaded{utils::retrieveFromFile(filePath, lines, myUtf8Policy, invalidLines)};
+    if (!checkUtf8(filePath, invalidLines, "line", myUtf8Policy)) { return false; }
+    if (!loaded || (lines.size() < columnCount))
+    {
+        std::cerr << "\nFile \"" << filePath << "\" wasn't found or contains insufficient data!\n\n";
+        return false;
+    }
+
+    // Store consecutive lines as entries, keep the first occurrence of duplicate entries.
+    myCorpus = std::make_unique<Corpus>(columnCount);
+    EntrySet entries{lines.size() / columnCount, EntryHash{myCorpus.get()}, EntryEqual{myCorpus.get()}};
+    std::vector<std::string_view> entry(columnCount);
+    bool duplicateFound{false};
+
+    for (std::size_t i{}; i + columnCount <= lines.size(); i += columnCount)
+    {
+        for (std::size_t column{}; column < columnCount; ++column) { entry[column] = lines[i + column]; }
+        if (!addUniqueEntry(*myCorpus, entries, entry)) { duplicateFound = true; }
+    }
+    lines.clear();
+    lines.shrink_to_fit();
+
+    if (duplicateFound) { updateFile(filePath, *myCorpus); }
+    setPhraseCountToUse();
+
+    std::cout << "\nLanguage data from file \"" << filePath << "\" successfully loaded!\n\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool AdapterImpl::load(const std::string &filePath, const utils::RecordFormat format, 
+                       const std::size_t columnCount)
+{
+    utils::RecordReader reader{filePath, format, utils::RecordReader::kDefaultBufferSize, myUtf8Policy};
+    if (!reader.isOpen())
+    {
+        std::cerr << "\nFile \"" << filePath << "\" wasn't found!\n\n";
+        return false;
+    }
+    if (2U < columnCount) { myCorpus = std::make_unique<Corpus>(columnCount); }
+    EntrySet entries{0U, EntryHash{myCorpus.get()}, EntryEqual{myCorpus.get()}};
+    std::vector<std::string> fields{};
+    std::vector<std::string_view> entry(columnCount);
+
+    // Skip the header and all records without text in the first two columns, like blank lines.
+    if (mySkipHeader) { reader.next(fields); }
+    while (reader.next(fields))
+    {
+        if ((2U > fields.size()) || (fields[0U].empty() && fields[1U].empty())) { continue; }
+        if (!myCorpus) 
+        { 
+            myPhrases.push_back(Phrase{fields[0U], fields[1U]}); 
+            continue;
+        }
+        for (std::size_t column{}; column < columnCount; ++column) 
+        { 
+            entry[column] = (column < fields.size()) ? std::string_view{fields[column]} : std::string_view{}; 
+        }
+        addUniqueEntry(*myCorpus, entries, entry);
+    }
+    if (!checkUtf8(filePath, reader.invalidRecords(), "record", myUtf8Policy))
+    {
+        myPhrases.clear();
+        myCorpus.reset();
+        return false;
+    }
+
+    if (!myCorpus)
+    {
+        utils::removeDuplicates(myPhrases);
+        handleNearDuplicates();
+        indexPhrases();
+    }
+    if (0U == phraseCount())
+    {
+        std::cerr << "\nFile \"" << filePath << "\" contains insufficient data!\n\n";
+        return false;
+    }
     setPhraseCountToUse();
 
     std::cout << "\nLanguage data from file \"" << filePath << "\" successfully loaded!\n\n";
@@ -77,64 +303,194 @@ bool AdapterImpl::load(const std::string& filePath)
 // ---------------------------------------------------------------------------
 bool AdapterImpl::load(const int argc, const char** argv)
 {
-    if (1 >= argc)
+    // Options ("--name=value") are skipped here, only positional arguments are used.
+    const utils::Arguments args{argc, argv};
+    const auto &positional{args.positional()};
+
+    if (1U >= args.positionalCount())
     {
         std::cerr << "Cannot load dictionary due to missing file path!\n\n";
         return false;
     }
-    const auto filePath{argv[1U]};
-    load(filePath);
+
+    // Search for near-duplicates at load if requested.
+    const auto nearDuplicateMode{args.option("near-duplicates")};
+    if ("report" == nearDuplicateMode) { myNearDuplicateMode = NearDuplicateMode::Report; }
+    else if ("merge" == nearDuplicateMode) { myNearDuplicateMode = NearDuplicateMode::Merge; }
+    myNearDuplicateSimilarity = args.numericOption("similarity", kDefaultNearDuplicateSimilarity);
+    mySkipHeader              = args.hasOption("header");
+
+    // Select how to handle invalid UTF-8, report it by default.
+    const auto utf8Policy{args.option("utf8", "report")};
+    if (!utils::parseUtf8Policy(utf8Policy, myUtf8Policy))
+    {
+        std::cerr << "Invalid UTF-8 policy \"" << utf8Policy << "\", reporting invalid UTF-8!\n\n";
+    }
+
+    // Load entries with more than two languages if requested, and select the language pair.
+    const auto filePath{positional[1U]};
+    const auto columnCount{args.numericOption("columns", 2U)};
+    if (!((2U < columnCount) ? load(filePath, columnCount) : load(filePath))) { return false; }
+    if (2U < columnCount) { selectColumns(args.option("pair", "1,2")); }
+
+    // Store the phrases as token IDs if requested, this is done after the file is updated.
+    if (args.hasOption("tokenize") && !myCorpus) { tokenizePhrases(); }
 
     // Get number of phrases to run during the game.
-    if (3 <= argc)
+    if (3U <= args.positionalCount())
     {
-        const auto phraseCount{static_cast<std::size_t>(std::atoi(argv[2U]))};
-        setPhraseCountToUse(static_cast<std::size_t>(std::atoi(argv[2U])));
+        setPhraseCountToUse(static_cast<std::size_t>(std::atoi(positional[2U].c_str())));
     }
 
-    // Get the phrase interval in milliseconds.
-    if (4 <= argc) { myPrintIntervalMs = static_cast<std::size_t>(std::atoi(argv[3U])); }
-    return !myPhrases.empty();
+    // Get the phrase interval in milliseconds, print without delay if requested.
+    if (4U <= args.positionalCount()) 
+    { 
+        myPrintIntervalMs = static_cast<std::size_t>(std::atoi(positional[3U].c_str())); 
+    }
+    if (args.hasOption("no-delay")) { myPrintIntervalMs = 0U; }
+    return 0U != phraseCount();
 }
 
 // ---------------------------------------------------------------------------
-void AdapterImpl::setPhraseCountToUse() noexcept { myPhraseCountToUse = myPhrases.size(); }
+bool AdapterImpl::handleNearDuplicates()
+{
+    if (NearDuplicateMode::Off == myNearDuplicateMode) { return false; }
+    const auto clusters{findNearDuplicates(myPhrases, myNearDuplicateSimilarity / 100.0)};
+    if (clusters.empty()) { return false; }
+
+    // Report each cluster with the phrases in order of appearance.
+    std::vector<const Phrase *> phrases{};
+    for (const auto &phrase : myPhrases) { phrases.push_back(&phrase); }
+    std::cout << "\n" << clusters.size() << " cluster(s) of near-duplicate phrases found:\n";
+
+    for (const auto &cluster : clusters)
+    {
+        std::cout << "\n";
+        for (const auto i : cluster) 
+        { 
+            std::cout << "  " << phrases[i]->primary << " | " << phrases[i]->target << "\n"; 
+        }
+    }
+    std::cout << "\n";
+    if (NearDuplicateMode::Report == myNearDuplicateMode) { return false; }
+
+    const auto removedPhrases{mergeNearDuplicates(myPhrases, clusters)};
+    std::cout << removedPhrases << " near-duplicate phrase(s) merged into the first occurrence!\n";
+    return true;
+}
 
 // ---------------------------------------------------------------------------
-void AdapterImpl::setPhraseCountToUse(const std::size_t phraseCount) noexcept
+void AdapterImpl::selectColumns(const std::string &columns)
 {
-    myPhraseCountToUse = (0U != phraseCount) ? phraseCount : myPhrases.size();
+    // Columns are entered as "<primary>,<target>", counted from 1.
+    const auto separator{columns.find(',')};
+    const auto primaryColumn{static_cast<std::size_t>(std::atoi(columns.substr(0U, separator).c_str()))};
+    const auto targetColumn{(std::string::npos != separator) ? 
+        static_cast<std::size_t>(std::atoi(columns.substr(separator + 1U).c_str())) : 0U};
+
+    if ((0U == primaryColumn) || (0U == targetColumn) || (primaryColumn == targetColumn) ||
+        (myCorpus->columnCount() < primaryColumn) || (myCorpus->columnCount() < targetColumn))
+    {
+        std::cerr << "Invalid language pair \"" << columns << "\", using the first two languages!\n\n";
+        return;
+    }
+    myPrimaryColumn = primaryColumn - 1U;
+    myTargetColumn  = targetColumn - 1U;
 }
 
-namespace
+// ---------------------------------------------------------------------------
+void AdapterImpl::indexPhrases()
 {
+    myPhraseIndex.clear();
+    myPhraseIndex.reserve(myPhrases.size());
+    for (const auto &phrase : myPhrases) { myPhraseIndex.push_back(&phrase); }
+}
+
 // ---------------------------------------------------------------------------
-bool removeDuplicates(std::list<Phrase> &phrases)
+void AdapterImpl::tokenizePhrases()
 {
-    bool duplicateFound{false};
-    if (phrases.empty()) { return duplicateFound; }
-
-    for (auto i{phrases.begin()}; i != std::prev(phrases.end()); ++i)
-    {
-        for (auto j{std::next(i)}; j != phrases.end(); )
-        {
-            if (*i == *j) 
-            { 
-                // Put next element at address j is pointing at on match.
-                j = phrases.erase(j); 
-                duplicateFound = true;
-            }
-            else { ++j; }
-        }
+    myTokenizedPhrases = std::make_unique<TokenizedCorpus>();
+    myPhraseIndex.clear();
+    myPhraseIndex.shrink_to_fit();
+
+    // Release the text representation while tokenizing, so that both are never fully resident.
+    // The phrases are rebuilt from the token IDs on request.
+    while (!myPhrases.empty())
+    {
+        myTokenizedPhrases->add(myPhrases.front());
+        myPhrases.pop_front();
+    }
+}
+
+// ---------------------------------------------------------------------------
+void AdapterImpl::setPhraseCountToUse() noexcept { myPhraseCountToUse = phraseCount(); }
+
+// ---------------------------------------------------------------------------
+void AdapterImpl::setPhraseCountToUse(const std::size_t count) noexcept
+{
+    myPhraseCountToUse = (0U != count) ? count : phraseCount();
+}
+
+// ---------------------------------------------------------------------------
+bool checkUtf8(const std::string &filePath, const std::vector<std::size_t> &invalidNumbers, 
+               const char *unit, const utils::Utf8Policy utf8Policy)
+{
+    // List the first lines or records with invalid UTF-8, return false if the file is rejected.
+    constexpr std::size_t kMaxListed{10U};
+    if (invalidNumbers.empty()) { return true; }
+
+    std::cerr << "\nFile \"" << filePath << "\" contains invalid UTF-8 in " << invalidNumbers.size() 
+              << " " << unit << "(s):";
+    for (std::size_t i{}; (i < invalidNumbers.size()) && (i < kMaxListed); ++i) { std::cerr << " " << invalidNumbers[i]; }
+    if (kMaxListed < invalidNumbers.size()) { std::cerr << " ..."; }
+    std::cerr << "\n";
+
+    if (utils::Utf8Policy::Reject == utf8Policy)
+    {
+        std::cerr << "File \"" << filePath << "\" rejected!\n\n";
+        return false;
     }
-    return duplicateFound;
+    if (utils::Utf8Policy::Repair == utf8Policy) { std::cerr << "Invalid sequences replaced with U+FFFD.\n"; }
+    return true;
+}
+
+namespace
+{
+// ---------------------------------------------------------------------------
+bool addUniqueEntry(Corpus &corpus, EntrySet &entries, const std::vector<std::string_view> &entry)
+{
+    // Add the entry to be able to compare it, remove it again if it's a duplicate.
+    corpus.add(entry);
+    if (entries.insert(corpus.size() - 1U).second) { return true; }
+    corpus.removeLast();
+    return false;
 }
 
 // ---------------------------------------------------------------------------
 void updateFile(const std::string &filePath, const std::list<Phrase> &phrases)
 {
+    LANGUAGE_METRICS_TIME("write_back", "Time spent rewriting phrase files without duplicates.");
     utils::writePhrasesToFile(filePath, phrases);
 }
+
+// ---------------------------------------------------------------------------
+void updateFile(const std::string &filePath, const Corpus &corpus)
+{
+    LANGUAGE_METRICS_TIME("write_back", "Time spent rewriting phrase files without duplicates.");
+    std::ofstream ofstream{filePath};
+    if (!ofstream) { return; }
+    utils::Output output{ofstream};
+
+    // Write each entry on consecutive lines, followed by an additional blank line.
+    for (std::size_t i{}; i < corpus.size(); ++i)
+    {
+        for (std::size_t column{}; column < corpus.columnCount(); ++column) 
+        { 
+            output << corpus.text(i, column) << '\n'; 
+        }
+        output << '\n';
+    }
+}
 } // namespace
 } // namespace dictionary
 } // namespace language
\ No newline at end of file
@@ -4,9 +4,16 @@
 #pragma once
 
 #include <list>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
+#include "dictionary/corpus.h"
+#include "dictionary/tokenized_corpus.h"
 #include "utils/phrase.h"
+#include "utils/record_reader.h"
+#include "utils/utf8.h"
 
 namespace language
 {
@@ -54,6 +61,50 @@ public:
      */
     const std::list<Phrase> &phrases() const;
 
+    /**
+     * @brief Get the number of phrases in the dictionary.
+     * 
+     * @return The number of phrases.
+     */
+    std::size_t phraseCount() const noexcept;
+
+    /**
+     * @brief Get a phrase by its index in the dictionary.
+     * 
+     * @param[in] index The index of the phrase, must be smaller than the number of phrases.
+     * 
+     * @return The phrase.
+     */
+    Phrase phrase(std::size_t index) const;
+
+    /**
+     * @brief Get the phrases as token IDs, if stored that way.
+     * 
+     * @return Pointer to the tokenized phrases, or nullptr if the phrases are stored as text.
+     */
+    const TokenizedCorpus *tokenizedPhrases() const noexcept;
+
+    /**
+     * @brief Get the phrases as a multi-language corpus, if loaded that way.
+     * 
+     * @return Pointer to the corpus, or nullptr if the phrases are stored as pairs.
+     */
+    const Corpus *corpus() const noexcept;
+
+    /**
+     * @brief Get the corpus column used as primary language.
+     * 
+     * @return The column of the primary language, 0 if the phrases are stored as pairs.
+     */
+    std::size_t primaryColumn() const noexcept;
+
+    /**
+     * @brief Get the corpus column used as target language.
+     * 
+     * @return The column of the target language, 1 if the phrases are stored as pairs.
+     */
+    std::size_t targetColumn() const noexcept;
+
     /**
      * @brief Get the number of phrases to use during the game.
      * 
@@ -75,22 +126,92 @@ public:
     AdapterImpl & operator=(AdapterImpl &&)      = delete; // No copy assignment.
 
 private:
+    /**
+     * @brief Enumeration of actions for near-duplicate phrases found at load.
+     */
+    enum class NearDuplicateMode
+    {
+        /** Don't search for near-duplicates. */
+        Off,
+
+        /** Report clusters of near-duplicates. */
+        Report,
+
+        /** Keep only the first phrase of each cluster of near-duplicates. */
+        Merge,
+    };
+
     bool load(const std::string &filePath);
+    bool load(const std::string &filePath, std::size_t columnCount);
+    bool load(const std::string &filePath, utils::RecordFormat format, std::size_t columnCount);
+    void selectColumns(const std::string &columns);
     bool load(int argc, const char **argv);
     void setPhraseCountToUse() noexcept;
     void setPhraseCountToUse(std::size_t count) noexcept;
+    bool handleNearDuplicates();
+    void indexPhrases();
+    void tokenizePhrases();
 
     /** Default print interval in milliseconds. */
     static constexpr std::size_t kDefaultPrintIntervalMs{2000U};
 
-    /** Phrases to put in the dictionary. */
+    /** Default minimum similarity of near-duplicate phrases in percent. */
+    static constexpr std::size_t kDefaultNearDuplicateSimilarity{70U};
+
+    /** Phrases to put in the dictionary, empty once the phrases have been tokenized. */
     std::list<Phrase> myPhrases;
 
+    /** Pointers to the phrases in the list, for access by index. */
+    std::vector<const Phrase *> myPhraseIndex;
+
+    /** Phrases stored as token IDs if requested, else nullptr. */
+    std::unique_ptr<TokenizedCorpus> myTokenizedPhrases;
+
+    /** Phrases stored as multi-language corpus if requested, else nullptr. */
+    std::unique_ptr<Corpus> myCorpus;
+
+    /** The corpus column used as primary language. */
+    std::size_t myPrimaryColumn;
+
+    /** The corpus column used as target language. */
+    std::size_t myTargetColumn;
+
+    /** Phrases rebuilt on first request for the phrase list, if not stored as a list. */
+    mutable std::list<Phrase> myRebuiltPhrases;
+
+    /** Flag ensuring that the phrase list is only rebuilt once. */
+    mutable std::once_flag myRebuiltPhrasesFlag;
+
     /** The number of phrases to use during a game. */
     std::size_t myPhraseCountToUse;
 
     /** Print interval in milliseconds. */
     std::size_t myPrintIntervalMs;
+
+    /** Action for near-duplicate phrases found at load. */
+    NearDuplicateMode myNearDuplicateMode;
+
+    /** Minimum similarity of near-duplicate phrases in percent. */
+    std::size_t myNearDuplicateSimilarity;
+
+    /** Indicate whether to skip the first record of tabular files. */
+    bool mySkipHeader;
+
+    /** How to handle invalid UTF-8 in phrase files. */
+    utils::Utf8Policy myUtf8Policy;
 };
+
+/**
+ * @brief Report the lines or records of a phrase file containing invalid UTF-8.
+ * 
+ * @param[in] filePath Path to the phrase file.
+ * @param[in] invalidNumbers The numbers of the lines or records with invalid UTF-8.
+ * @param[in] unit Name of the unit the numbers refer to, "line" or "record".
+ * @param[in] utf8Policy How invalid UTF-8 was handled.
+ * 
+ * @return False if the file is rejected, else true.
+ */
+bool checkUtf8(const std::string &filePath, const std::vector<std::size_t> &invalidNumbers, 
+               const char *unit, utils::Utf8Policy utf8Policy);
 } // namespace dictionary
 } // namespace language
\ No newline at end of file
@@ -0,0 +1,94 @@
+/**
+ * @brief Implementation details of class language::dictionary::Corpus.
+ */
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "dictionary/corpus.h"
+
+namespace language
+{
+namespace dictionary
+{
+// ---------------------------------------------------------------------------
+Corpus::Corpus(const std::size_t columnCount)
+    : myColumns(columnCount, Column{std::string{}, std::vector<std::size_t>{0U}})
+{}
+
+// ---------------------------------------------------------------------------
+void Corpus::add(const std::vector<std::string_view> &texts)
+{
+    for (std::size_t column{}; column < myColumns.size(); ++column)
+    {
+        auto &[text, offsets]{myColumns[column]};
+        if (column < texts.size()) { text.append(texts[column]); }
+        offsets.push_back(text.size());
+    }
+}
+
+// ---------------------------------------------------------------------------
+void Corpus::removeLast() noexcept
+{
+    if (empty()) { return; }
+    for (auto &[text, offsets] : myColumns)
+    {
+        offsets.pop_back();
+        text.resize(offsets.back());
+    }
+}
+
+// ---------------------------------------------------------------------------
+std::size_t Corpus::size() const noexcept 
+{ 
+    return myColumns.empty() ? 0U : myColumns.front().offsets.size() - 1U; 
+}
+
+// ---------------------------------------------------------------------------
+bool Corpus::empty() const noexcept { return 0U == size(); }
+
+// ---------------------------------------------------------------------------
+std::size_t Corpus::columnCount() const noexcept { return myColumns.size(); }
+
+// ---------------------------------------------------------------------------
+std::string_view Corpus::text(const std::size_t index, const std::size_t column) const noexcept
+{
+    const auto &[text, offsets]{myColumns[column]};
+    return std::string_view{text}.substr(offsets[index], offsets[index + 1U] - offsets[index]);
+}
+
+// ---------------------------------------------------------------------------
+bool Corpus::equal(const std::size_t x, const std::size_t y) const noexcept
+{
+    for (std::size_t column{}; column < myColumns.size(); ++column)
+    {
+        if (text(x, column) != text(y, column)) { return false; }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t Corpus::hash(const std::size_t index) const noexcept
+{
+    std::size_t hash{};
+    for (std::size_t column{}; column < myColumns.size(); ++column)
+    {
+        const auto textHash{std::hash<std::string_view>{}(text(index, column))};
+        hash ^= textHash + 0x9e3779b97f4a7c15ULL + (hash << 6U) + (hash >> 2U);
+    }
+    return hash;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t Corpus::memoryUsage() const noexcept
+{
+    std::size_t memoryUsage{};
+    for (const auto &[text, offsets] : myColumns)
+    {
+        memoryUsage += text.capacity() + offsets.capacity() * sizeof(std::size_t);
+    }
+    return memoryUsage;
+}
+} // namespace dictionary
+} // namespace language
@@ -0,0 +1,664 @@
+/**
+ * @brief Implementation details of class language::dictionary::CorpusMerge.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "dictionary/corpus_merge.h"
+#include "utils/metrics.h"
+#include "utils/output.h"
+#include "utils/phrase.h"
+#include "utils/phrase_reader.h"
+#include "utils/record_reader.h"
+
+namespace language
+{
+namespace dictionary
+{
+namespace
+{
+void removeRuns(const std::vector<std::string> &runPaths) noexcept;
+
+/** Size of the file buffers of runs being read or written. */
+constexpr std::size_t kRunBufferSize{256U * 1024U};
+
+/** Orders of phrase pairs in runs. */
+enum class RunOrder
+{
+    /** Ordered by hash, text and number, so that duplicates are adjacent. */
+    Hash,
+
+    /** Ordered by number, i.e. by first occurrence. */
+    Sequence,
+};
+
+/**
+ * @brief Phrase pair read from a run.
+ */
+struct Record
+{
+    /** The hash of the pair. */
+    std::uint64_t hash;
+
+    /** The number of the pair in order of appearance in the input files. */
+    std::uint64_t sequence;
+
+    /** Primary language phrase. */
+    std::string primary;
+
+    /** Target language phrase. */
+    std::string target;
+};
+
+/**
+ * @brief Batch of phrase pairs, stored in one text buffer of fixed capacity.
+ */
+class Batch final
+{
+public:
+    /**
+     * @brief Phrase pair in the batch, referring to the text buffer.
+     */
+    struct Entry
+    {
+        /** The hash of the pair. */
+        std::uint64_t hash;
+
+        /** The number of the pair in order of appearance in the input files. */
+        std::uint64_t sequence;
+
+        /** Position of the primary phrase in the text buffer. */
+        std::size_t offset;
+
+        /** Size of the primary phrase. */
+        std::uint32_t primarySize;
+
+        /** Size of the target phrase, stored right after the primary phrase. */
+        std::uint32_t targetSize;
+    };
+
+    /**
+     * @brief Create batch using about the given number of bytes.
+     */
+    explicit Batch(const std::size_t capacity)
+        : myText{}
+        , myEntries{}
+    {
+        // Reserve everything up front, so that the batch never exceeds its share of memory.
+        myText.reserve(capacity - capacity / 4U);
+        myEntries.reserve(std::max<std::size_t>(capacity / 4U / sizeof(Entry), 1U));
+    }
+
+    /** @brief Check if a pair of given size fits without exceeding the capacity. */
+    bool fits(const std::size_t size) const noexcept
+    {
+        return (myEntries.size() < myEntries.capacity()) && (myText.size() + size <= myText.capacity());
+    }
+
+    /** @brief Add a pair to the batch. */
+    void add(const std::uint64_t hash, const std::uint64_t sequence, const std::string_view primary,
+             const std::string_view target)
+    {
+        myEntries.push_back(Entry{hash, sequence, myText.size(), static_cast<std::uint32_t>(primary.size()),
+                                  static_cast<std::uint32_t>(target.size())});
+        myText.append(primary);
+        myText.append(target);
+    }
+
+    /** @brief Check if the batch is empty. */
+    bool empty() const noexcept { return myEntries.empty(); }
+
+    /** @brief Get the primary phrase of an entry. */
+    std::string_view primary(const Entry &entry) const noexcept
+    {
+        return std::string_view{myText}.substr(entry.offset, entry.primarySize);
+    }
+
+    /** @brief Get the target phrase of an entry. */
+    std::string_view target(const Entry &entry) const noexcept
+    {
+        return std::string_view{myText}.substr(entry.offset + entry.primarySize, entry.targetSize);
+    }
+
+    /** @brief Get the entries of the batch. */
+    std::vector<Entry> &entries() noexcept { return myEntries; }
+
+private:
+    /** Text of all pairs. */
+    std::string myText;
+
+    /** The pairs in the batch. */
+    std::vector<Entry> myEntries;
+};
+
+/**
+ * @brief Writer storing phrase pairs in a run file.
+ */
+class RunWriter final
+{
+public:
+    /** @brief Create run file. */
+    explicit RunWriter(const std::string &filePath)
+        : myFile{std::fopen(filePath.c_str(), "wb"), &std::fclose}
+        , myFailed{false}
+    {
+        if (myFile) { std::setvbuf(myFile.get(), nullptr, _IOFBF, kRunBufferSize); }
+    }
+
+    /** @brief Check if the file is open. */
+    bool isOpen() const noexcept { return nullptr != myFile; }
+
+    /** @brief Write a phrase pair, prefixed by its hash, number and the sizes of both phrases. */
+    void write(const std::uint64_t hash, const std::uint64_t sequence, const std::string_view primary,
+               const std::string_view target)
+    {
+        const std::uint64_t header[3U]{hash, sequence, (static_cast<std::uint64_t>(primary.size()) << 32U) | target.size()};
+        if (!myFile || (1U != std::fwrite(header, sizeof(header), 1U, myFile.get())) ||
+            (primary.size() != std::fwrite(primary.data(), 1U, primary.size(), myFile.get())) ||
+            (target.size() != std::fwrite(target.data(), 1U, target.size(), myFile.get())))
+        {
+            myFailed = true;
+        }
+    }
+
+    /** @brief Write a phrase pair read from another run. */
+    void write(const Record &record) { write(record.hash, record.sequence, record.primary, record.target); }
+
+    /** @brief Close the file, return false if writing failed. */
+    bool close() noexcept
+    {
+        if (!myFile) { return false; }
+        const auto success{!myFailed && (0 == std::ferror(myFile.get())) && (0 == std::fflush(myFile.get()))};
+        myFile.reset();
+        return success;
+    }
+
+private:
+    /** The run file. */
+    std::unique_ptr<std::FILE, int (*)(std::FILE *)> myFile;
+
+    /** Indicate whether a pair was written only partially. */
+    bool myFailed;
+};
+
+/**
+ * @brief Reader of phrase pairs from a run file.
+ */
+class RunReader final
+{
+public:
+    /** @brief Open run file. */
+    explicit RunReader(const std::string &filePath)
+        : myFile{std::fopen(filePath.c_str(), "rb"), &std::fclose}
+        , myFailed{!myFile}
+    {
+        if (myFile) { std::setvbuf(myFile.get(), nullptr, _IOFBF, kRunBufferSize); }
+    }
+
+    /** @brief Read the next phrase pair, return false at the end of the file or if reading failed. */
+    bool next(Record &record)
+    {
+        if (myFailed) { return false; }
+
+        // Only the end of the file before a header is a clean end, anything else is a truncated run.
+        std::uint64_t header[3U]{};
+        const auto headerSize{std::fread(header, 1U, sizeof(header), myFile.get())};
+        if (sizeof(header) != headerSize)
+        {
+            myFailed = (0U != headerSize) || (0 != std::ferror(myFile.get()));
+            return false;
+        }
+        record.hash     = header[0U];
+        record.sequence = header[1U];
+        record.primary.resize(static_cast<std::size_t>(header[2U] >> 32U));
+        record.target.resize(static_cast<std::size_t>(header[2U] & 0xFFFFFFFFU));
+        myFailed =
+            (record.primary.size() != std::fread(record.primary.data(), 1U, record.primary.size(), myFile.get())) ||
+            (record.target.size() != std::fread(record.target.data(), 1U, record.target.size(), myFile.get()));
+        return !myFailed;
+    }
+
+    /** @brief Check if the file couldn't be opened or a pair couldn't be read completely. */
+    bool failed() const noexcept { return myFailed; }
+
+private:
+    /** The run file. */
+    std::unique_ptr<std::FILE, int (*)(std::FILE *)> myFile;
+
+    /** Indicate whether reading failed. */
+    bool myFailed;
+};
+
+/**
+ * @brief Spiller sorting batches and writing them to run files on worker threads.
+ */
+class RunSpiller final
+{
+public:
+    /** @brief Create spiller using at most the given number of threads at once. */
+    RunSpiller(const RunOrder order, const std::size_t threadCount)
+        : myOrder{order}
+        , myThreadCount{threadCount}
+        , myWorkers{}
+        , myFailed{false}
+    {}
+
+    /** @brief Wait for all batches to be written. */
+    ~RunSpiller() noexcept { wait(); }
+
+    /** @brief Sort and write a batch on a worker thread, blocks while all threads are busy. */
+    void spill(std::unique_ptr<Batch> batch, const std::string &runPath)
+    {
+        if (myWorkers.size() == myThreadCount)
+        {
+            myWorkers.front().join();
+            myWorkers.pop_front();
+        }
+        myWorkers.emplace_back([this, batch{std::move(batch)}, runPath]()
+        {
+            if (!write(*batch, runPath)) { myFailed = true; }
+        });
+    }
+
+    /** @brief Wait for all batches to be written, return false if writing failed. */
+    bool wait() noexcept
+    {
+        for (auto &worker : myWorkers) { worker.join(); }
+        myWorkers.clear();
+        return !myFailed;
+    }
+
+private:
+    bool write(Batch &batch, const std::string &runPath) const
+    {
+        LANGUAGE_METRICS_TIME("merge_spill", "Time spent sorting and writing merge runs.");
+        auto &entries{batch.entries()};
+        auto key = [&batch](const Batch::Entry &entry)
+        {
+            return std::make_tuple(entry.hash, batch.primary(entry), batch.target(entry), entry.sequence);
+        };
+        if (RunOrder::Hash == myOrder)
+        {
+            std::sort(entries.begin(), entries.end(),
+                      [&key](const Batch::Entry &x, const Batch::Entry &y) { return key(x) < key(y); });
+        }
+        else
+        {
+            std::sort(entries.begin(), entries.end(),
+                      [](const Batch::Entry &x, const Batch::Entry &y) { return x.sequence < y.sequence; });
+        }
+
+        // Write the first occurrence of each pair, duplicates are adjacent when ordered by hash.
+        RunWriter writer{runPath};
+        if (!writer.isOpen()) { return false; }
+        const Batch::Entry *previous{nullptr};
+        for (const auto &entry : entries)
+        {
+            if (previous && (RunOrder::Hash == myOrder) && (entry.hash == previous->hash) &&
+                (batch.primary(entry) == batch.primary(*previous)) && (batch.target(entry) == batch.target(*previous)))
+            {
+                continue;
+            }
+            writer.write(entry.hash, entry.sequence, batch.primary(entry), batch.target(entry));
+            previous = &entry;
+        }
+        return writer.close();
+    }
+
+    /** The order of the pairs in the runs. */
+    RunOrder myOrder;
+
+    /** The maximum number of batches written at once. */
+    std::size_t myThreadCount;
+
+    /** Threads writing batches, oldest first. */
+    std::deque<std::thread> myWorkers;
+
+    /** Indicate whether writing a run failed. */
+    std::atomic<bool> myFailed;
+};
+
+/**
+ * @brief Filter passing the first of adjacent equal phrase pairs read from runs ordered by hash.
+ */
+class FirstOccurrence final
+{
+public:
+    /** @brief Check if a pair differs from the previous one. */
+    bool operator()(const Record &record)
+    {
+        if (!myFirst && (record.hash == myPrevious.hash) && (record.primary == myPrevious.primary) &&
+            (record.target == myPrevious.target))
+        {
+            return false;
+        }
+        myPrevious = record;
+        myFirst    = false;
+        return true;
+    }
+
+private:
+    /** The previous pair. */
+    Record myPrevious{};
+
+    /** Indicate whether no pair has been passed yet. */
+    bool myFirst{true};
+};
+
+// ---------------------------------------------------------------------------
+std::uint64_t hashPair(const std::string_view primary, const std::string_view target) noexcept
+{
+    const auto primaryHash{static_cast<std::uint64_t>(std::hash<std::string_view>{}(primary))};
+    const auto targetHash{static_cast<std::uint64_t>(std::hash<std::string_view>{}(target))};
+    return primaryHash ^ (targetHash + 0x9e3779b97f4a7c15ULL + (primaryHash << 6U) + (primaryHash >> 2U));
+}
+
+// ---------------------------------------------------------------------------
+bool less(const RunOrder order, const Record &x, const Record &y) noexcept
+{
+    if (RunOrder::Sequence == order) { return x.sequence < y.sequence; }
+    return std::tie(x.hash, x.primary, x.target, x.sequence) < std::tie(y.hash, y.primary, y.target, y.sequence);
+}
+
+// ---------------------------------------------------------------------------
+template <typename Sink>
+bool mergeRuns(const std::vector<std::string> &runPaths, const RunOrder order, Sink &&sink)
+{
+    // Merge the runs with a heap holding the index of each run with remaining pairs.
+    std::vector<std::unique_ptr<RunReader>> readers{};
+    std::vector<Record> records(runPaths.size());
+    auto greater = [&records, order](const std::size_t x, const std::size_t y)
+    {
+        return less(order, records[y], records[x]);
+    };
+    std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(greater)> heap{greater};
+
+    for (std::size_t i{}; i < runPaths.size(); ++i)
+    {
+        readers.push_back(std::make_unique<RunReader>(runPaths[i]));
+        if (readers.back()->next(records[i])) { heap.push(i); }
+    }
+    while (!heap.empty())
+    {
+        const auto i{heap.top()};
+        heap.pop();
+        sink(records[i]);
+        if (readers[i]->next(records[i])) { heap.push(i); }
+    }
+    return std::none_of(readers.begin(), readers.end(), [](const auto &reader) { return reader->failed(); });
+}
+
+// ---------------------------------------------------------------------------
+template <typename Sink>
+bool mergeGroups(std::vector<std::string> &runPaths, const RunOrder order,
+                 const std::function<std::string()> &nextRunPath, Sink &&sink)
+{
+    // Merge runs in groups until they can be merged at once, passing each group through the sink.
+    while (CorpusMerge::kMaxMergeWidth < runPaths.size())
+    {
+        std::vector<std::string> mergedPaths{};
+        for (std::size_t i{}; i < runPaths.size(); i += CorpusMerge::kMaxMergeWidth)
+        {
+            const auto last{std::min(i + CorpusMerge::kMaxMergeWidth, runPaths.size())};
+            const std::vector<std::string> group{runPaths.begin() + static_cast<std::ptrdiff_t>(i),
+                                                 runPaths.begin() + static_cast<std::ptrdiff_t>(last)};
+            mergedPaths.push_back(nextRunPath());
+            RunWriter writer{mergedPaths.back()};
+            auto groupSink{sink};
+            const auto read{mergeRuns(group, order, [&writer, &groupSink](const Record &record)
+            {
+                if (groupSink(record)) { writer.write(record); }
+            })};
+            const auto written{writer.close()};
+            removeRuns(group);
+            if (!read || !written) { return false; }
+        }
+        runPaths = std::move(mergedPaths);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+void removeRuns(const std::vector<std::string> &runPaths) noexcept
+{
+    std::error_code error{};
+    for (const auto &runPath : runPaths) { std::filesystem::remove(runPath, error); }
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+CorpusMerge::CorpusMerge(const std::size_t memoryBudget, const std::size_t threadCount,
+                         const std::string &tempDirectory)
+    : myMemoryBudget{std::max<std::size_t>(memoryBudget, 1024U * 1024U)}
+    , myThreadCount{std::max<std::size_t>(0U != threadCount ? threadCount : std::thread::hardware_concurrency(), 1U)}
+    , myTempDirectory{tempDirectory.empty() ? std::filesystem::temp_directory_path() : std::filesystem::path{tempDirectory}}
+    , myRunDirectory{}
+    , myRunCount{}
+    , myPhraseCount{}
+    , myUniquePhraseCount{}
+{}
+
+// ---------------------------------------------------------------------------
+CorpusMerge::~CorpusMerge() noexcept
+{
+    std::error_code error{};
+    if (!myRunDirectory.empty()) { std::filesystem::remove_all(myRunDirectory, error); }
+}
+
+// ---------------------------------------------------------------------------
+bool CorpusMerge::merge(const std::vector<std::string> &inputPaths, const std::string &outputPath,
+                        const bool skipHeaders)
+{
+    myRunCount          = 0U;
+    myPhraseCount       = 0U;
+    myUniquePhraseCount = 0U;
+    if (!createRunDirectory())
+    {
+        std::cerr << "\nCannot create directory for runs in \"" << myTempDirectory.string() << "\"!\n\n";
+        return false;
+    }
+
+    // Pass 1: spill runs ordered by hash, then merge them keeping the first occurrences.
+    // Pass 2: merge the runs ordered by first occurrence into the output file.
+    std::vector<std::string> runPaths{};
+    const auto success{generateRuns(inputPaths, skipHeaders, runPaths) && removeDuplicates(runPaths) &&
+                       writeOutput(runPaths, outputPath)};
+    std::error_code error{};
+    std::filesystem::remove_all(myRunDirectory, error);
+    myRunDirectory.clear();
+    return success;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t CorpusMerge::phraseCount() const noexcept { return myPhraseCount; }
+
+// ---------------------------------------------------------------------------
+std::size_t CorpusMerge::uniquePhraseCount() const noexcept { return myUniquePhraseCount; }
+
+// ---------------------------------------------------------------------------
+std::size_t CorpusMerge::runCount() const noexcept { return myRunCount; }
+
+// ---------------------------------------------------------------------------
+bool CorpusMerge::createRunDirectory()
+{
+    // Create a directory with a random name, so that concurrent merges don't interfere.
+    std::random_device random{};
+    std::error_code error{};
+    for (std::size_t attempt{}; attempt < 16U; ++attempt)
+    {
+        const auto path{myTempDirectory / ("corpus_merge_" + std::to_string(random()))};
+        if (std::filesystem::create_directory(path, error))
+        {
+            myRunDirectory = path;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+bool CorpusMerge::generateRuns(const std::vector<std::string> &inputPaths, const bool skipHeaders,
+                               std::vector<std::string> &runPaths)
+{
+    // Fill batches while earlier batches are sorted, each batch gets an equal share of memory.
+    const auto batchCapacity{myMemoryBudget / (myThreadCount + 1U)};
+    RunSpiller spiller{RunOrder::Hash, myThreadCount};
+    auto batch{std::make_unique<Batch>(batchCapacity)};
+
+    auto add = [&](const std::string_view primary, const std::string_view target)
+    {
+        if (!batch->fits(primary.size() + target.size()) && !batch->empty())
+        {
+            runPaths.push_back(nextRunPath());
+            spiller.spill(std::move(batch), runPaths.back());
+            batch = std::make_unique<Batch>(batchCapacity);
+        }
+        batch->add(hashPair(primary, target), myPhraseCount++, primary, target);
+    };
+
+    for (const auto &inputPath : inputPaths)
+    {
+        // Read pairs like the dictionary does, skip records without text in the first two columns.
+        const auto format{utils::recordFormat(inputPath)};
+        if (utils::RecordFormat::Lines == format)
+        {
+            utils::PhraseReader reader{inputPath};
+            if (!reader.isOpen())
+            {
+                std::cerr << "\nFile \"" << inputPath << "\" wasn't found!\n\n";
+                return false;
+            }
+            Phrase phrase{};
+            while (reader.next(phrase)) { add(phrase.primary, phrase.target); }
+            continue;
+        }
+        utils::RecordReader reader{inputPath, format};
+        if (!reader.isOpen())
+        {
+            std::cerr << "\nFile \"" << inputPath << "\" wasn't found!\n\n";
+            return false;
+        }
+        std::vector<std::string> fields{};
+        if (skipHeaders) { reader.next(fields); }
+        while (reader.next(fields))
+        {
+            if ((2U > fields.size()) || (fields[0U].empty() && fields[1U].empty())) { continue; }
+            add(fields[0U], fields[1U]);
+        }
+    }
+    if (!batch->empty())
+    {
+        runPaths.push_back(nextRunPath());
+        spiller.spill(std::move(batch), runPaths.back());
+    }
+    if (!spiller.wait())
+    {
+        std::cerr << "\nCannot write runs to \"" << myRunDirectory.string() << "\"!\n\n";
+        return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool CorpusMerge::removeDuplicates(std::vector<std::string> &runPaths)
+{
+    // Merge runs in groups until they can be merged at once, duplicates are removed on the way.
+    if (!mergeGroups(runPaths, RunOrder::Hash, [this]() { return nextRunPath(); }, FirstOccurrence{}))
+    {
+        std::cerr << "\nCannot merge runs in \"" << myRunDirectory.string() << "\"!\n\n";
+        return false;
+    }
+
+    // Merge the remaining runs, spill the first occurrences in batches ordered by number.
+    const auto batchCapacity{myMemoryBudget / (myThreadCount + 1U)};
+    RunSpiller spiller{RunOrder::Sequence, myThreadCount};
+    auto batch{std::make_unique<Batch>(batchCapacity)};
+    std::vector<std::string> sequenceRunPaths{};
+    FirstOccurrence firstOccurrence{};
+
+    const auto read{mergeRuns(runPaths, RunOrder::Hash, [&](const Record &record)
+    {
+        if (!firstOccurrence(record)) { return; }
+        if (!batch->fits(record.primary.size() + record.target.size()) && !batch->empty())
+        {
+            sequenceRunPaths.push_back(nextRunPath());
+            spiller.spill(std::move(batch), sequenceRunPaths.back());
+            batch = std::make_unique<Batch>(batchCapacity);
+        }
+        batch->add(record.hash, record.sequence, record.primary, record.target);
+    })};
+    if (!batch->empty())
+    {
+        sequenceRunPaths.push_back(nextRunPath());
+        spiller.spill(std::move(batch), sequenceRunPaths.back());
+    }
+    const auto written{spiller.wait()};
+    removeRuns(runPaths);
+    runPaths = std::move(sequenceRunPaths);
+    if (!read || !written)
+    {
+        std::cerr << "\nCannot merge runs in \"" << myRunDirectory.string() << "\"!\n\n";
+        return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool CorpusMerge::writeOutput(std::vector<std::string> &runPaths, const std::string &outputPath)
+{
+    // Merge runs in groups until they can be merged at once.
+    if (!mergeGroups(runPaths, RunOrder::Sequence, [this]() { return nextRunPath(); },
+                     [](const Record &) { return true; }))
+    {
+        std::cerr << "\nCannot merge runs in \"" << myRunDirectory.string() << "\"!\n\n";
+        return false;
+    }
+
+    // Write each pair on consecutive lines, followed by an additional blank line.
+    std::ofstream ofstream{outputPath, std::ios::binary};
+    if (!ofstream)
+    {
+        std::cerr << "\nCannot write to file \"" << outputPath << "\"!\n\n";
+        return false;
+    }
+    auto read{false};
+    {
+        utils::Output output{ofstream, 1024U * 1024U};
+        read = mergeRuns(runPaths, RunOrder::Sequence, [this, &output](const Record &record)
+        {
+            output << record.primary << '\n' << record.target << "\n\n";
+            ++myUniquePhraseCount;
+        });
+    }
+    removeRuns(runPaths);
+    if (!read)
+    {
+        std::cerr << "\nCannot merge runs in \"" << myRunDirectory.string() << "\"!\n\n";
+        return false;
+    }
+    return static_cast<bool>(ofstream.flush());
+}
+
+// ---------------------------------------------------------------------------
+std::string CorpusMerge::nextRunPath()
+{
+    return (myRunDirectory / ("run" + std::to_string(myRunCount++))).string();
+}
+} // namespace dictionary
+} // namespace language
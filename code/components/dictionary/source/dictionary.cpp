@@ -4,11 +4,17 @@
 #include <chrono>
 #include <iostream>
 #include <list>
-#include <thread>
+#include <memory>
+#include <vector>
 
 #include "dictionary/adapter.h"
+#include "dictionary/corpus.h"
 #include "dictionary/dictionary.h"
+#include "dictionary/tokenized_corpus.h"
+#include "utils/output.h"
 #include "utils/phrase.h"
+#include "utils/scheduler.h"
+#include "utils/utils.h"
 
 namespace language
 {
@@ -17,6 +23,24 @@ namespace dictionary
 /** Dictionary adapter implementation. */
 class AdapterInterface;
 
+namespace
+{
+/** Block size in bytes used when exporting phrases. */
+constexpr std::size_t kExportBlockSize{1024U * 1024U};
+
+// ---------------------------------------------------------------------------
+void writeText(utils::Output &output, const TokenizedCorpus &phrases, const std::size_t index, 
+               const std::size_t column)
+{
+    const auto tokens{phrases.tokens(index, column)};
+    for (std::size_t i{}; i < tokens.size(); ++i)
+    {
+        if (0U < i) { output << ' '; }
+        output << phrases.vocabulary().word(tokens[i]);
+    }
+}
+} // namespace
+
 // ---------------------------------------------------------------------------
 Dictionary::Dictionary(AdapterInterface &adapter)
     : myAdapter{adapter}
@@ -26,7 +50,25 @@ Dictionary::Dictionary(AdapterInterface &adapter)
 const std::list<Phrase>& Dictionary::phrases() const noexcept { return myAdapter.phrases(); }
 
 // ---------------------------------------------------------------------------
-std::size_t Dictionary::phraseCount() const noexcept { return myAdapter.phrases().size(); }
+Phrase Dictionary::phrase(const std::size_t index) const { return myAdapter.phrase(index); }
+
+// ---------------------------------------------------------------------------
+bool Dictionary::phrases(const std::size_t first, const std::size_t count, std::vector<Phrase>& phrases) const
+{
+    return myAdapter.phrases(first, count, phrases);
+}
+
+// ---------------------------------------------------------------------------
+const TokenizedCorpus* Dictionary::tokenizedPhrases() const noexcept 
+{ 
+    return myAdapter.tokenizedPhrases(); 
+}
+
+// ---------------------------------------------------------------------------
+const Corpus* Dictionary::corpus() const noexcept { return myAdapter.corpus(); }
+
+// ---------------------------------------------------------------------------
+std::size_t Dictionary::phraseCount() const noexcept { return myAdapter.phraseCount(); }
 
 // ---------------------------------------------------------------------------
 std::size_t Dictionary::phraseCountToUse() const noexcept { return myAdapter.phraseCountToUse(); }
@@ -35,20 +77,83 @@ std::size_t Dictionary::phraseCountToUse() const noexcept { return myAdapter.phr
 std::size_t Dictionary::printIntervalMs() const noexcept { return myAdapter.printIntervalMs(); }
 
 // ---------------------------------------------------------------------------
-bool Dictionary::empty() const noexcept { return myAdapter.phrases().empty(); }
+bool Dictionary::empty() const noexcept { return 0U == myAdapter.phraseCount(); }
+
+// ---------------------------------------------------------------------------
+bool Dictionary::failed() const noexcept { return myAdapter.failed(); }
 
 // ---------------------------------------------------------------------------
 void Dictionary::print(std::ostream& ostream) const
 {
-    std::size_t printedPhrases{};
+    if (0U == printIntervalMs()) { exportPhrases(ostream); }
+    else { schedulePrint(ostream)->wait(); }
+}
+
+// ---------------------------------------------------------------------------
+std::unique_ptr<utils::Scheduler> Dictionary::schedulePrint(std::ostream& ostream) const
+{
+    const auto phrasesToPrint{utils::min<std::size_t>(phraseCountToUse(), phraseCount())};
+    auto output{std::make_shared<utils::Output>(ostream)};
+
+    auto printNextPhrase = [this, index{std::size_t{}}, phrasesToPrint, output]() mutable
+    {
+        if (phrasesToPrint <= index) { return false; }
+
+        // Write each pair in one go before waiting for the next one.
+        const auto phrase{myAdapter.phrase(index)};
+        *output << phrase.primary << "\n" << phrase.target << "\n\n";
+        output->flush();
+        return phrasesToPrint != ++index;
+    };
+    auto scheduler{std::make_unique<utils::Scheduler>(
+        std::chrono::milliseconds{printIntervalMs()}, printNextPhrase)};
+    scheduler->start();
+    return scheduler;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t Dictionary::exportPhrases(std::ostream& ostream) const
+{
+    utils::Output output{ostream, kExportBlockSize};
+    const auto phrasesToExport{utils::min<std::size_t>(phraseCountToUse(), phraseCount())};
 
-    for (const auto &phrase : myAdapter.phrases())
+    // Write corpus entries straight from the selected columns.
+    if (const auto *corpus{myAdapter.corpus()})
+    {
+        const auto primaryColumn{myAdapter.primaryColumn()};
+        const auto targetColumn{myAdapter.targetColumn()};
+        for (std::size_t i{}; i < phrasesToExport; ++i)
+        {
+            output << corpus->text(i, primaryColumn) << "\n" << corpus->text(i, targetColumn) << "\n\n";
+        }
+    }
+    // Write tokenized phrases word by word, without rebuilding the text.
+    else if (const auto *tokenizedPhrases{myAdapter.tokenizedPhrases()})
+    {
+        for (std::size_t i{}; i < phrasesToExport; ++i)
+        {
+            writeText(output, *tokenizedPhrases, i, TokenizedCorpus::kPrimaryColumn);
+            output << '\n';
+            writeText(output, *tokenizedPhrases, i, TokenizedCorpus::kTargetColumn);
+            output << "\n\n";
+        }
+    }
+    else
     {
-        if (phraseCountToUse() <= printedPhrases++) { break; }
-        ostream << phrase.primary << "\n";
-        ostream << phrase.target << "\n\n";
-        std::this_thread::sleep_for(std::chrono::milliseconds(printIntervalMs()));
+        std::vector<Phrase> phrases{};
+        for (std::size_t first{}; first < phrasesToExport; first += kPhraseBlockSize)
+        {
+            phrases.clear();
+            const auto count{utils::min(kPhraseBlockSize, phrasesToExport - first)};
+            if (!myAdapter.phrases(first, count, phrases)) { return first; }
+            for (const auto &phrase : phrases) 
+            { 
+                output << phrase.primary << "\n" << phrase.target << "\n\n"; 
+            }
+        }
     }
+    output.flush();
+    return phrasesToExport;
 }
 } // namespace dictionary
 } // namespace language
\ No newline at end of file
@@ -0,0 +1,171 @@
+/**
+ * @brief Implementation details of class language::dictionary::EmbeddedAdapter.
+ */
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "dictionary/embedded_adapter.h"
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace dictionary
+{
+namespace
+{
+// ---------------------------------------------------------------------------
+void writeLiteral(std::ostream &ostream, const std::string &text)
+{
+    // Escape control characters as octal, which never runs into the next character.
+    // Question marks are escaped to rule out trigraphs, other bytes are written unchanged.
+    static constexpr char kDigits[]{"01234567"};
+    ostream << "{\"";
+
+    for (const auto c : text)
+    {
+        const auto byte{static_cast<unsigned char>(c)};
+        if (('\\' == c) || ('"' == c) || ('?' == c)) { ostream << '\\' << c; }
+        else if ((0x20U > byte) || (0x7FU == byte))
+        {
+            ostream << '\\' << kDigits[byte >> 6U] << kDigits[(byte >> 3U) & 7U] << kDigits[byte & 7U];
+        }
+        else { ostream << c; }
+    }
+    ostream << "\", " << text.size() << "U}";
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+EmbeddedAdapter::EmbeddedAdapter(const EmbeddedPhrase *phrases, const std::size_t phraseCount,
+                                 const std::size_t phraseCountToUse) noexcept
+    : myPhrases{phrases}
+    , myPhraseCount{phraseCount}
+    , myPhraseCountToUse{(0U != phraseCountToUse) ? phraseCountToUse : phraseCount}
+    , myPrintIntervalMs{kDefaultPrintIntervalMs}
+    , myPhraseList{}
+    , myPhraseListFlag{}
+{}
+
+// ---------------------------------------------------------------------------
+EmbeddedAdapter::EmbeddedAdapter(const EmbeddedPhrase *phrases, const std::size_t phraseCount,
+                                 const int argc, const char **argv) noexcept
+    : EmbeddedAdapter{phrases, phraseCount}
+{
+    // Scan the arguments in place, utils::Arguments would copy them into strings.
+    bool countFound{false};
+    for (int i{1}; i < argc; ++i)
+    {
+        if (0 == std::strcmp(argv[i], "--no-delay")) { myPrintIntervalMs = 0U; }
+        else if (!countFound && (0 != std::strncmp(argv[i], "--", 2U)))
+        {
+            const auto count{static_cast<std::size_t>(std::strtoul(argv[i], nullptr, 10))};
+            myPhraseCountToUse = (0U != count) ? count : myPhraseCount;
+            countFound = true;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+const std::list<Phrase> &EmbeddedAdapter::phrases() const
+{
+    std::call_once(myPhraseListFlag, [this]()
+    {
+        for (std::size_t i{}; i < myPhraseCount; ++i) { myPhraseList.push_back(phrase(i)); }
+    });
+    return myPhraseList;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t EmbeddedAdapter::phraseCount() const noexcept { return myPhraseCount; }
+
+// ---------------------------------------------------------------------------
+Phrase EmbeddedAdapter::phrase(const std::size_t index) const
+{
+    return Phrase{std::string{myPhrases[index].primary}, std::string{myPhrases[index].target}};
+}
+
+// ---------------------------------------------------------------------------
+bool EmbeddedAdapter::phrases(const std::size_t first, const std::size_t count, std::vector<Phrase> &phrases) const
+{
+    for (auto i{first}; (i < myPhraseCount) && (i - first < count); ++i) { phrases.push_back(phrase(i)); }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool EmbeddedAdapter::failed() const noexcept { return false; }
+
+// ---------------------------------------------------------------------------
+const TokenizedCorpus *EmbeddedAdapter::tokenizedPhrases() const noexcept { return nullptr; }
+
+// ---------------------------------------------------------------------------
+const Corpus *EmbeddedAdapter::corpus() const noexcept { return nullptr; }
+
+// ---------------------------------------------------------------------------
+std::size_t EmbeddedAdapter::primaryColumn() const noexcept { return 0U; }
+
+// ---------------------------------------------------------------------------
+std::size_t EmbeddedAdapter::targetColumn() const noexcept { return 1U; }
+
+// ---------------------------------------------------------------------------
+std::size_t EmbeddedAdapter::phraseCountToUse() const noexcept { return myPhraseCountToUse; }
+
+// ---------------------------------------------------------------------------
+std::size_t EmbeddedAdapter::printIntervalMs() const noexcept { return myPrintIntervalMs; }
+
+// ---------------------------------------------------------------------------
+std::vector<Phrase> embeddablePhrases(const std::vector<std::string> &lines)
+{
+    std::vector<Phrase> phrases{};
+    std::unordered_set<Phrase, PhraseHash> uniquePhrases{};
+    const std::string *primary{nullptr};
+
+    for (const auto &line : lines)
+    {
+        if (line.empty() || ('#' == line.front())) { continue; }
+        if (!primary)
+        {
+            primary = &line;
+            continue;
+        }
+        Phrase phrase{*primary, line};
+        primary = nullptr;
+        if (uniquePhrases.insert(phrase).second) { phrases.push_back(std::move(phrase)); }
+    }
+    return phrases;
+}
+
+// ---------------------------------------------------------------------------
+void writeEmbeddedPhrases(std::ostream &ostream, const std::vector<Phrase> &phrases,
+                          const std::string &source)
+{
+    ostream << "/**\n"
+            << " * @brief Phrases embedded from \"" << source << "\", generated by EmbedCorpus.\n"
+            << " *\n"
+            << " *        Don't edit this file, edit the phrase file and rebuild instead.\n"
+            << " */\n"
+            << "#pragma once\n\n"
+            << "#include \"dictionary/embedded_adapter.h\"\n\n"
+            << "namespace language\n{\nnamespace embedded\n{\n"
+            << "/** Embedded phrases, " << phrases.size() << " pair(s). */\n"
+            << "inline constexpr dictionary::EmbeddedPhrase kPhrases[]{\n";
+
+    for (const auto &phrase : phrases)
+    {
+        ostream << "    {";
+        writeLiteral(ostream, phrase.primary);
+        ostream << ", ";
+        writeLiteral(ostream, phrase.target);
+        ostream << "},\n";
+    }
+    ostream << "};\n} // namespace embedded\n} // namespace language\n";
+}
+} // namespace dictionary
+} // namespace language
@@ -0,0 +1,254 @@
+/**
+ * @brief Implementation details of class language::dictionary::ErrorStatistics.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "dictionary/error_statistics.h"
+#include "utils/metrics.h"
+#include "utils/phrase.h"
+#include "utils/scan.h"
+#include "utils/utf8.h"
+#include "utils/work_stealing_pool.h"
+
+namespace language
+{
+namespace dictionary
+{
+namespace
+{
+/**
+ * @brief Phrase referring to text owned by someone else.
+ */
+struct PhraseView
+{
+    /** Primary language phrase. */
+    std::string_view primary;
+
+    /** Target language phrase. */
+    std::string_view target;
+
+    /** @brief Match this phrase with another phrase. */
+    bool operator==(const PhraseView &other) const noexcept
+    {
+        return (other.primary == primary) && (other.target == target);
+    }
+};
+
+/**
+ * @brief Hash function for phrase views, combining the hashes like PhraseHash.
+ */
+struct PhraseViewHash
+{
+    /** @brief Calculate hash of a phrase view. */
+    std::size_t operator()(const PhraseView &phrase) const noexcept
+    {
+        const auto primaryHash{std::hash<std::string_view>{}(phrase.primary)};
+        const auto targetHash{std::hash<std::string_view>{}(phrase.target)};
+        return primaryHash ^ (targetHash + 0x9e3779b97f4a7c15ULL + (primaryHash << 6U) + (primaryHash >> 2U));
+    }
+};
+
+/**
+ * @brief Misses counted by one thread, with the buffer it reads files into.
+ *
+ *        Phrases are looked up by views into the read buffer, and only copied into the text
+ *        storage when counted for the first time. The storage never moves its strings.
+ */
+struct ThreadCounts
+{
+    /** The number of misses by phrase, referring to the text storage. */
+    std::unordered_map<PhraseView, std::uint64_t, PhraseViewHash> missCounts;
+
+    /** Text of the counted phrases. */
+    std::deque<std::string> texts;
+
+    /** Buffer holding the content of the file being parsed. */
+    std::vector<char> buffer;
+
+    /** The number of scanned files. */
+    std::size_t fileCount{};
+
+    /** The number of misses. */
+    std::uint64_t missCount{};
+
+    /** @brief Count a miss of a phrase. */
+    void add(const PhraseView &phrase)
+    {
+        ++missCount;
+        if (const auto i{missCounts.find(phrase)}; missCounts.end() != i)
+        {
+            ++i->second;
+            return;
+        }
+        const auto &primary{texts.emplace_back(phrase.primary)};
+        const auto &target{texts.emplace_back(phrase.target)};
+        missCounts.emplace(PhraseView{primary, target}, 1U);
+    }
+};
+
+// ---------------------------------------------------------------------------
+bool isErrorFileName(const std::string_view name) noexcept
+{
+    constexpr std::string_view prefix{"errors"}, suffix{".txt"};
+    if ((prefix.size() + suffix.size() >= name.size()) || (0U != name.compare(0U, prefix.size(), prefix)) ||
+        (0U != name.compare(name.size() - suffix.size(), suffix.size(), suffix)))
+    {
+        return false;
+    }
+    const auto number{name.substr(prefix.size(), name.size() - prefix.size() - suffix.size())};
+    return std::all_of(number.begin(), number.end(), [](const char c) { return ('0' <= c) && ('9' >= c); });
+}
+
+// ---------------------------------------------------------------------------
+bool readFile(const int directory, const std::string &name, std::vector<char> &buffer, std::size_t &size)
+{
+    const auto file{::openat(directory, name.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (0 > file) { return false; }
+
+    // Read the whole file with as few calls as possible, the buffer only ever grows.
+    struct stat status{};
+    size = 0U;
+    if (0 == ::fstat(file, &status) && (buffer.size() < static_cast<std::size_t>(status.st_size) + 1U))
+    {
+        buffer.resize(static_cast<std::size_t>(status.st_size) + 1U);
+    }
+    for (ssize_t count{}; 0 < (count = ::read(file, buffer.data() + size, buffer.size() - size)); )
+    {
+        size += static_cast<std::size_t>(count);
+        if (buffer.size() == size) { buffer.resize(2U * buffer.size()); }
+    }
+    ::close(file);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+void parsePhrases(const char *first, const char *const last, ThreadCounts &counts)
+{
+    // Parse like phrase files: trim lines, skip empty lines and pair consecutive lines.
+    first += utils::byteOrderMarkSize(first, last);
+    std::string_view primary{};
+    bool primaryRead{false};
+
+    while (first < last)
+    {
+        const auto *lineEnd{utils::findFirstOf(first, last, "\n")};
+        const std::string_view line{first, static_cast<std::size_t>(utils::trimTrailingWhitespaces(first, lineEnd) - first)};
+        first = (last == lineEnd) ? last : lineEnd + 1;
+        if (line.empty()) { continue; }
+
+        if (primaryRead) { counts.add(PhraseView{primary, line}); }
+        else { primary = line; }
+        primaryRead = !primaryRead;
+    }
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+ErrorStatistics::ErrorStatistics(const std::size_t threadCount)
+    : myThreadCount{threadCount}
+    , myMissCounts{}
+    , myFileCount{}
+    , myMissCount{}
+{}
+
+// ---------------------------------------------------------------------------
+bool ErrorStatistics::scan(const std::string &directory)
+{
+    LANGUAGE_METRICS_TIME("error_scan", "Time spent scanning error files.");
+    const std::unique_ptr<DIR, int (*)(DIR *)> dir{::opendir(directory.c_str()), ::closedir};
+    if (!dir) { return false; }
+
+    // Collect the file names in batches, each batch is scanned by one task.
+    std::vector<std::shared_ptr<std::vector<std::string>>> batches{};
+    while (const auto *entry{::readdir(dir.get())})
+    {
+        if (!isErrorFileName(entry->d_name)) { continue; }
+        if (batches.empty() || (kFilesPerTask == batches.back()->size()))
+        {
+            batches.push_back(std::make_shared<std::vector<std::string>>());
+        }
+        batches.back()->emplace_back(entry->d_name);
+    }
+
+    utils::WorkStealingPool pool{myThreadCount};
+    std::vector<ThreadCounts> threadCounts(pool.threadCount());
+    const auto directoryFile{::dirfd(dir.get())};
+
+    for (const auto &batch : batches)
+    {
+        pool.submit([&threadCounts, directoryFile, batch](const std::size_t thread)
+        {
+            auto &counts{threadCounts[thread]};
+            std::size_t size{};
+            for (const auto &name : *batch)
+            {
+                if (!readFile(directoryFile, name, counts.buffer, size)) { continue; }
+                parsePhrases(counts.buffer.data(), counts.buffer.data() + size, counts);
+                ++counts.fileCount;
+            }
+        });
+    }
+    pool.wait();
+
+    for (const auto &counts : threadCounts)
+    {
+        myFileCount += counts.fileCount;
+        myMissCount += counts.missCount;
+        for (const auto &[phrase, missCount] : counts.missCounts)
+        {
+            myMissCounts[Phrase{std::string{phrase.primary}, std::string{phrase.target}}] += missCount;
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+std::vector<MissedPhrase> ErrorStatistics::hardest(const std::size_t count) const
+{
+    std::vector<MissedPhrase> phrases{};
+    phrases.reserve(myMissCounts.size());
+    for (const auto &[phrase, missCount] : myMissCounts) { phrases.push_back(MissedPhrase{phrase, missCount}); }
+
+    auto harder = [](const MissedPhrase &x, const MissedPhrase &y)
+    {
+        if (x.missCount != y.missCount) { return x.missCount > y.missCount; }
+        if (x.phrase.primary != y.phrase.primary) { return x.phrase.primary < y.phrase.primary; }
+        return x.phrase.target < y.phrase.target;
+    };
+    const auto last{phrases.begin() + static_cast<std::ptrdiff_t>(std::min(count, phrases.size()))};
+    std::partial_sort(phrases.begin(), last, phrases.end(), harder);
+    phrases.erase(last, phrases.end());
+    return phrases;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t ErrorStatistics::fileCount() const noexcept
+{
+    return myFileCount;
+}
+
+// ---------------------------------------------------------------------------
+std::uint64_t ErrorStatistics::missCount() const noexcept
+{
+    return myMissCount;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t ErrorStatistics::phraseCount() const noexcept
+{
+    return myMissCounts.size();
+}
+} // namespace dictionary
+} // namespace language
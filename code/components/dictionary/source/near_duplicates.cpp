@@ -0,0 +1,229 @@
+/**
+ * @brief Implementation details of near-duplicate detection.
+ */
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "dictionary/near_duplicates.h"
+#include "utils/metrics.h"
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace dictionary
+{
+namespace
+{
+/** The number of bands each signature is split into. */
+constexpr std::size_t kBandCount{8U};
+
+/** The number of hash values per band. */
+constexpr std::size_t kRowCount{4U};
+
+/** The number of hash values per signature. */
+constexpr std::size_t kSignatureSize{kBandCount * kRowCount};
+
+/** The maximum number of phrases per bucket to verify new candidates against. */
+constexpr std::size_t kMaxBucketSize{8U};
+
+/** MinHash signature of a phrase. */
+using Signature = std::array<std::uint32_t, kSignatureSize>;
+
+// ---------------------------------------------------------------------------
+std::uint64_t mix(std::uint64_t x) noexcept
+{
+    // Finalizer of SplitMix64.
+    x ^= x >> 30U;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27U;
+    x *= 0x94d049bb133111ebULL;
+    return x ^ (x >> 31U);
+}
+
+// ---------------------------------------------------------------------------
+void normalize(const std::string &text, std::string &normalized)
+{
+    // Keep lowercase letters, digits and non-ASCII bytes, separate words by a single space.
+    for (const auto c : text)
+    {
+        const auto byte{static_cast<unsigned char>(c)};
+
+        if ((('a' <= byte) && ('z' >= byte)) || (('0' <= byte) && ('9' >= byte)) || (0x80U <= byte))
+        {
+            normalized.push_back(c);
+        }
+        else if (('A' <= byte) && ('Z' >= byte)) { normalized.push_back(static_cast<char>(c + 32)); }
+        else if (!normalized.empty() && (' ' != normalized.back())) { normalized.push_back(' '); }
+    }
+    if (!normalized.empty() && (' ' == normalized.back())) { normalized.pop_back(); }
+}
+
+// ---------------------------------------------------------------------------
+Signature signature(const Phrase &phrase, std::string &normalized)
+{
+    normalized.clear();
+    normalize(phrase.primary, normalized);
+    normalized.push_back('\n');
+    normalize(phrase.target, normalized);
+
+    Signature signature{};
+    signature.fill(UINT32_MAX);
+
+    // Hash each character trigram, derive the hash functions by double hashing.
+    for (std::size_t i{}; i + 3U <= std::max<std::size_t>(normalized.size(), 3U); ++i)
+    {
+        std::uint64_t shingle{};
+        for (std::size_t j{i}; j < std::min(i + 3U, normalized.size()); ++j) 
+        { 
+            shingle = (shingle << 8U) | static_cast<unsigned char>(normalized[j]); 
+        }
+        const auto h1{mix(shingle)};
+        const auto h2{mix(h1) | 1U};
+
+        for (std::size_t k{}; k < kSignatureSize; ++k)
+        {
+            const auto value{static_cast<std::uint32_t>((h1 + k * h2) >> 32U)};
+            signature[k] = std::min(signature[k], value);
+        }
+    }
+    return signature;
+}
+
+// ---------------------------------------------------------------------------
+double similarity(const Signature &x, const Signature &y) noexcept
+{
+    std::size_t matches{};
+    for (std::size_t i{}; i < kSignatureSize; ++i) { matches += x[i] == y[i] ? 1U : 0U; }
+    return static_cast<double>(matches) / kSignatureSize;
+}
+
+// ---------------------------------------------------------------------------
+std::uint64_t bandHash(const Signature &signature, const std::size_t band) noexcept
+{
+    std::uint64_t hash{band};
+    for (std::size_t i{band * kRowCount}; i < (band + 1U) * kRowCount; ++i) 
+    { 
+        hash = mix(hash ^ signature[i]); 
+    }
+    return hash;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t root(std::vector<std::size_t> &parents, std::size_t i) noexcept
+{
+    while (parents[i] != i)
+    {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+    return i;
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+std::vector<Cluster> findNearDuplicates(const std::list<Phrase> &phrases, const double threshold, 
+                                        const std::size_t threadCount)
+{
+    const std::vector<const Phrase *> phrasePtrs{[&phrases]()
+    {
+        std::vector<const Phrase *> ptrs{};
+        ptrs.reserve(phrases.size());
+        for (const auto &phrase : phrases) { ptrs.push_back(&phrase); }
+        return ptrs;
+    }()};
+    const auto n{phrasePtrs.size()};
+    std::vector<Signature> signatures(n);
+
+    // Calculate the signatures on multiple threads, each thread handles a contiguous range.
+    const auto threads{std::min(std::max<std::size_t>(
+        0U != threadCount ? threadCount : std::thread::hardware_concurrency(), 1U), n / 1024U + 1U)};
+    auto calculateSignatures = [&](const std::size_t first, const std::size_t last)
+    {
+        LANGUAGE_METRICS_TIME("signatures", "Time spent calculating near-duplicate signatures.");
+        std::string normalized{};
+        for (auto i{first}; i < last; ++i) { signatures[i] = signature(*phrasePtrs[i], normalized); }
+    };
+    std::vector<std::thread> workers{};
+    for (std::size_t t{1U}; t < threads; ++t) 
+    { 
+        workers.emplace_back(calculateSignatures, n * t / threads, n * (t + 1U) / threads); 
+    }
+    calculateSignatures(0U, n / threads);
+    for (auto &worker : workers) { worker.join(); }
+
+    // Verify phrases sharing a band against the first phrases of the bucket, union matches.
+    std::vector<std::size_t> parents(n);
+    std::iota(parents.begin(), parents.end(), 0U);
+
+    for (std::size_t band{}; band < kBandCount; ++band)
+    {
+        std::unordered_map<std::uint64_t, std::vector<std::size_t>> buckets{};
+        buckets.reserve(n);
+
+        for (std::size_t i{}; i < n; ++i)
+        {
+            auto &bucket{buckets[bandHash(signatures[i], band)]};
+
+            for (const auto j : bucket)
+            {
+                if ((root(parents, i) != root(parents, j)) && 
+                    (threshold <= similarity(signatures[i], signatures[j])))
+                {
+                    parents[root(parents, i)] = root(parents, j);
+                }
+            }
+            if (kMaxBucketSize > bucket.size()) { bucket.push_back(i); }
+        }
+    }
+
+    // Collect clusters with at least two phrases, ordered by their first phrase.
+    std::unordered_map<std::size_t, std::size_t> clusterIndexes{};
+    std::vector<Cluster> clusters{};
+
+    for (std::size_t i{}; i < n; ++i)
+    {
+        const auto r{root(parents, i)};
+        const auto clusterIndex{clusterIndexes.emplace(r, clusters.size())};
+        if (clusterIndex.second) { clusters.emplace_back(); }
+        clusters[clusterIndex.first->second].push_back(i);
+    }
+    clusters.erase(std::remove_if(clusters.begin(), clusters.end(), 
+        [](const Cluster &cluster) { return 2U > cluster.size(); }), clusters.end());
+    return clusters;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t mergeNearDuplicates(std::list<Phrase> &phrases, const std::vector<Cluster> &clusters)
+{
+    std::vector<bool> removed(phrases.size());
+    std::size_t removedCount{};
+
+    for (const auto &cluster : clusters)
+    {
+        for (auto i{std::next(cluster.begin())}; i != cluster.end(); ++i) 
+        { 
+            if ((*i < removed.size()) && !removed[*i]) 
+            { 
+                removed[*i] = true; 
+                ++removedCount;
+            }
+        }
+    }
+    std::size_t index{};
+
+    for (auto phrase{phrases.begin()}; phrase != phrases.end(); ++index)
+    {
+        phrase = removed[index] ? phrases.erase(phrase) : std::next(phrase);
+    }
+    return removedCount;
+}
+} // namespace dictionary
+} // namespace language
@@ -0,0 +1,220 @@
+/**
+ * @brief Implementation details of the shard workers.
+ */
+#include <cerrno>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "dictionary/tokenized_corpus.h"
+#include "shard_worker.h"
+#include "utils/binary_encoding.h"
+#include "utils/phrase.h"
+#include "utils/utils.h"
+
+namespace language
+{
+namespace dictionary
+{
+namespace
+{
+/** Size of the size prefix of each message in bytes. */
+constexpr std::size_t kSizeBytes{sizeof(std::uint64_t)};
+
+/**
+ * @brief Hash function for phrases referred to by pointer.
+ */
+struct PhrasePointerHash
+{
+    /** @brief Calculate hash of the phrase. */
+    std::size_t operator()(const Phrase *phrase) const noexcept { return PhraseHash{}(*phrase); }
+};
+
+/**
+ * @brief Comparison function for phrases referred to by pointer.
+ */
+struct PhrasePointerEqual
+{
+    /** @brief Check if the phrases are equal. */
+    bool operator()(const Phrase *x, const Phrase *y) const noexcept { return *x == *y; }
+};
+
+/**
+ * @brief Phrases of one shard, stored like in the file-based adapter.
+ */
+class ShardStore final
+{
+public:
+    /** @brief Add phrase unless the shard already holds it. */
+    void add(Phrase &&phrase)
+    {
+        // List nodes are never moved, so the set can refer to the phrases stored in the list.
+        myPhrases.push_back(std::move(phrase));
+        if (!myUniquePhrases.insert(&myPhrases.back()).second) { myPhrases.pop_back(); }
+    }
+
+    /** @brief Index the phrases or store them as token IDs, once all phrases were added. */
+    void seal(const bool tokenize)
+    {
+        myUniquePhrases = {};
+        if (!tokenize)
+        {
+            myPhraseIndex.reserve(myPhrases.size());
+            for (const auto &phrase : myPhrases) { myPhraseIndex.push_back(&phrase); }
+            return;
+        }
+
+        // Release the text representation while tokenizing, like the file-based adapter.
+        myTokenizedPhrases = std::make_unique<TokenizedCorpus>();
+        while (!myPhrases.empty())
+        {
+            myTokenizedPhrases->add(myPhrases.front());
+            myPhrases.pop_front();
+        }
+    }
+
+    /** @brief Get the number of phrases, once sealed. */
+    std::size_t size() const noexcept
+    {
+        return myTokenizedPhrases ? myTokenizedPhrases->size() : myPhraseIndex.size();
+    }
+
+    /** @brief Get the phrase at given index, once sealed. */
+    Phrase phrase(const std::size_t index) const
+    {
+        return myTokenizedPhrases ? myTokenizedPhrases->phrase(index) : *myPhraseIndex[index];
+    }
+
+private:
+    /** Phrases of the shard, empty once the phrases have been tokenized. */
+    std::list<Phrase> myPhrases;
+
+    /** Pointers to the phrases in the list while adding, to skip duplicates. */
+    std::unordered_set<const Phrase *, PhrasePointerHash, PhrasePointerEqual> myUniquePhrases;
+
+    /** Pointers to the phrases in the list, for access by index. */
+    std::vector<const Phrase *> myPhraseIndex;
+
+    /** Phrases stored as token IDs if requested, else nullptr. */
+    std::unique_ptr<TokenizedCorpus> myTokenizedPhrases;
+};
+
+// ---------------------------------------------------------------------------
+bool sendAll(const int socket, const char *data, std::size_t size)
+{
+    while (0U != size)
+    {
+        // Don't raise SIGPIPE if the other process has ended, report the failure instead.
+        const auto sent{::send(socket, data, size, MSG_NOSIGNAL)};
+        if (0 > sent)
+        {
+            if (EINTR == errno) { continue; }
+            return false;
+        }
+        data += sent;
+        size -= static_cast<std::size_t>(sent);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool receiveAll(const int socket, char *data, std::size_t size)
+{
+    while (0U != size)
+    {
+        const auto received{::recv(socket, data, size, 0)};
+        if (0 == received) { return false; }
+        if (0 > received)
+        {
+            if (EINTR == errno) { continue; }
+            return false;
+        }
+        data += received;
+        size -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+bool sendMessage(const int socket, const std::string &message)
+{
+    std::string size{};
+    utils::encodeFixed(message.size(), size);
+    return sendAll(socket, size.data(), size.size()) && sendAll(socket, message.data(), message.size());
+}
+
+// ---------------------------------------------------------------------------
+bool receiveMessage(const int socket, std::string &message)
+{
+    char prefix[kSizeBytes]{};
+    std::uint64_t size{};
+    if (!receiveAll(socket, prefix, kSizeBytes) || !utils::Decoder{prefix, prefix + kSizeBytes}.fixed(size))
+    {
+        return false;
+    }
+    message.resize(static_cast<std::size_t>(size));
+    return receiveAll(socket, message.data(), message.size());
+}
+
+// ---------------------------------------------------------------------------
+int runShardWorker(const int socket, const bool tokenize)
+{
+    ShardStore store{};
+    std::string message{};
+    std::string reply{};
+    Phrase phrase{};
+
+    while (receiveMessage(socket, message) && !message.empty())
+    {
+        utils::Decoder decoder{message.data() + 1, message.data() + message.size()};
+        const auto type{static_cast<ShardMessage>(message.front())};
+
+        // Phrases are added without reply, so that the coordinator streams the file.
+        if (ShardMessage::Add == type)
+        {
+            while (!decoder.done())
+            {
+                if (!decoder.text(phrase.primary) || !decoder.text(phrase.target)) { return 1; }
+                store.add(std::move(phrase));
+            }
+            continue;
+        }
+
+        reply.assign(1U, static_cast<char>(ShardMessage::Reply));
+        if (ShardMessage::Seal == type)
+        {
+            store.seal(tokenize);
+            utils::encodeVarint(store.size(), reply);
+        }
+        else if (ShardMessage::Get == type)
+        {
+            std::uint64_t first{};
+            std::uint64_t count{};
+            if (!decoder.varint(first) || !decoder.varint(count)) { return 1; }
+
+            // Requests past the end of the shard are cut, the reply holds the actual count.
+            first = utils::min<std::uint64_t>(first, store.size());
+            count = utils::min<std::uint64_t>(count, store.size() - first);
+            utils::encodeVarint(count, reply);
+            for (auto i{first}; i < first + count; ++i)
+            {
+                const auto stored{store.phrase(static_cast<std::size_t>(i))};
+                utils::encodeText(stored.primary, reply);
+                utils::encodeText(stored.target, reply);
+            }
+        }
+        else { return 1; }
+        if (!sendMessage(socket, reply)) { return 1; }
+    }
+    ::close(socket);
+    return 0;
+}
+} // namespace dictionary
+} // namespace language
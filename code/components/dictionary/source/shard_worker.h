@@ -0,0 +1,67 @@
+/**
+ * @brief Worker processes owning the shards of a sharded dictionary.
+ */
+#pragma once
+
+#include <string>
+
+namespace language
+{
+namespace dictionary
+{
+/**
+ * @brief Enumeration of the messages exchanged between the coordinator and the shard workers.
+ *
+ *        Each message starts with its type, followed by variable-length integers and texts.
+ */
+enum class ShardMessage : unsigned char
+{
+    /** Phrases to add to the shard, as primary and target text of each phrase. */
+    Add,
+
+    /** End of the phrases, the worker indexes its phrases by position and replies with their count. */
+    Seal,
+
+    /** Request of the phrases from a first index, followed by the index and the phrase count. */
+    Get,
+
+    /** Reply of the worker, followed by a count and as many phrases for requests of phrases. */
+    Reply,
+};
+
+/**
+ * @brief Send a message over a socket, prefixed by its size.
+ *
+ * @param[in] socket The socket to send to.
+ * @param[in] message The message to send.
+ *
+ * @return True if the message was sent, false if the socket was closed or failed.
+ */
+bool sendMessage(int socket, const std::string &message);
+
+/**
+ * @brief Receive a message sent with sendMessage, blocking until it is complete.
+ *
+ * @param[in] socket The socket to receive from.
+ * @param[out] message The received message.
+ *
+ * @return True if a message was received, false if the socket was closed or failed.
+ */
+bool receiveMessage(int socket, std::string &message);
+
+/**
+ * @brief Run a shard worker until the coordinator closes the socket.
+ *
+ *        The worker stores the phrases it receives without duplicates, as a list indexed like
+ *        in the file-based adapter or as token IDs, and serves requests for its phrases. It
+ *        runs in the spawned worker executable, so it neither records metrics nor writes to 
+ *        the terminal.
+ *
+ * @param[in] socket The socket connected to the coordinator, owned by the worker.
+ * @param[in] tokenize Store the phrases as token IDs.
+ *
+ * @return The exit status of the worker process, 0 after the coordinator closed the socket.
+ */
+int runShardWorker(int socket, bool tokenize);
+} // namespace dictionary
+} // namespace language
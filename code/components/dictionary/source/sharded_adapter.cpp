@@ -0,0 +1,74 @@
+/**
+ * @brief Implementation details of class language::dictionary::ShardedAdapter.
+ */
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dictionary/sharded_adapter.h"
+#include "sharded_adapter_impl.h"
+
+namespace language
+{
+namespace dictionary
+{
+// ---------------------------------------------------------------------------
+ShardedAdapter::ShardedAdapter(const std::string &filePath, const std::size_t shardCount)
+    : myImpl{std::make_unique<ShardedAdapterImpl>(filePath, shardCount)}
+{}
+
+// ---------------------------------------------------------------------------
+ShardedAdapter::ShardedAdapter(const int argc, const char **argv)
+    : myImpl{std::make_unique<ShardedAdapterImpl>(argc, argv)}
+{}
+
+// ---------------------------------------------------------------------------
+ShardedAdapter::~ShardedAdapter() noexcept = default;
+
+// ---------------------------------------------------------------------------
+const std::list<Phrase> &ShardedAdapter::phrases() const { return myImpl->phrases(); }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapter::phraseCount() const noexcept { return myImpl->phraseCount(); }
+
+// ---------------------------------------------------------------------------
+Phrase ShardedAdapter::phrase(const std::size_t index) const { return myImpl->phrase(index); }
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapter::phrases(const std::size_t first, const std::size_t count, std::vector<Phrase> &phrases) const
+{
+    return myImpl->phrases(first, count, phrases);
+}
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapter::failed() const noexcept { return myImpl->failed(); }
+
+// ---------------------------------------------------------------------------
+const TokenizedCorpus *ShardedAdapter::tokenizedPhrases() const noexcept { return nullptr; }
+
+// ---------------------------------------------------------------------------
+const Corpus *ShardedAdapter::corpus() const noexcept { return nullptr; }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapter::primaryColumn() const noexcept { return 0U; }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapter::targetColumn() const noexcept { return 1U; }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapter::phraseCountToUse() const noexcept { return myImpl->phraseCountToUse(); }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapter::printIntervalMs() const noexcept { return myImpl->printIntervalMs(); }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapter::shardCount() const noexcept { return myImpl->shardCount(); }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapter::shardPhraseCount(const std::size_t shard) const noexcept
+{
+    return myImpl->shardPhraseCount(shard);
+}
+} // namespace dictionary
+} // namespace language
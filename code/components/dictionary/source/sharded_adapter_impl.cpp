@@ -0,0 +1,422 @@
+/**
+ * @brief Implementation details of class language::dictionary::ShardedAdapterImpl.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "adapter_impl.h"
+#include "shard_worker.h"
+#include "sharded_adapter_impl.h"
+#include "utils/arguments.h"
+#include "utils/binary_encoding.h"
+#include "utils/metrics.h"
+#include "utils/phrase.h"
+#include "utils/phrase_reader.h"
+#include "utils/record_reader.h"
+#include "utils/utils.h"
+
+namespace language
+{
+namespace dictionary
+{
+namespace
+{
+/**
+ * @brief Path to the shard worker executable, set by the build.
+ *
+ *        The workers are spawned from this executable with the socket as standard input, and
+ *        with option --tokenize to store the phrases as token IDs.
+ */
+constexpr const char *kShardWorkerPath{LANGUAGE_SHARD_WORKER_PATH};
+
+// ---------------------------------------------------------------------------
+bool reportStartFailure(const std::string &filePath, const bool fileFound)
+{
+    if (fileFound) { std::cerr << "\nShard workers couldn't be started for file \"" << filePath << "\"!\n\n"; }
+    else { std::cerr << "\nFile \"" << filePath << "\" wasn't found!\n\n"; }
+    return false;
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+ShardedAdapterImpl::ShardedAdapterImpl(const std::string &filePath, const std::size_t shardCount)
+    : myShards{}
+    , myFirstIndexes{}
+    , myPhraseCount{}
+    , myPhraseList{}
+    , myPhraseListFlag{}
+    , myFailed{false}
+    , myPhraseCountToUse{}
+    , myPrintIntervalMs{kDefaultPrintIntervalMs}
+    , myTokenize{false}
+    , mySkipHeader{false}
+    , myUtf8Policy{utils::Utf8Policy::Report}
+{
+    load(filePath, shardCount);
+}
+
+// ---------------------------------------------------------------------------
+ShardedAdapterImpl::ShardedAdapterImpl(const int argc, const char **argv)
+    : myShards{}
+    , myFirstIndexes{}
+    , myPhraseCount{}
+    , myPhraseList{}
+    , myPhraseListFlag{}
+    , myFailed{false}
+    , myPhraseCountToUse{}
+    , myPrintIntervalMs{kDefaultPrintIntervalMs}
+    , myTokenize{false}
+    , mySkipHeader{false}
+    , myUtf8Policy{utils::Utf8Policy::Report}
+{
+    load(argc, argv);
+}
+
+// ---------------------------------------------------------------------------
+ShardedAdapterImpl::~ShardedAdapterImpl() noexcept { stopWorkers(); }
+
+// ---------------------------------------------------------------------------
+const std::list<Phrase> &ShardedAdapterImpl::phrases() const
+{
+    // The phrases are fetched in ranges, a request per phrase would cost a round trip each.
+    std::call_once(myPhraseListFlag, [this]()
+    {
+        for (std::size_t shard{}; shard < myShards.size(); ++shard)
+        {
+            for (std::size_t first{}; first < myShards[shard]->phraseCount; first += kFetchCount)
+            {
+                if (!fetch(shard, first, kFetchCount, myPhraseList)) { break; }
+            }
+        }
+    });
+    return myPhraseList;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapterImpl::phraseCount() const noexcept { return myPhraseCount; }
+
+// ---------------------------------------------------------------------------
+Phrase ShardedAdapterImpl::phrase(const std::size_t index) const
+{
+    LANGUAGE_METRICS_TIME("shard_lookup", "Time spent looking up phrases in shard workers.");
+    const auto shard{shardOf(index)};
+    std::list<Phrase> phrases{};
+    if (!fetch(shard, index - myFirstIndexes[shard], 1U, phrases) || phrases.empty()) 
+    { 
+        myFailed = true;
+        return Phrase{}; 
+    }
+    return std::move(phrases.front());
+}
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapterImpl::phrases(const std::size_t first, const std::size_t count, 
+                                 std::vector<Phrase> &phrases) const
+{
+    LANGUAGE_METRICS_TIME("shard_lookup", "Time spent looking up phrases in shard workers.");
+
+    // Each shard holds consecutive indexes, so a range costs a round trip per shard and fetch count.
+    const auto last{first + utils::min(count, myPhraseCount - utils::min(first, myPhraseCount))};
+    std::list<Phrase> fetched{};
+    for (auto index{first}; index < last; )
+    {
+        const auto shard{shardOf(index)};
+        const auto shardFirst{myFirstIndexes[shard]};
+        const auto fetchCount{utils::min(utils::min(last, shardFirst + myShards[shard]->phraseCount) - index, kFetchCount)};
+        if (!fetch(shard, index - shardFirst, fetchCount, fetched) || (fetchCount != fetched.size()))
+        {
+            myFailed = true;
+            return false;
+        }
+        std::move(fetched.begin(), fetched.end(), std::back_inserter(phrases));
+        fetched.clear();
+        index += fetchCount;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapterImpl::failed() const noexcept { return myFailed; }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapterImpl::phraseCountToUse() const noexcept { return myPhraseCountToUse; }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapterImpl::printIntervalMs() const noexcept { return myPrintIntervalMs; }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapterImpl::shardCount() const noexcept { return myShards.size(); }
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapterImpl::shardPhraseCount(const std::size_t shard) const noexcept
+{
+    return myShards[shard]->phraseCount;
+}
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapterImpl::load(const std::string &filePath, const std::size_t shardCount)
+{
+    LANGUAGE_METRICS_TIME("shard_load", "Time spent loading phrase files into shards.");
+
+    // The file is streamed, so the coordinator never holds more than the pending phrases.
+    Phrase phrase{};
+    const auto format{utils::recordFormat(filePath)};
+    if (utils::RecordFormat::Lines == format)
+    {
+        utils::PhraseReader reader{filePath, utils::PhraseReader::kDefaultBufferSize, myUtf8Policy};
+        if (!reader.isOpen() || !startWorkers(shardCount)) { return reportStartFailure(filePath, reader.isOpen()); }
+        while (reader.next(phrase) && addPhrase(phrase)) {}
+        if (!checkUtf8(filePath, reader.invalidLines(), "line", myUtf8Policy))
+        {
+            stopWorkers();
+            return false;
+        }
+    }
+    else
+    {
+        utils::RecordReader reader{filePath, format, utils::RecordReader::kDefaultBufferSize, myUtf8Policy};
+        if (!reader.isOpen() || !startWorkers(shardCount)) { return reportStartFailure(filePath, reader.isOpen()); }
+
+        // Skip the header and all records without text in the first two columns, like blank lines.
+        std::vector<std::string> fields{};
+        if (mySkipHeader) { reader.next(fields); }
+        while (reader.next(fields))
+        {
+            if ((2U > fields.size()) || (fields[0U].empty() && fields[1U].empty())) { continue; }
+            phrase.primary = std::move(fields[0U]);
+            phrase.target  = std::move(fields[1U]);
+            if (!addPhrase(phrase)) { break; }
+        }
+        if (!checkUtf8(filePath, reader.invalidRecords(), "record", myUtf8Policy))
+        {
+            stopWorkers();
+            return false;
+        }
+    }
+    if (!sealShards(filePath)) { return false; }
+    if (0U == myPhraseCount)
+    {
+        std::cerr << "\nFile \"" << filePath << "\" contains insufficient data!\n\n";
+        stopWorkers();
+        return false;
+    }
+    myPhraseCountToUse = myPhraseCount;
+
+    std::cout << "\nLanguage data from file \"" << filePath << "\" successfully loaded into "
+              << myShards.size() << " shard(s):";
+    for (const auto &shard : myShards) { std::cout << " " << shard->phraseCount; }
+    std::cout << " phrase(s)!\n\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapterImpl::load(const int argc, const char **argv)
+{
+    const utils::Arguments args{argc, argv};
+    const auto &positional{args.positional()};
+
+    if (1U >= args.positionalCount())
+    {
+        std::cerr << "Cannot load dictionary due to missing file path!\n\n";
+        return false;
+    }
+    if ((2U < args.numericOption("columns", 2U)) || args.hasOption("near-duplicates"))
+    {
+        std::cerr << "\nMore than two columns and near-duplicates aren't supported with shards, ignored!\n";
+    }
+    myTokenize   = args.hasOption("tokenize");
+    mySkipHeader = args.hasOption("header");
+
+    // Select how to handle invalid UTF-8, report it by default.
+    const auto utf8Policy{args.option("utf8", "report")};
+    if (!utils::parseUtf8Policy(utf8Policy, myUtf8Policy))
+    {
+        std::cerr << "Invalid UTF-8 policy \"" << utf8Policy << "\", reporting invalid UTF-8!\n\n";
+    }
+    if (!load(positional[1U], args.numericOption("shards", 1U))) { return false; }
+
+    // Get number of phrases to run during the game, and the phrase interval in milliseconds.
+    if (3U <= args.positionalCount())
+    {
+        const auto count{static_cast<std::size_t>(std::atoi(positional[2U].c_str()))};
+        myPhraseCountToUse = (0U != count) ? count : myPhraseCount;
+    }
+    if (4U <= args.positionalCount())
+    {
+        myPrintIntervalMs = static_cast<std::size_t>(std::atoi(positional[3U].c_str()));
+    }
+    if (args.hasOption("no-delay")) { myPrintIntervalMs = 0U; }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapterImpl::startWorkers(const std::size_t shardCount)
+{
+    // The workers are spawned from their own executable rather than forked, since a forked child 
+    // could inherit a mutex locked by another thread of the coordinator, e.g. of the metrics or 
+    // the trace.
+    std::string workerPath{kShardWorkerPath};
+    std::string tokenizeOption{"--tokenize"};
+    char *const arguments[]{workerPath.data(), myTokenize ? tokenizeOption.data() : nullptr, nullptr};
+
+    for (std::size_t i{}; i < utils::max(shardCount, std::size_t{1U}); ++i)
+    {
+        int sockets[2]{};
+        if (0 != ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets))
+        {
+            stopWorkers();
+            return false;
+        }
+
+        // The worker only keeps its end of the socket, as standard input, all other sockets are
+        // closed on exec, so the worker ends when the coordinator closes its end.
+        pid_t process{};
+        posix_spawn_file_actions_t actions{};
+        auto spawned{::posix_spawn_file_actions_init(&actions)};
+        if (0 == spawned)
+        {
+            spawned = ::posix_spawn_file_actions_adddup2(&actions, sockets[1], STDIN_FILENO);
+            if (0 == spawned)
+            {
+                spawned = ::posix_spawn(&process, kShardWorkerPath, &actions, nullptr, arguments, environ);
+            }
+            ::posix_spawn_file_actions_destroy(&actions);
+        }
+        ::close(sockets[1]);
+        if (0 != spawned)
+        {
+            ::close(sockets[0]);
+            stopWorkers();
+            return false;
+        }
+        auto shard{std::make_unique<Shard>()};
+        shard->process     = process;
+        shard->socket      = sockets[0];
+        shard->phraseCount = 0U;
+        shard->pendingPhrases.assign(1U, static_cast<char>(ShardMessage::Add));
+        myShards.push_back(std::move(shard));
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+void ShardedAdapterImpl::stopWorkers() noexcept
+{
+    // Closing the socket ends the worker, wait for it so that it doesn't outlive the coordinator.
+    for (const auto &shard : myShards)
+    {
+        ::close(shard->socket);
+        ::waitpid(shard->process, nullptr, 0);
+    }
+    myShards.clear();
+    myFirstIndexes.clear();
+    myPhraseCount = 0U;
+}
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapterImpl::addPhrase(const Phrase &phrase)
+{
+    // Duplicates have the same hash, so the worker owning the shard removes them.
+    auto &shard{*myShards[PhraseHash{}(phrase) % myShards.size()]};
+    utils::encodeText(phrase.primary, shard.pendingPhrases);
+    utils::encodeText(phrase.target, shard.pendingPhrases);
+    return (kBatchSize > shard.pendingPhrases.size()) || sendPendingPhrases(shard);
+}
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapterImpl::sendPendingPhrases(Shard &shard)
+{
+    if (1U == shard.pendingPhrases.size()) { return true; }
+    const auto sent{sendMessage(shard.socket, shard.pendingPhrases)};
+    shard.pendingPhrases.resize(1U);
+    return sent;
+}
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapterImpl::sealShards(const std::string &filePath)
+{
+    // Seal all shards before waiting for the first reply, so that the workers index in parallel.
+    const std::string seal(1U, static_cast<char>(ShardMessage::Seal));
+    bool sealed{true};
+    for (const auto &shard : myShards)
+    {
+        sealed = sendPendingPhrases(*shard) && sendMessage(shard->socket, seal) && sealed;
+        shard->pendingPhrases = std::string{};
+    }
+
+    std::string reply{};
+    for (const auto &shard : myShards)
+    {
+        std::uint64_t count{};
+        sealed = sealed && receiveMessage(shard->socket, reply) && !reply.empty() &&
+                 (static_cast<char>(ShardMessage::Reply) == reply.front()) &&
+                 utils::Decoder{reply.data() + 1, reply.data() + reply.size()}.varint(count);
+        if (!sealed) { break; }
+
+        shard->phraseCount = static_cast<std::size_t>(count);
+        myFirstIndexes.push_back(myPhraseCount);
+        myPhraseCount += shard->phraseCount;
+    }
+    if (!sealed)
+    {
+        std::cerr << "\nShard workers failed while loading \"" << filePath << "\"!\n\n";
+        stopWorkers();
+    }
+    return sealed;
+}
+
+// ---------------------------------------------------------------------------
+bool ShardedAdapterImpl::fetch(const std::size_t shard, const std::size_t first, const std::size_t count,
+                               std::list<Phrase> &phrases) const
+{
+    std::string request(1U, static_cast<char>(ShardMessage::Get));
+    utils::encodeVarint(first, request);
+    utils::encodeVarint(count, request);
+    std::string reply{};
+    bool received{};
+    {
+        const std::lock_guard<std::mutex> lock{myShards[shard]->mutex};
+        received = sendMessage(myShards[shard]->socket, request) && receiveMessage(myShards[shard]->socket, reply);
+    }
+
+    std::uint64_t replyCount{};
+    utils::Decoder decoder{reply.data() + (reply.empty() ? 0 : 1), reply.data() + reply.size()};
+    received = received && !reply.empty() && (static_cast<char>(ShardMessage::Reply) == reply.front()) &&
+               decoder.varint(replyCount);
+    for (std::uint64_t i{}; received && (i < replyCount); ++i)
+    {
+        Phrase phrase{};
+        received = decoder.text(phrase.primary) && decoder.text(phrase.target);
+        if (received) { phrases.push_back(std::move(phrase)); }
+    }
+    if (!received) 
+    { 
+        std::cerr << "Shard worker " << shard << " doesn't respond!\n"; 
+        myFailed = true;
+    }
+    return received;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t ShardedAdapterImpl::shardOf(const std::size_t index) const noexcept
+{
+    // The last shard starting at or before the index, empty shards start at the same index.
+    const auto next{std::upper_bound(myFirstIndexes.begin(), myFirstIndexes.end(), index)};
+    return static_cast<std::size_t>(std::distance(myFirstIndexes.begin(), next)) - 1U;
+}
+} // namespace dictionary
+} // namespace language
@@ -0,0 +1,204 @@
+/**
+ * @brief Implementation details of class language::dictionary::ShardedAdapter.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+#include "utils/phrase.h"
+#include "utils/utf8.h"
+
+namespace language
+{
+namespace dictionary
+{
+/**
+ * @brief Implementation details of sharded dictionary adapter, i.e. of the coordinator.
+ */
+class ShardedAdapterImpl
+{
+public:
+    /**
+     * @brief Create sharded dictionary adapter implementation.
+     *
+     * @param[in] filePath Path to the file from where to load the phrases.
+     * @param[in] shardCount The number of shards, i.e. of worker processes.
+     */
+    ShardedAdapterImpl(const std::string &filePath, std::size_t shardCount);
+
+    /**
+     * @brief Create sharded dictionary adapter implementation.
+     *
+     * @param[in] argc The number of input arguments entered from the terminal at runtime.
+     * @param[in] argv Vector storing all input arguments entered from the terminal at runtime.
+     */
+    ShardedAdapterImpl(int argc, const char **argv);
+
+    /**
+     * @brief Stop the worker processes and delete the implementation.
+     */
+    ~ShardedAdapterImpl() noexcept;
+
+    /**
+     * @brief Get phrases to put in the dictionary, fetched from the workers on the first call.
+     *
+     * @return Phrases to put in the dictionary.
+     */
+    const std::list<Phrase> &phrases() const;
+
+    /**
+     * @brief Get the number of phrases in the dictionary.
+     *
+     * @return The number of phrases in all shards.
+     */
+    std::size_t phraseCount() const noexcept;
+
+    /**
+     * @brief Get a phrase by its index in the dictionary, from the worker owning it.
+     *
+     * @param[in] index The index of the phrase, must be smaller than the number of phrases.
+     *
+     * @return The phrase, or an empty phrase if the worker doesn't respond, which marks the
+     *         adapter as failed.
+     */
+    Phrase phrase(std::size_t index) const;
+
+    /**
+     * @brief Get consecutive phrases by their index in the dictionary, fetched in ranges from
+     *        the workers owning them.
+     *
+     * @param[in] first The index of the first phrase.
+     * @param[in] count The number of phrases, cut at the end of the dictionary.
+     * @param[out] phrases Vector the phrases are appended to.
+     *
+     * @return True if the phrases were read, false if a worker doesn't respond.
+     */
+    bool phrases(std::size_t first, std::size_t count, std::vector<Phrase> &phrases) const;
+
+    /**
+     * @brief Check if a worker hasn't responded.
+     *
+     * @return True if a phrase couldn't be read from a worker, else false.
+     */
+    bool failed() const noexcept;
+
+    /**
+     * @brief Get the number of phrases to use during the game.
+     *
+     * @return Number of phrases to use during the game.
+     */
+    std::size_t phraseCountToUse() const noexcept;
+
+    /**
+     * @brief Get the print interval in milliseconds.
+     *
+     * @return The print interval in milliseconds.
+     */
+    std::size_t printIntervalMs() const noexcept;
+
+    /**
+     * @brief Get the number of shards.
+     *
+     * @return The number of shards, 0 if the phrases couldn't be loaded.
+     */
+    std::size_t shardCount() const noexcept;
+
+    /**
+     * @brief Get the number of phrases owned by a shard.
+     *
+     * @param[in] shard The shard, must be smaller than the number of shards.
+     *
+     * @return The number of phrases of the shard.
+     */
+    std::size_t shardPhraseCount(std::size_t shard) const noexcept;
+
+    ShardedAdapterImpl()                                       = delete; // No default constructor.
+    ShardedAdapterImpl(const ShardedAdapterImpl &)             = delete; // No copy constructor.
+    ShardedAdapterImpl(ShardedAdapterImpl &&)                  = delete; // No move constructor.
+    ShardedAdapterImpl & operator=(const ShardedAdapterImpl &) = delete; // No copy assignment.
+    ShardedAdapterImpl & operator=(ShardedAdapterImpl &&)      = delete; // No move assignment.
+
+private:
+    /**
+     * @brief Connection to the worker process owning a shard.
+     */
+    struct Shard
+    {
+        /** ID of the worker process. */
+        pid_t process;
+
+        /** The coordinator's end of the socket connected to the worker. */
+        int socket;
+
+        /** The number of phrases of the shard, known once the shard is sealed. */
+        std::size_t phraseCount;
+
+        /** Message of phrases not sent to the worker yet. */
+        std::string pendingPhrases;
+
+        /** Mutex serializing the requests to the worker. */
+        std::mutex mutex;
+    };
+
+    bool load(const std::string &filePath, std::size_t shardCount);
+    bool load(int argc, const char **argv);
+    bool startWorkers(std::size_t shardCount);
+    void stopWorkers() noexcept;
+    bool addPhrase(const Phrase &phrase);
+    bool sendPendingPhrases(Shard &shard);
+    bool sealShards(const std::string &filePath);
+    bool fetch(std::size_t shard, std::size_t first, std::size_t count, std::list<Phrase> &phrases) const;
+    std::size_t shardOf(std::size_t index) const noexcept;
+
+    /** Default print interval in milliseconds. */
+    static constexpr std::size_t kDefaultPrintIntervalMs{2000U};
+
+    /** Size from which pending phrases are sent to a worker in bytes. */
+    static constexpr std::size_t kBatchSize{64U * 1024U};
+
+    /** The number of phrases fetched per request when fetching all phrases of a shard. */
+    static constexpr std::size_t kFetchCount{1024U};
+
+    /** Connections to the workers, one per shard. */
+    std::vector<std::unique_ptr<Shard>> myShards;
+
+    /** Index of the first phrase of each shard, the phrases are numbered shard by shard. */
+    std::vector<std::size_t> myFirstIndexes;
+
+    /** The number of phrases in all shards. */
+    std::size_t myPhraseCount;
+
+    /** Phrases fetched on first request for the phrase list. */
+    mutable std::list<Phrase> myPhraseList;
+
+    /** Flag ensuring that the phrase list is only fetched once. */
+    mutable std::once_flag myPhraseListFlag;
+
+    /** Indicate whether a worker hasn't responded, set by any lookup. */
+    mutable std::atomic<bool> myFailed;
+
+    /** The number of phrases to use during a game. */
+    std::size_t myPhraseCountToUse;
+
+    /** Print interval in milliseconds. */
+    std::size_t myPrintIntervalMs;
+
+    /** Indicate whether the workers store the phrases as token IDs. */
+    bool myTokenize;
+
+    /** Indicate whether to skip the first record of tabular files. */
+    bool mySkipHeader;
+
+    /** How to handle invalid UTF-8 in phrase files. */
+    utils::Utf8Policy myUtf8Policy;
+};
+} // namespace dictionary
+} // namespace language
@@ -0,0 +1,121 @@
+/**
+ * @brief Implementation details of class language::dictionary::StreamPrinter.
+ */
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "dictionary/stream_printer.h"
+#include "utils/arguments.h"
+#include "utils/bloom_filter.h"
+#include "utils/output.h"
+#include "utils/phrase.h"
+#include "utils/phrase_reader.h"
+#include "utils/scheduler.h"
+
+namespace language
+{
+namespace dictionary
+{
+namespace
+{
+/** Block size in bytes used when printing without delay. */
+constexpr std::size_t kExportBlockSize{1024U * 1024U};
+
+/** The number of bytes per megabyte. */
+constexpr std::size_t kBytesPerMb{1024U * 1024U};
+} // namespace
+
+// ---------------------------------------------------------------------------
+StreamPrinter::StreamPrinter(const int argc, const char **argv)
+    : myFilePath{}
+    , myPhraseCountToUse{}
+    , myPrintIntervalMs{kDefaultPrintIntervalMs}
+    , myDedupeSize{}
+    , myPrintedPhraseCount{}
+    , mySkippedPhraseCount{}
+    , myPhrase{}
+{
+    const utils::Arguments args{argc, argv};
+    const auto &positional{args.positional()};
+
+    if (2U <= args.positionalCount()) { myFilePath = positional[1U]; }
+    if (3U <= args.positionalCount()) 
+    { 
+        myPhraseCountToUse = static_cast<std::size_t>(std::atoi(positional[2U].c_str())); 
+    }
+    if (4U <= args.positionalCount()) 
+    { 
+        myPrintIntervalMs = static_cast<std::size_t>(std::atoi(positional[3U].c_str())); 
+    }
+    if (args.hasOption("no-delay")) { myPrintIntervalMs = 0U; }
+    if (args.hasOption("dedupe")) 
+    { 
+        myDedupeSize = args.numericOption("dedupe", kDefaultDedupeSizeMb) * kBytesPerMb; 
+    }
+}
+
+// ---------------------------------------------------------------------------
+bool StreamPrinter::print(std::ostream& ostream)
+{
+    utils::PhraseReader reader{myFilePath};
+
+    if (!reader.isOpen())
+    {
+        std::cerr << "\nFile \"" << myFilePath << "\" wasn't found!\n\n";
+        return false;
+    }
+    auto filter{0U < myDedupeSize ? std::make_unique<utils::BloomFilter>(myDedupeSize) : nullptr};
+
+    if (0U == myPrintIntervalMs)
+    {
+        utils::Output output{ostream, kExportBlockSize};
+        while (printNext(reader, filter.get(), output)) {}
+        output.flush();
+    }
+    else
+    {
+        utils::Output output{ostream};
+        auto printPhrase = [&]() 
+        {
+            const auto printed{printNext(reader, filter.get(), output)};
+            output.flush();
+            return printed;
+        };
+        utils::Scheduler scheduler{std::chrono::milliseconds{myPrintIntervalMs}, printPhrase};
+        scheduler.start();
+        scheduler.wait();
+    }
+    return 0U < reader.phraseCount();
+}
+
+// ---------------------------------------------------------------------------
+std::size_t StreamPrinter::printedPhraseCount() const noexcept { return myPrintedPhraseCount; }
+
+// ---------------------------------------------------------------------------
+std::size_t StreamPrinter::skippedPhraseCount() const noexcept { return mySkippedPhraseCount; }
+
+// ---------------------------------------------------------------------------
+bool StreamPrinter::printNext(utils::PhraseReader &reader, utils::BloomFilter *filter, 
+                              utils::Output &output)
+{
+    if ((0U != myPhraseCountToUse) && (myPhraseCountToUse <= myPrintedPhraseCount)) { return false; }
+
+    while (reader.next(myPhrase))
+    {
+        // Skip phrases that have (probably) been printed before.
+        if (filter && filter->insert(PhraseHash{}(myPhrase))) 
+        { 
+            ++mySkippedPhraseCount; 
+            continue;
+        }
+        output << myPhrase.primary << "\n" << myPhrase.target << "\n\n";
+        ++myPrintedPhraseCount;
+        return true;
+    }
+    return false;
+}
+} // namespace dictionary
+} // namespace language
@@ -0,0 +1,109 @@
+/**
+ * @brief Implementation details of class language::dictionary::TokenizedCorpus.
+ */
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "dictionary/tokenized_corpus.h"
+#include "utils/phrase.h"
+#include "utils/vocabulary.h"
+
+namespace language
+{
+namespace dictionary
+{
+// ---------------------------------------------------------------------------
+TokenizedCorpus::TokenizedCorpus(std::shared_ptr<utils::Vocabulary> vocabulary)
+    : myVocabulary{std::move(vocabulary)}
+    , myTokens{}
+    , myOffsets{0U}
+{}
+
+// ---------------------------------------------------------------------------
+TokenizedCorpus::TokenizedCorpus(const std::list<Phrase> &phrases,
+                                 std::shared_ptr<utils::Vocabulary> vocabulary)
+    : TokenizedCorpus{std::move(vocabulary)}
+{
+    myOffsets.reserve(phrases.size() * kColumnCount + 1U);
+    for (const auto &phrase : phrases) { add(phrase); }
+    myTokens.shrink_to_fit();
+}
+
+// ---------------------------------------------------------------------------
+void TokenizedCorpus::add(const Phrase &phrase)
+{
+    addText(phrase.primary);
+    addText(phrase.target);
+}
+
+// ---------------------------------------------------------------------------
+std::size_t TokenizedCorpus::size() const noexcept 
+{ 
+    return (myOffsets.size() - 1U) / kColumnCount; 
+}
+
+// ---------------------------------------------------------------------------
+bool TokenizedCorpus::empty() const noexcept { return 0U == size(); }
+
+// ---------------------------------------------------------------------------
+TokenRange TokenizedCorpus::tokens(const std::size_t index, const std::size_t column) const noexcept
+{
+    const auto text{index * kColumnCount + column};
+    return TokenRange{myTokens.data() + myOffsets[text], myTokens.data() + myOffsets[text + 1U]};
+}
+
+// ---------------------------------------------------------------------------
+std::string TokenizedCorpus::text(const std::size_t index, const std::size_t column) const
+{
+    const auto range{tokens(index, column)};
+    std::size_t length{range.empty() ? 0U : range.size() - 1U};
+    for (const auto token : range) { length += myVocabulary->word(token).size(); }
+
+    // Join the words with single spaces, just like they were split.
+    std::string text{};
+    text.reserve(length);
+    for (std::size_t i{}; i < range.size(); ++i)
+    {
+        if (0U < i) { text.push_back(' '); }
+        text.append(myVocabulary->word(range[i]));
+    }
+    return text;
+}
+
+// ---------------------------------------------------------------------------
+Phrase TokenizedCorpus::phrase(const std::size_t index) const
+{
+    return Phrase{text(index, kPrimaryColumn), text(index, kTargetColumn)};
+}
+
+// ---------------------------------------------------------------------------
+const utils::Vocabulary &TokenizedCorpus::vocabulary() const noexcept { return *myVocabulary; }
+
+// ---------------------------------------------------------------------------
+std::size_t TokenizedCorpus::memoryUsage() const noexcept
+{
+    return myTokens.capacity() * sizeof(utils::Vocabulary::Token) + 
+           myOffsets.capacity() * sizeof(std::size_t) + myVocabulary->memoryUsage();
+}
+
+// ---------------------------------------------------------------------------
+void TokenizedCorpus::addText(const std::string_view text)
+{
+    // Empty texts have no tokens, all other texts have one token more than they have spaces.
+    if (!text.empty())
+    {
+        std::size_t start{};
+        for (auto space{text.find(' ')}; std::string_view::npos != space; space = text.find(' ', start))
+        {
+            myTokens.push_back(myVocabulary->intern(text.substr(start, space - start)));
+            start = space + 1U;
+        }
+        myTokens.push_back(myVocabulary->intern(text.substr(start)));
+    }
+    myOffsets.push_back(myTokens.size());
+}
+} // namespace dictionary
+} // namespace language
@@ -1,8 +1,11 @@
 /**
  * @brief Unit test for class language::dictionary::Adapter.
  */
+#include <cstdio>
 #include <fstream>
+#include <iterator>
 #include <list>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -87,6 +90,7 @@ TEST(DictionaryAdapterTest, FileTest)
 
     // Expect the print interval to be set to the default value.
     EXPECT_EQ(adapter.printIntervalMs(), kDefaultPrintIntervalMs);
+    std::remove(filePath);
 }
 
 /**
@@ -129,6 +133,7 @@ TEST(DictionaryAdapterTest, DuplicateTest)
 
     // Expect the print interval to be set to the default value.
     EXPECT_EQ(adapter.printIntervalMs(), kDefaultPrintIntervalMs);
+    std::remove(filePath);
 }
 
 /**
@@ -214,6 +219,188 @@ TEST(DictionaryAdapterTest, ArgTest)
         // Expect the print interval to be set to 500 ms.
         EXPECT_EQ(adapter.printIntervalMs(), printIntervalMs);
     }
+
+    // Test 4 - Passing the file path and storing the phrases as token IDs.
+    {
+        // Create arguments.
+        const std::vector<const char *> args{"./runGame", "phrases.txt", "--tokenize"};
+
+        // Create adapter by passing the arguments and the argument count.
+        dictionary::Adapter adapter{static_cast<int>(args.size()), const_cast<const char **>(args.data())};
+
+        // Expect the phrases to be tokenized and to be rebuilt one at a time and as a list.
+        ASSERT_NE(adapter.tokenizedPhrases(), nullptr);
+        ASSERT_EQ(adapter.phraseCount(), phrases.size());
+        EXPECT_EQ(adapter.phrase(2U), *std::next(phrases.begin(), 2));
+        EXPECT_EQ(adapter.phrases(), phrases);
+
+        // Expect the phrase count to use to be equal to the number of stored phrases.
+        EXPECT_EQ(adapter.phraseCountToUse(), phrases.size());
+    }
+    std::remove(filePath);
+}
+
+/**
+ * @brief Verify that entries with more than two languages are loaded and paired as requested.
+ */
+TEST(DictionaryAdapterTest, ColumnTest) 
+{
+    // Write entries in three languages, including a duplicate entry.
+    {
+        std::ofstream ostream{"phrases.txt"};
+        ostream << "Good luck!\nViel Glück!\nBonne chance!\n\n"
+                << "Please enter your answer.\nBitte gib deine Antwort ein.\nVeuillez entrer votre réponse.\n\n"
+                << "Good luck!\nViel Glück!\nBonne chance!\n\n";
+    }
+    const std::vector<const char *> args{"./runGame", "phrases.txt", "--columns=3", "--pair=3,2"};
+    dictionary::Adapter adapter{static_cast<int>(args.size()), const_cast<const char **>(args.data())};
+
+    // Expect the duplicate entry to be removed and the selected columns to form the phrases.
+    ASSERT_NE(adapter.corpus(), nullptr);
+    ASSERT_EQ(adapter.phraseCount(), 2U);
+    EXPECT_EQ(adapter.phraseCountToUse(), 2U);
+    EXPECT_EQ(adapter.phrase(1U), (Phrase{"Veuillez entrer votre réponse.", "Bitte gib deine Antwort ein."}));
+    const std::list<Phrase> expectedPhrases{
+        {"Bonne chance!", "Viel Glück!"},
+        {"Veuillez entrer votre réponse.", "Bitte gib deine Antwort ein."}};
+    EXPECT_EQ(adapter.phrases(), expectedPhrases);
+
+    // Expect the file to have been rewritten without the duplicate entry.
+    const dictionary::Adapter reloaded{"phrases.txt"};
+    EXPECT_EQ(reloaded.phraseCount(), 3U);
+    std::remove("phrases.txt");
+}
+
+/**
+ * @brief Verify that no language pair is selected when entries with more than two languages
+ *        fail to load.
+ */
+TEST(DictionaryAdapterTest, ColumnLoadFailureTest)
+{
+    // Test 1 - Missing file.
+    {
+        const std::vector<const char *> args{"./runGame", "missing_phrases.txt", "--columns=3", "--pair=3,2"};
+        const dictionary::Adapter adapter{static_cast<int>(args.size()), const_cast<const char **>(args.data())};
+        EXPECT_EQ(adapter.corpus(), nullptr);
+        EXPECT_EQ(adapter.phraseCount(), 0U);
+    }
+
+    // Test 2 - File rejected due to invalid UTF-8, in both the line and the record format.
+    for (const char *filePath : {"phrases.txt", "phrases.tsv"})
+    {
+        {
+            std::ofstream ostream{filePath, std::ios::binary};
+            ostream << "Good luck!\tViel Glück!\tBonne chance!\n\n"
+                    << "Hop\xFF!\tHüpf!\tSaute!\n\n";
+        }
+        const std::vector<const char *> args{"./runGame", filePath, "--columns=3", "--utf8=reject"};
+        const dictionary::Adapter adapter{static_cast<int>(args.size()), const_cast<const char **>(args.data())};
+        EXPECT_EQ(adapter.corpus(), nullptr) << filePath;
+        EXPECT_EQ(adapter.phraseCount(), 0U) << filePath;
+        std::remove(filePath);
+    }
+}
+
+/**
+ * @brief Verify that TSV, CSV and JSON Lines files are parsed according to their extension.
+ */
+TEST(DictionaryAdapterTest, RecordFormatTest) 
+{
+    const std::list<Phrase> expectedPhrases{
+        {"Good luck, and have fun!", "Viel Glück und viel Spass!"},
+        {"He said \"hop\".", "Er sagte \"hüpf\"."},
+        {"The frog tries\nto hop away.", "Der Frosch versucht weg zuhüpfen."}};
+
+    // Test 1 - Tab-separated values with a header, carriage returns and a blank line.
+    {
+        {
+            std::ofstream ostream{"phrases.tsv"};
+            ostream << "English\tGerman\r\n"
+                    << "Good luck, and have fun!\tViel Glück und viel Spass!\r\n\r\n"
+                    << "He said \"hop\".\tEr sagte \"hüpf\".\n"
+                    << "The frog tries\\nto hop away.\tDer Frosch versucht weg zuhüpfen.";
+        }
+        const std::vector<const char *> args{"./runGame", "phrases.tsv", "--header"};
+        dictionary::Adapter adapter{static_cast<int>(args.size()), const_cast<const char **>(args.data())};
+        ASSERT_EQ(adapter.phraseCount(), 3U);
+        EXPECT_EQ(adapter.phrase(0U), expectedPhrases.front());
+        EXPECT_EQ(adapter.phrase(1U), *std::next(expectedPhrases.begin()));
+    }
+
+    // Test 2 - Comma-separated values with quoted fields, including a duplicate record.
+    {
+        {
+            std::ofstream ostream{"phrases.csv"};
+            ostream << "\"Good luck, and have fun!\",Viel Glück und viel Spass!\n"
+                    << "\"He said \"\"hop\"\".\",\"Er sagte \"\"hüpf\"\".\"\n"
+                    << "\"The frog tries\nto hop away.\",Der Frosch versucht weg zuhüpfen.\n"
+                    << "\"Good luck, and have fun!\",Viel Glück und viel Spass!\n";
+        }
+        const dictionary::Adapter adapter{"phrases.csv"};
+        EXPECT_EQ(adapter.phrases(), expectedPhrases);
+    }
+
+    // Test 3 - JSON Lines with arrays, objects and escapes, as well as an invalid line.
+    {
+        {
+            std::ofstream ostream{"phrases.jsonl"};
+            ostream << "[\"Good luck, and have fun!\", \"Viel Gl\\u00fcck und viel Spass!\"]\n"
+                    << "{\"en\": \"He said \\\"hop\\\".\", \"de\": \"Er sagte \\\"hüpf\\\".\"}\n"
+                    << "not a record\n"
+                    << "[\"The frog tries\\nto hop away.\",\"Der Frosch versucht weg zuh\\u00fcpfen.\"]";
+        }
+        const dictionary::Adapter adapter{"phrases.jsonl"};
+        EXPECT_EQ(adapter.phrases(), expectedPhrases);
+    }
+    std::remove("phrases.tsv");
+    std::remove("phrases.csv");
+    std::remove("phrases.jsonl");
+}
+
+/**
+ * @brief Verify handling of byte order marks and invalid UTF-8 in phrase files.
+ */
+TEST(DictionaryAdapterTest, Utf8Test) 
+{
+    auto writeFile = []()
+    {
+        std::ofstream ostream{"phrases.txt", std::ios::binary};
+        ostream << "\xEF\xBB\xBFGood luck!\nViel Gl\xC3\xBC" "ck!\n\n"
+                << "Hop\xFF\xFE!\nH\xC3\xBCpf!\n\n"
+                << "Frog\nFrosch \xE2\x82\n";
+    };
+    auto load = [](const char *policy)
+    {
+        const std::vector<const char *> args{"./runGame", "phrases.txt", policy};
+        return std::make_unique<dictionary::Adapter>(static_cast<int>(args.size()), 
+                                                     const_cast<const char **>(args.data()));
+    };
+
+    // Test 1 - Report invalid lines, but keep them as they are. The byte order mark is removed.
+    {
+        writeFile();
+        const auto adapter{load("--utf8=report")};
+        ASSERT_EQ(adapter->phraseCount(), 3U);
+        EXPECT_EQ(adapter->phrase(0U), (Phrase{"Good luck!", "Viel Gl\xC3\xBC" "ck!"}));
+        EXPECT_EQ(adapter->phrase(1U).primary, "Hop\xFF\xFE!");
+    }
+
+    // Test 2 - Replace invalid sequences, a truncated sequence at the end of a line included.
+    {
+        writeFile();
+        const auto adapter{load("--utf8=repair")};
+        ASSERT_EQ(adapter->phraseCount(), 3U);
+        EXPECT_EQ(adapter->phrase(1U).primary, "Hop\xEF\xBF\xBD\xEF\xBF\xBD!");
+        EXPECT_EQ(adapter->phrase(2U).target, "Frosch \xEF\xBF\xBD");
+    }
+
+    // Test 3 - Reject the file.
+    {
+        writeFile();
+        const auto adapter{load("--utf8=reject")};
+        EXPECT_EQ(adapter->phraseCount(), 0U);
+    }
+    std::remove("phrases.txt");
 }
 } // namespace
 
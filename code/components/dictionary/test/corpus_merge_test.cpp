@@ -0,0 +1,125 @@
+/**
+ * @brief Unit test for the external-memory merge of phrase files in namespace language::dictionary.
+ */
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/corpus_merge.h"
+
+namespace
+{
+using namespace language;
+
+/**
+ * @brief Read the content of a file.
+ *
+ * @param[in] filePath Path to the file.
+ *
+ * @return The file content.
+ */
+std::string readFile(const std::string& filePath)
+{
+    std::ifstream istream{filePath, std::ios::binary};
+    std::ostringstream content{};
+    content << istream.rdbuf();
+    return content.str();
+}
+
+/**
+ * @brief Verify that pairs from line-based and tabular files are merged in order of first occurrence.
+ */
+TEST(CorpusMergeTest, MergeTest)
+{
+    {
+        std::ofstream ostream{"alice.txt"};
+        ostream << "Hello!\nHallo!\n\nGood luck!\nViel Glück!\n\nHello!\nHallo!\n\nThank you.\nDanke.\n";
+    }
+    {
+        std::ofstream ostream{"bob.tsv"};
+        ostream << "English\tGerman\nThank you.\tDanke.\nGood night.\tGute Nacht.\nHello!\tGrüss dich!\n";
+    }
+    dictionary::CorpusMerge merge{};
+    EXPECT_TRUE(merge.merge({"alice.txt", "bob.tsv"}, "merged.txt", true));
+    EXPECT_EQ(merge.phraseCount(), 7U);
+    EXPECT_EQ(merge.uniquePhraseCount(), 5U);
+    EXPECT_EQ(readFile("merged.txt"), "Hello!\nHallo!\n\nGood luck!\nViel Glück!\n\nThank you.\nDanke.\n\n"
+                                      "Good night.\nGute Nacht.\n\nHello!\nGrüss dich!\n\n");
+
+    // Expect the merge to fail if an input file is missing.
+    EXPECT_FALSE(merge.merge({"alice.txt", "carol.txt"}, "merged.txt"));
+
+    std::remove("alice.txt");
+    std::remove("bob.tsv");
+    std::remove("merged.txt");
+}
+
+/**
+ * @brief Verify that duplicates are removed across many runs when the corpus exceeds the memory budget.
+ */
+TEST(CorpusMergeTest, ExternalMergeTest)
+{
+    std::string expected{};
+    std::unordered_set<std::string> seen{};
+    std::uint32_t seed{12345U};
+    {
+        std::ofstream ostream{"phrases.txt"};
+        for (std::size_t i{}; i < 300000U; ++i)
+        {
+            seed = seed * 1103515245U + 12345U;
+            const auto id{std::to_string((seed >> 8U) % 100000U)};
+            const std::string pair{"phrase " + id + "\nPhrase " + id + "\n"};
+            ostream << pair << "\n";
+            if (seen.insert(pair).second) { expected += pair + "\n"; }
+        }
+    }
+    // Force more runs than can be merged at once, using a single thread.
+    dictionary::CorpusMerge merge{0U, 1U, "."};
+    EXPECT_TRUE(merge.merge({"phrases.txt"}, "merged.txt"));
+    EXPECT_GT(merge.runCount(), dictionary::CorpusMerge::kMaxMergeWidth);
+    EXPECT_EQ(merge.phraseCount(), 300000U);
+    EXPECT_EQ(merge.uniquePhraseCount(), seen.size());
+    EXPECT_EQ(readFile("merged.txt"), expected);
+
+    std::remove("phrases.txt");
+    std::remove("merged.txt");
+}
+/**
+ * @brief Verify that the merge fails when merging a group of runs can't write the merged run.
+ */
+TEST(CorpusMergeTest, RunWriteFailureTest)
+{
+    {
+        std::ofstream ostream{"phrases.txt"};
+        for (std::size_t i{}; i < 300000U; ++i) { ostream << "p" << i << "\nP" << i << "\n\n"; }
+    }
+
+    // Limit the file size, so that the spilled runs and the output fit, but the merged groups of runs
+    // don't, as they hold about the same pairs as the output and a header per pair.
+    rlimit limit{};
+    ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &limit), 0);
+    const auto previousHandler{std::signal(SIGXFSZ, SIG_IGN)};
+    rlimit reducedLimit{limit};
+    reducedLimit.rlim_cur = 7U * 1024U * 1024U;
+    ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &reducedLimit), 0);
+
+    dictionary::CorpusMerge merge{0U, 1U, "."};
+    const auto success{merge.merge({"phrases.txt"}, "merged.txt")};
+    setrlimit(RLIMIT_FSIZE, &limit);
+    std::signal(SIGXFSZ, previousHandler);
+    EXPECT_FALSE(success);
+    EXPECT_GT(merge.runCount(), dictionary::CorpusMerge::kMaxMergeWidth);
+
+    std::remove("phrases.txt");
+    std::remove("merged.txt");
+}
+} // namespace
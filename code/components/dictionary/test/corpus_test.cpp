@@ -0,0 +1,48 @@
+/**
+ * @brief Unit test for class language::dictionary::Corpus.
+ */
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/corpus.h"
+
+namespace 
+{
+using namespace language;
+
+/**
+ * @brief Verify that entries are stored and retrieved per language.
+ */
+TEST(CorpusTest, EntryTest) 
+{
+    dictionary::Corpus corpus{4U};
+    corpus.add({"The frog tries to hop away.", "Der Frosch versucht weg zuhüpfen.", 
+                "La grenouille essaie de s'enfuir.", "La rana intenta escapar."});
+    corpus.add({"Good luck!", "Viel Glück!"});
+    corpus.add({"The frog tries to hop away.", "Der Frosch versucht weg zuhüpfen.", 
+                "La grenouille essaie de s'enfuir.", "La rana intenta escapar."});
+
+    ASSERT_EQ(corpus.size(), 3U);
+    EXPECT_EQ(corpus.columnCount(), 4U);
+    EXPECT_EQ(corpus.text(0U, 2U), "La grenouille essaie de s'enfuir.");
+    EXPECT_EQ(corpus.text(1U, 1U), "Viel Glück!");
+
+    // Expect missing texts to be stored as empty texts.
+    EXPECT_TRUE(corpus.text(1U, 3U).empty());
+
+    // Expect equal entries to be equal and to have the same hash.
+    EXPECT_TRUE(corpus.equal(0U, 2U));
+    EXPECT_FALSE(corpus.equal(0U, 1U));
+    EXPECT_EQ(corpus.hash(0U), corpus.hash(2U));
+
+    // Expect the last entry to be removed from all columns.
+    corpus.removeLast();
+    corpus.add({"We laughed about it.", "Wir haben darüber gelacht.", "Nous en avons ri.", "Nos reímos."});
+    ASSERT_EQ(corpus.size(), 3U);
+    EXPECT_EQ(corpus.text(2U, 0U), "We laughed about it.");
+    EXPECT_EQ(corpus.text(2U, 3U), "Nos reímos.");
+    EXPECT_EQ(corpus.text(1U, 0U), "Good luck!");
+}
+} // namespace
@@ -0,0 +1,64 @@
+/**
+ * @brief Unit test for the embedded dictionary adapter in namespace language::dictionary.
+ */
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/dictionary.h"
+#include "dictionary/embedded_adapter.h"
+#include "utils/phrase.h"
+
+namespace
+{
+using namespace language;
+
+/** Table like the ones generated by EmbedCorpus. */
+constexpr dictionary::EmbeddedPhrase kPhrases[]{
+    {{"Hello!", 6U}, {"Hallo!", 6U}},
+    {{"Good luck!", 10U}, {"Viel Gl\303\274ck!", 12U}},
+    {{"Thank you.", 10U}, {"Danke.", 6U}}};
+
+static_assert(kPhrases[1U].target.size() == 12U, "The table must be usable at compile time.");
+
+/**
+ * @brief Verify that the embedded adapter serves the table and parses the number of phrases.
+ */
+TEST(EmbeddedAdapterTest, AdapterTest)
+{
+    dictionary::EmbeddedAdapter adapter{kPhrases};
+    dictionary::Dictionary dictionary{adapter};
+    EXPECT_EQ(dictionary.phraseCount(), 3U);
+    EXPECT_EQ(dictionary.phraseCountToUse(), 3U);
+    EXPECT_EQ(dictionary.phrase(1U), (Phrase{"Good luck!", "Viel Glück!"}));
+    EXPECT_EQ(dictionary.phrases().size(), 3U);
+    EXPECT_EQ(dictionary.phrases().back(), (Phrase{"Thank you.", "Danke."}));
+
+    // Expect the first argument which isn't an option to be the number of phrases to use.
+    const char *argv[]{"LanguageGame", "--status=compact", "2", "--no-delay"};
+    dictionary::EmbeddedAdapter argumentAdapter{kPhrases, 4, argv};
+    EXPECT_EQ(argumentAdapter.phraseCountToUse(), 2U);
+    EXPECT_EQ(argumentAdapter.printIntervalMs(), 0U);
+}
+
+/**
+ * @brief Verify that annotations and duplicates are removed and that the table is escaped.
+ */
+TEST(EmbeddedAdapterTest, GenerateTest)
+{
+    const std::vector<std::string> lines{"# Greetings", "Hello!", "Hallo!", "Say \"hi\"?",
+                                         "Sag \\hi\\\t", "# Repeated", "Hello!", "Hallo!"};
+    const auto phrases{dictionary::embeddablePhrases(lines)};
+    const std::vector<Phrase> expected{{"Hello!", "Hallo!"}, {"Say \"hi\"?", "Sag \\hi\\\t"}};
+    EXPECT_EQ(phrases, expected);
+
+    std::ostringstream header{};
+    dictionary::writeEmbeddedPhrases(header, phrases, "kiosk.txt");
+    EXPECT_NE(header.str().find("    {{\"Hello!\", 6U}, {\"Hallo!\", 6U}},\n"), std::string::npos);
+    EXPECT_NE(header.str().find("    {{\"Say \\\"hi\\\"\\?\", 9U}, {\"Sag \\\\hi\\\\\\011\", 9U}},\n"),
+              std::string::npos);
+}
+} // namespace
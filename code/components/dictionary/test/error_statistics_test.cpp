@@ -0,0 +1,62 @@
+/**
+ * @brief Unit test for the statistics of error files in namespace language::dictionary.
+ */
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/error_statistics.h"
+
+namespace
+{
+using namespace language;
+
+/**
+ * @brief Write a file.
+ *
+ * @param[in] filePath Path to the file.
+ * @param[in] content The file content.
+ */
+void writeFile(const std::filesystem::path& filePath, const std::string& content)
+{
+    std::ofstream ostream{filePath, std::ios::binary};
+    ostream << content;
+}
+
+/**
+ * @brief Verify that misses are counted over all error files and the hardest phrases are ranked.
+ */
+TEST(ErrorStatisticsTest, HardestTest)
+{
+    const std::filesystem::path directory{"error_statistics"};
+    std::filesystem::create_directory(directory);
+    writeFile(directory / "errors1.txt", "Hello!\nHallo!\n\nThank you.\nDanke.\n\n");
+    writeFile(directory / "errors2.txt", "\xEF\xBB\xBFThank you.  \r\nDanke.\r\n\r\nGood night.\nGute Nacht.\n");
+    writeFile(directory / "errors3.txt", "Good night.\nGute Nacht.\n\n\n\nThank you.\nDanke.");
+
+    // Expect other files to be ignored.
+    writeFile(directory / "errors.txt", "Hello!\nHallo!\n\n");
+    writeFile(directory / "errors4.txt.bak", "Hello!\nHallo!\n\n");
+    writeFile(directory / "phrases.txt", "Hello!\nHallo!\n\n");
+
+    dictionary::ErrorStatistics statistics{2U};
+    ASSERT_TRUE(statistics.scan(directory.string()));
+    EXPECT_EQ(statistics.fileCount(), 3U);
+    EXPECT_EQ(statistics.missCount(), 6U);
+    EXPECT_EQ(statistics.phraseCount(), 3U);
+
+    const auto hardest{statistics.hardest(2U)};
+    ASSERT_EQ(hardest.size(), 2U);
+    EXPECT_EQ(hardest[0U].phrase, (Phrase{"Thank you.", "Danke."}));
+    EXPECT_EQ(hardest[0U].missCount, 3U);
+    EXPECT_EQ(hardest[1U].phrase, (Phrase{"Good night.", "Gute Nacht."}));
+    EXPECT_EQ(hardest[1U].missCount, 2U);
+    EXPECT_EQ(statistics.hardest(10U).size(), 3U);
+
+    // Expect scanning to fail for a missing directory.
+    EXPECT_FALSE(statistics.scan("missing_directory"));
+    std::filesystem::remove_all(directory);
+}
+} // namespace
@@ -0,0 +1,68 @@
+/**
+ * @brief Unit test for near-duplicate detection in namespace language::dictionary.
+ */
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/near_duplicates.h"
+#include "utils/phrase.h"
+
+namespace 
+{
+using namespace language;
+
+/**
+ * @brief Verify that phrases differing by punctuation, spacing or a single word are clustered.
+ */
+TEST(NearDuplicateTest, ClusterTest) 
+{
+    std::list<Phrase> phrases{
+        {"I hope it will be a great aid to you.", "Ich hoffe, es wird dir eine grosse Hilfe sein."},
+        {"Please enter your answer.", "Bitte gib deine Antwort ein."},
+        {"I hope it will be a great aid to you", "Ich hoffe es wird dir eine grosse Hilfe sein"},
+        {"The frog tries to hop away.", "Der Frosch versucht weg zuhüpfen."},
+        {"Please  enter your answer!", "Bitte gib  deine Antwort ein!"},
+        {"The frog tries to hop away quickly.", "Der Frosch versucht schnell weg zuhüpfen."},
+        {"Good luck and have fun!", "Viel Glück und viel Spass!"}};
+
+    const auto clusters{dictionary::findNearDuplicates(phrases, 0.6, 2U)};
+    const std::vector<dictionary::Cluster> expected{{0U, 2U}, {1U, 4U}, {3U, 5U}};
+    EXPECT_EQ(clusters, expected);
+
+    // Expect only the first phrase of each cluster to remain after merging.
+    EXPECT_EQ(dictionary::mergeNearDuplicates(phrases, clusters), 3U);
+    const std::list<Phrase> expectedPhrases{
+        {"I hope it will be a great aid to you.", "Ich hoffe, es wird dir eine grosse Hilfe sein."},
+        {"Please enter your answer.", "Bitte gib deine Antwort ein."},
+        {"The frog tries to hop away.", "Der Frosch versucht weg zuhüpfen."},
+        {"Good luck and have fun!", "Viel Glück und viel Spass!"}};
+    EXPECT_EQ(phrases, expectedPhrases);
+}
+
+/**
+ * @brief Verify that distinct phrases aren't clustered.
+ */
+TEST(NearDuplicateTest, DistinctTest) 
+{
+    std::list<Phrase> phrases{};
+    std::uint32_t seed{12345U};
+
+    // Generate phrases of pseudo-random words.
+    auto randomWords = [&seed]()
+    {
+        std::string words{};
+        for (std::size_t i{}; i < 24U; ++i)
+        {
+            seed = seed * 1103515245U + 12345U;
+            words.push_back(0U == i % 6U ? ' ' : static_cast<char>('a' + (seed >> 16U) % 26U));
+        }
+        return words;
+    };
+    for (std::size_t i{}; i < 5000U; ++i) { phrases.push_back(Phrase{randomWords(), randomWords()}); }
+    EXPECT_TRUE(dictionary::findNearDuplicates(phrases, 0.9).empty());
+}
+} // namespace
@@ -0,0 +1,171 @@
+/**
+ * @brief Unit test for class language::dictionary::ShardedAdapter.
+ */
+#include <csignal>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/sharded_adapter.h"
+#include "utils/phrase.h"
+
+namespace
+{
+using namespace language;
+
+// -----------------------------------------------------------------------------
+void writePhrasesToFile(const std::string &filePath, const std::list<Phrase> &phrases)
+{
+    std::ofstream ostream{filePath};
+    for (const auto &phrase : phrases) { ostream << phrase.primary << "\n" << phrase.target << "\n\n"; }
+}
+
+// -----------------------------------------------------------------------------
+std::string readFile(const std::string &filePath)
+{
+    std::ifstream istream{filePath};
+    return std::string{std::istreambuf_iterator<char>{istream}, std::istreambuf_iterator<char>{}};
+}
+
+// -----------------------------------------------------------------------------
+std::vector<pid_t> childProcesses()
+{
+    // The parent is the fourth field of the process status, after the name in parentheses.
+    std::vector<pid_t> processes{};
+    for (const auto &entry : std::filesystem::directory_iterator{"/proc"})
+    {
+        const auto name{entry.path().filename().string()};
+        if (std::string::npos != name.find_first_not_of("0123456789")) { continue; }
+        const auto status{readFile((entry.path() / "stat").string())};
+        const auto nameEnd{status.rfind(')')};
+        if (std::string::npos == nameEnd) { continue; }
+        std::istringstream fields{status.substr(nameEnd + 1U)};
+        std::string state{};
+        pid_t parent{};
+        if ((fields >> state >> parent) && (::getpid() == parent))
+        {
+            processes.push_back(static_cast<pid_t>(std::stoi(name)));
+        }
+    }
+    return processes;
+}
+
+/** Phrases of the tests, the last two are duplicates of earlier phrases. */
+const std::list<Phrase> kPhrases{
+    {"Welcome to my C++ language game.", "Willkommen zu meinem C++ Sprachspiel."},
+    {"I hope it will be a great aid to you.", "Ich hoffe, es wird dir eine grosse Hilfe sein."},
+    {"Please enter your answer.", "Bitte gib deine Antwort ein."},
+    {"Good luck and have fun!", "Viel Glück und viel Spass!"},
+    {"Don't hesitate to ask me for help.", "Zögern Sie nicht, mich um Hilfe zu bitten."},
+    {"The frog tries to hop away.", "Der Frosch versucht weg zuhüpfen."},
+    {"Please enter your answer.", "Bitte gib deine Antwort ein."},
+    {"Welcome to my C++ language game.", "Willkommen zu meinem C++ Sprachspiel."}};
+
+/** The number of unique phrases of the tests. */
+constexpr std::size_t kUniquePhraseCount{6U};
+
+/**
+ * @brief Verify that the phrases are partitioned across the shards without duplicates, and that
+ *        each phrase is served by the worker owning it.
+ */
+TEST(ShardedAdapterTest, FileTest)
+{
+    constexpr const char *filePath{"sharded_phrases.txt"};
+    writePhrasesToFile(filePath, kPhrases);
+    const auto fileContent{readFile(filePath)};
+    {
+        dictionary::ShardedAdapter adapter{filePath, 3U};
+        ASSERT_EQ(adapter.shardCount(), 3U);
+        EXPECT_EQ(adapter.phraseCount(), kUniquePhraseCount);
+        EXPECT_EQ(adapter.phraseCountToUse(), kUniquePhraseCount);
+        EXPECT_EQ(adapter.shardPhraseCount(0U) + adapter.shardPhraseCount(1U) + adapter.shardPhraseCount(2U),
+                  kUniquePhraseCount);
+
+        // Expect each unique phrase exactly once, and the list to hold the phrases in index order.
+        std::unordered_set<Phrase, PhraseHash> phrases{};
+        std::list<Phrase> indexedPhrases{};
+        for (std::size_t i{}; i < adapter.phraseCount(); ++i)
+        {
+            phrases.insert(adapter.phrase(i));
+            indexedPhrases.push_back(adapter.phrase(i));
+        }
+        EXPECT_EQ(phrases, (std::unordered_set<Phrase, PhraseHash>{kPhrases.begin(), kPhrases.end()}));
+        EXPECT_EQ(adapter.phrases(), indexedPhrases);
+    }
+
+    // Expect the file not to be rewritten, even though it contains duplicates.
+    EXPECT_EQ(readFile(filePath), fileContent);
+    std::remove(filePath);
+}
+
+/**
+ * @brief Verify that the adapter takes the arguments of the file-based adapter and the number
+ *        of shards, and that tokenized shards serve the same phrases.
+ */
+TEST(ShardedAdapterTest, ArgumentTest)
+{
+    constexpr const char *filePath{"sharded_phrases.txt"};
+    writePhrasesToFile(filePath, kPhrases);
+
+    const char *argv[]{"LanguageGame", filePath, "2", "--shards=2", "--tokenize", "--no-delay"};
+    dictionary::ShardedAdapter adapter{6, argv};
+    EXPECT_EQ(adapter.shardCount(), 2U);
+    EXPECT_EQ(adapter.phraseCount(), kUniquePhraseCount);
+    EXPECT_EQ(adapter.phraseCountToUse(), 2U);
+    EXPECT_EQ(adapter.printIntervalMs(), 0U);
+    EXPECT_EQ(adapter.tokenizedPhrases(), nullptr);
+
+    const std::unordered_set<Phrase, PhraseHash> phrases{adapter.phrases().begin(), adapter.phrases().end()};
+    EXPECT_EQ(phrases, (std::unordered_set<Phrase, PhraseHash>{kPhrases.begin(), kPhrases.end()}));
+    std::remove(filePath);
+
+    // Expect no shards if the file doesn't exist.
+    dictionary::ShardedAdapter missingAdapter{"missing_phrases.txt", 2U};
+    EXPECT_EQ(missingAdapter.shardCount(), 0U);
+    EXPECT_EQ(missingAdapter.phraseCount(), 0U);
+}
+/**
+ * @brief Verify that ranges of phrases are fetched across shards like single phrases, and that
+ *        the adapter is marked as failed once its workers have ended.
+ */
+TEST(ShardedAdapterTest, RangeTest)
+{
+    constexpr const char *filePath{"sharded_phrases.txt"};
+    writePhrasesToFile(filePath, kPhrases);
+    dictionary::ShardedAdapter adapter{filePath, 3U};
+    std::remove(filePath);
+    ASSERT_EQ(adapter.phraseCount(), kUniquePhraseCount);
+
+    std::vector<Phrase> indexedPhrases{};
+    for (std::size_t i{}; i < adapter.phraseCount(); ++i) { indexedPhrases.push_back(adapter.phrase(i)); }
+    for (std::size_t first{}; first <= adapter.phraseCount(); ++first)
+    {
+        // Expect the range to be cut at the end of the dictionary.
+        std::vector<Phrase> phrases{};
+        ASSERT_TRUE(adapter.phrases(first, adapter.phraseCount(), phrases));
+        EXPECT_EQ(phrases, (std::vector<Phrase>{indexedPhrases.begin() + first, indexedPhrases.end()}));
+    }
+    EXPECT_FALSE(adapter.failed());
+
+    // Expect failed lookups once the workers have ended.
+    const auto workers{childProcesses()};
+    ASSERT_EQ(workers.size(), 3U);
+    for (const auto worker : workers) { ::kill(worker, SIGKILL); }
+
+    std::vector<Phrase> phrases{};
+    EXPECT_FALSE(adapter.phrases(0U, adapter.phraseCount(), phrases));
+    EXPECT_TRUE(adapter.failed());
+    EXPECT_EQ(adapter.phrase(0U), Phrase{});
+}
+} // namespace
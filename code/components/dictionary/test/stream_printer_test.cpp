@@ -0,0 +1,105 @@
+/**
+ * @brief Unit test for class language::dictionary::StreamPrinter.
+ */
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/stream_printer.h"
+#include "utils/phrase.h"
+
+namespace 
+{
+using namespace language;
+
+// -----------------------------------------------------------------------------
+void writePhrasesToFile(const std::string &filePath, const std::list<Phrase> &phrases)
+{
+    // Open the file for writing.
+    std::ofstream ostream{filePath};
+    if (!ostream) { return; }
+
+    // Write each phrase pair to the file, separated by a blank line.
+    for (const auto &phrase : phrases)
+    {
+        ostream << phrase.primary << "\n" << phrase.target << "\n\n";
+    }
+}
+
+/**
+ * @brief Verify that phrases are streamed from the file without delay.
+ */
+TEST(StreamPrinterTest, NoDelayTest) 
+{
+    // Define phrases for the test.
+    const std::list<Phrase> phrases{
+        {"Welcome to my C++ language game.", "Willkommen zu meinem C++ Sprachspiel."},
+        {"Please enter your answer.", "Bitte gib deine Antwort ein."},
+        {"Good luck and have fun!", "Viel Glück und viel Spass!"}};
+
+    // Write the phrases to the file at path 'stream.txt'.
+    constexpr const char *filePath{"stream.txt"};
+    writePhrasesToFile(filePath, phrases);
+
+    // Create printer, limit the number of phrases to print to two.
+    const std::vector<const char *> args{"./PhrasePrinter", filePath, "2", "--no-delay"};
+    dictionary::StreamPrinter printer{static_cast<int>(args.size()), 
+                                      const_cast<const char **>(args.data())};
+    std::ostringstream ostream{};
+
+    // Expect the first two phrases to be printed.
+    EXPECT_TRUE(printer.print(ostream));
+    EXPECT_EQ(printer.printedPhraseCount(), 2U);
+    EXPECT_EQ(ostream.str(), "Welcome to my C++ language game.\nWillkommen zu meinem C++ Sprachspiel."
+                             "\n\nPlease enter your answer.\nBitte gib deine Antwort ein.\n\n");
+    std::remove(filePath);
+}
+
+/**
+ * @brief Verify that duplicates are skipped when the dedupe is enabled.
+ */
+TEST(StreamPrinterTest, DedupeTest) 
+{
+    // Define phrases for the test.
+    const std::list<Phrase> phrases{
+        {"Welcome to my C++ language game.", "Willkommen zu meinem C++ Sprachspiel."},
+        {"Please enter your answer.", "Bitte gib deine Antwort ein."},
+        {"Welcome to my C++ language game.", "Willkommen zu meinem C++ Sprachspiel."},
+        {"Good luck and have fun!", "Viel Glück und viel Spass!"},
+        {"Please enter your answer.", "Bitte gib deine Antwort ein."}};
+
+    // Write the phrases to the file at path 'stream.txt'.
+    constexpr const char *filePath{"stream.txt"};
+    writePhrasesToFile(filePath, phrases);
+
+    // Create printer with a 1 MB dedupe filter.
+    const std::vector<const char *> args{"./PhrasePrinter", filePath, "--no-delay", "--dedupe=1"};
+    dictionary::StreamPrinter printer{static_cast<int>(args.size()), 
+                                      const_cast<const char **>(args.data())};
+    std::ostringstream ostream{};
+
+    // Expect the unique phrases to be printed and the duplicates to be skipped.
+    EXPECT_TRUE(printer.print(ostream));
+    EXPECT_EQ(printer.printedPhraseCount(), 3U);
+    EXPECT_EQ(printer.skippedPhraseCount(), 2U);
+    std::remove(filePath);
+}
+
+/**
+ * @brief Verify that printing fails if the file doesn't exist.
+ */
+TEST(StreamPrinterTest, MissingFileTest) 
+{
+    const std::vector<const char *> args{"./PhrasePrinter", "missing.txt", "--no-delay"};
+    dictionary::StreamPrinter printer{static_cast<int>(args.size()), 
+                                      const_cast<const char **>(args.data())};
+    std::ostringstream ostream{};
+    EXPECT_FALSE(printer.print(ostream));
+    EXPECT_TRUE(ostream.str().empty());
+}
+} // namespace
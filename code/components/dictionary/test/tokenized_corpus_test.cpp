@@ -0,0 +1,78 @@
+/**
+ * @brief Unit test for class language::dictionary::TokenizedCorpus.
+ */
+#include <list>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/tokenized_corpus.h"
+#include "utils/phrase.h"
+#include "utils/vocabulary.h"
+
+namespace 
+{
+using namespace language;
+
+/**
+ * @brief Verify that phrases are rebuilt exactly from their token IDs.
+ */
+TEST(TokenizedCorpusTest, RebuildTest) 
+{
+    const std::list<Phrase> phrases{
+        {"Welcome to my C++ language game.", "Willkommen zu meinem C++ Sprachspiel."},
+        {"Please  enter your answer. ", " Bitte gib deine Antwort ein."},
+        {"", "Viel Glück und viel Spass!"},
+        {"Good luck and have fun!", "x"}};
+
+    const dictionary::TokenizedCorpus corpus{phrases};
+    ASSERT_EQ(corpus.size(), phrases.size());
+
+    // Expect each phrase to be rebuilt exactly, including repeated, leading and trailing spaces.
+    std::size_t i{};
+    for (const auto &phrase : phrases) { EXPECT_EQ(corpus.phrase(i++), phrase); }
+    EXPECT_TRUE(corpus.tokens(2U, dictionary::TokenizedCorpus::kPrimaryColumn).empty());
+}
+
+/**
+ * @brief Verify that equal words share one token ID, also between corpora.
+ */
+TEST(TokenizedCorpusTest, VocabularyTest) 
+{
+    auto vocabulary{std::make_shared<utils::Vocabulary>()};
+    dictionary::TokenizedCorpus first{vocabulary}, second{vocabulary};
+    first.add({"the frog and the stork", "der Frosch und der Storch"});
+    second.add({"the stork", "der Storch"});
+
+    constexpr auto primary{dictionary::TokenizedCorpus::kPrimaryColumn};
+    constexpr auto target{dictionary::TokenizedCorpus::kTargetColumn};
+    const auto tokens{first.tokens(0U, primary)};
+    ASSERT_EQ(tokens.size(), 5U);
+    EXPECT_EQ(tokens[0U], tokens[3U]);
+    EXPECT_EQ(vocabulary->word(tokens[1U]), "frog");
+    EXPECT_EQ(vocabulary->find("stork"), tokens[4U]);
+    EXPECT_EQ(vocabulary->find("hop"), utils::Vocabulary::kUnknownToken);
+
+    // Expect the second corpus to reuse the token IDs of the first corpus.
+    EXPECT_EQ(second.tokens(0U, primary)[1U], tokens[4U]);
+    EXPECT_EQ(second.tokens(0U, target)[0U], first.tokens(0U, target)[0U]);
+    EXPECT_EQ(vocabulary->size(), 8U);
+}
+/**
+ * @brief Verify that empty words from leading or repeated spaces can be the first words interned.
+ */
+TEST(TokenizedCorpusTest, EmptyFirstWordTest) 
+{
+    const std::list<Phrase> phrases{
+        {" Guten Tag", "Good  day"},
+        {"Hallo", " Hello  "}};
+
+    const dictionary::TokenizedCorpus corpus{phrases};
+    ASSERT_EQ(corpus.size(), phrases.size());
+
+    std::size_t i{};
+    for (const auto &phrase : phrases) { EXPECT_EQ(corpus.phrase(i++), phrase); }
+    EXPECT_EQ(corpus.vocabulary().word(corpus.tokens(0U, dictionary::TokenizedCorpus::kPrimaryColumn)[0U]), "");
+}
+} // namespace
@@ -0,0 +1,27 @@
+/**
+ * @brief Shard worker of language::dictionary::ShardedAdapter.
+ *
+ *        The worker is spawned by the sharded adapter with its socket as standard input, and
+ *        with option --tokenize to store the phrases as token IDs. It's not meant to be run
+ *        from the terminal.
+ */
+#include <cstring>
+
+#include <unistd.h>
+
+#include "shard_worker.h"
+
+using namespace language;
+
+/**
+ * @brief Serve the shard of the coordinator connected to standard input.
+ *
+ * @param argc  Number of input arguments from the spawning coordinator.
+ * @param argv  Vector of input arguments from the spawning coordinator.
+ * @return      Return 0 once the coordinator closed the socket, else return 1.
+ */
+int main(const int argc, const char** argv) 
+{
+    const bool tokenize{(2 == argc) && (0 == std::strcmp(argv[1], "--tokenize"))};
+    return dictionary::runShardWorker(STDIN_FILENO, tokenize);
+}
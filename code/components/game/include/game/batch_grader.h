@@ -0,0 +1,140 @@
+/**
+ * @brief Offline grading of exported answer sheets.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace language
+{
+namespace dictionary
+{
+/** Dictionary implementation. */
+class Dictionary;
+} // namespace dictionary
+
+namespace game
+{
+/**
+ * @brief Statistics of the answers given for one phrase.
+ */
+struct PhraseStatistics
+{
+    /** The number of answers. */
+    std::uint64_t answerCount{};
+
+    /** The number of correct answers. */
+    std::uint64_t correctCount{};
+
+    /** The number of answer words missing in wrong answers. */
+    std::uint64_t missingWordCount{};
+
+    /** The number of extra words in wrong answers. */
+    std::uint64_t extraWordCount{};
+
+    /** The number of words at the wrong position in wrong answers. */
+    std::uint64_t swappedWordCount{};
+
+    /** The number of misspelled words in wrong answers. */
+    std::uint64_t misspelledWordCount{};
+
+    /**
+     * @brief Add the statistics of other answers.
+     *
+     * @param[in] other Statistics to add.
+     *
+     * @return Reference to these statistics.
+     */
+    PhraseStatistics &operator+=(const PhraseStatistics &other) noexcept;
+};
+
+/**
+ * @brief Grader of answer files with the same rules as the game, on a work-stealing thread pool.
+ *
+ *        Answer files hold one answer per row, with the phrase ID in the first field and the
+ *        guess in the second field. Phrase IDs are the positions of the phrases in the
+ *        dictionary, counted from 1. Files are read as CSV or JSON Lines if their extension
+ *        says so, otherwise as tab-separated values. Rows are read in batches while earlier
+ *        batches are graded, so memory usage doesn't depend on the file size.
+ */
+class BatchGrader final
+{
+public:
+    /** The number of rows graded per task. */
+    static constexpr std::size_t kBatchSize{4096U};
+
+    /**
+     * @brief Create grader, the expected answers are prepared once.
+     *
+     * @param[in] dictionary The phrases the answers refer to.
+     * @param[in] reverse Grade translations from the target to the primary language.
+     * @param[in] threadCount The number of grading threads, 0 to use one per core (default = 0).
+     */
+    BatchGrader(const dictionary::Dictionary &dictionary, bool reverse, std::size_t threadCount = 0U);
+
+    /**
+     * @brief Grade all answers of a file and add them to the statistics.
+     *
+     * @param[in] filePath Path to the answer file.
+     * @param[in] skipHeader Skip the first row of the file.
+     *
+     * @return True if the file was read, else false.
+     */
+    bool grade(const std::string &filePath, bool skipHeader);
+
+    /**
+     * @brief Get the statistics of all phrases.
+     *
+     * @return The statistics by phrase index, i.e. phrase ID - 1.
+     */
+    const std::vector<PhraseStatistics> &statistics() const noexcept;
+
+    /**
+     * @brief Get the number of graded answers.
+     *
+     * @return The number of answers.
+     */
+    std::uint64_t answerCount() const noexcept;
+
+    /**
+     * @brief Get the number of rows skipped due to an invalid phrase ID.
+     *
+     * @return The number of skipped rows.
+     */
+    std::uint64_t invalidRowCount() const noexcept;
+
+    /**
+     * @brief Write the statistics of all answered phrases as tab-separated values with a header.
+     *
+     * @param[in] ostream The stream to write to.
+     */
+    void write(std::ostream &ostream) const;
+
+    BatchGrader()                                = delete; // No default constructor.
+    BatchGrader(const BatchGrader &)             = delete; // No copy constructor.
+    BatchGrader(BatchGrader &&)                  = delete; // No move constructor.
+    BatchGrader & operator=(const BatchGrader &) = delete; // No copy assignment.
+    BatchGrader & operator=(BatchGrader &&)      = delete; // No move assignment.
+
+private:
+    /** Expected answers by phrase index. */
+    std::vector<std::string> myAnswers;
+
+    /** Statistics by phrase index. */
+    std::vector<PhraseStatistics> myStatistics;
+
+    /** The number of grading threads. */
+    std::size_t myThreadCount;
+
+    /** The number of graded answers. */
+    std::uint64_t myAnswerCount;
+
+    /** The number of rows skipped due to an invalid phrase ID. */
+    std::uint64_t myInvalidRowCount;
+};
+} // namespace game
+} // namespace language
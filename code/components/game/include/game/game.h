@@ -5,6 +5,8 @@
 
 #include <memory>
 
+#include "game/options.h"
+
 namespace language
 {
 namespace dictionary
@@ -28,8 +30,9 @@ public:
      * @brief Create language game.
      *
      * @param[in] adapter Adapter providing information about the phrases to load.
+     * @param[in] options Game options (default = default options).
      */
-    explicit Game(dictionary::AdapterInterface &dictionaryAdapter);
+    explicit Game(dictionary::AdapterInterface &dictionaryAdapter, const Options &options = {});
 
     /**
      * @brief Delete game.
@@ -0,0 +1,46 @@
+/**
+ * @brief Rules for grading answers in language game.
+ */
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace game
+{
+/**
+ * @brief Remove additional phrase info, i.e. everything from the first opening parenthesis,
+ *        as well as the whitespaces preceding it.
+ *
+ *        For example, "gehen (ging, gegangen)" becomes "gehen".
+ *
+ * @param[in,out] str The phrase to remove the additional info from.
+ */
+void removeAdditionalPhraseInfo(std::string &str);
+
+/**
+ * @brief Get the answer expected for a phrase, without additional phrase info.
+ *
+ * @param[in] phrase The phrase to translate.
+ * @param[in] reverse Translate from the target to the primary language.
+ *
+ * @return The expected answer.
+ */
+std::string expectedAnswer(const Phrase &phrase, bool reverse);
+
+/**
+ * @brief Check if a guess matches the expected answer, trailing whitespaces of the guess are
+ *        ignored.
+ *
+ * @param[in] guess The guess.
+ * @param[in] answer The expected answer, see expectedAnswer().
+ *
+ * @return True if the guess is correct, else false.
+ */
+bool isCorrect(std::string_view guess, std::string_view answer) noexcept;
+} // namespace game
+} // namespace language
@@ -0,0 +1,97 @@
+/**
+ * @brief Options for language game.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace language
+{
+namespace game
+{
+/**
+ * @brief Enumeration of modes for printing the current status between prompts.
+ */
+enum class StatusMode
+{
+    /** Print the status as a table, one counter per line. */
+    Full,
+
+    /** Print the status on a single line. */
+    Compact,
+
+    /** Don't print the status between prompts. */
+    Quiet,
+};
+
+/**
+ * @brief Struct holding options for the translation game.
+ */
+struct Options
+{
+    /** Mode for printing the current status between prompts. */
+    StatusMode statusMode{StatusMode::Full};
+
+    /** The number of answer options in multiple-choice mode, 0 disables multiple-choice mode. */
+    std::size_t choiceCount{0U};
+
+    /** Time limit per prompt in timed mode, 0 disables the limit. */
+    std::chrono::seconds promptTimeLimit{0};
+
+    /** Time limit per round in timed mode, 0 disables the limit. */
+    std::chrono::seconds roundTimeLimit{0};
+
+    /** Path to the file the session is saved to after each answer, empty to disable. */
+    std::string checkpointPath{};
+
+    /** Indicate whether to resume the session saved in the checkpoint file. */
+    bool resume{false};
+
+    /** Seed of the random generator, which selects and orders the phrases, the time if unset. */
+    std::optional<unsigned> seed{};
+
+    /** Path to the file the session is recorded to, empty to disable. */
+    std::string recordPath{};
+
+    /** Indicate whether to write incorrectly guessed phrases to an error file after each round. */
+    bool writeErrorFiles{true};
+
+    /**
+     * @brief Check if the game is played in timed mode.
+     *
+     * @return True if prompts or rounds are limited in time, else false.
+     */
+    bool timed() const noexcept 
+    { 
+        return (0 < promptTimeLimit.count()) || (0 < roundTimeLimit.count()); 
+    }
+};
+
+/**
+ * @brief Parse game options from the command line.
+ *
+ *        The following options are supported:
+ *        --status=full|compact|quiet   Set the status mode (default = full).
+ *        --choices[=<count>]           Play in multiple-choice mode with the given number 
+ *                                      of answer options (default = 4).
+ *        --timed[=<seconds>]           Limit the time per prompt (default = 10 seconds), 
+ *                                      unanswered prompts count as errors.
+ *        --round-time=<seconds>        Limit the time per round, the round ends when it's up.
+ *        --checkpoint[=<file>]         Save the session after each answer 
+ *                                      (default = session.checkpoint).
+ *        --resume[=<file>]             Resume the session saved in the checkpoint file and 
+ *                                      keep saving it (default = session.checkpoint).
+ *        --seed=<number>               Seed the random generator to repeat a session.
+ *        --record=<file>               Record the session to replay it with SessionReplay.
+ *
+ * @param[in] argc The number of input arguments entered from the terminal at runtime.
+ * @param[in] argv Vector storing all input arguments entered from the terminal at runtime.
+ *
+ * @return The parsed options, default values are used for options that haven't been entered.
+ */
+Options parseOptions(int argc, const char **argv);
+} // namespace game
+} // namespace language
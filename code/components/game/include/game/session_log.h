@@ -0,0 +1,142 @@
+/**
+ * @brief Recording of game sessions, to replay them e.g. as performance regression tests.
+ */
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "game/options.h"
+
+namespace language
+{
+namespace game
+{
+/**
+ * @brief Enumeration of input events.
+ */
+enum class InputEventType : unsigned char
+{
+    /** A line was entered. */
+    Line,
+
+    /** No line was entered before the deadline of the prompt. */
+    Timeout,
+
+    /** The input was closed. */
+    Closed,
+};
+
+/**
+ * @brief Input received by the game.
+ */
+struct InputEvent
+{
+    /** Time since the previous event, or since the start of the session, in microseconds. */
+    std::uint64_t delay{};
+
+    /** Type of the event. */
+    InputEventType type{InputEventType::Line};
+
+    /** The entered line, empty for other events. */
+    std::string line{};
+};
+
+/**
+ * @brief Everything needed to repeat a session besides its input.
+ */
+struct SessionHeader
+{
+    /** Seed of the random generator, which selects and orders the phrases. */
+    unsigned seed{};
+
+    /** Hash over all phrases of the dictionary. */
+    std::uint64_t corpusFingerprint{};
+
+    /** The number of phrases in the dictionary. */
+    std::uint64_t phraseCount{};
+
+    /** The number of phrases to play. */
+    std::uint64_t phraseCountToUse{};
+
+    /** Indicate whether the session started in reverse. */
+    bool reverse{};
+
+    /** Game options, only the status mode, the answer choices and the time limits are recorded. */
+    Options options{};
+};
+
+/**
+ * @brief Recorded session.
+ */
+struct SessionLog
+{
+    /** Session settings. */
+    SessionHeader header{};
+
+    /** Input events in the order they were received. */
+    std::vector<InputEvent> events{};
+};
+
+/**
+ * @brief Read a recorded session.
+ *
+ *        A log cut off within the last event, e.g. because the game crashed, is read up to the
+ *        last complete event.
+ *
+ * @param[in] path Path to the log file.
+ * @param[out] log The recorded session.
+ *
+ * @return True if the log was read, else false.
+ */
+bool readSessionLog(const std::string &path, SessionLog &log);
+
+/**
+ * @brief Recorder of a session into a binary log.
+ *
+ *        The header is followed by one entry per event: its type, its delay and the line, with
+ *        variable-length integers. Each event is written as soon as it's recorded, so that the
+ *        log is complete up to the last input if the game crashes.
+ */
+class SessionRecorder final
+{
+public:
+    /**
+     * @brief Create recorder and write the header of the log.
+     *
+     * @param[in] path Path to the log file, which is replaced.
+     * @param[in] header Session settings.
+     */
+    SessionRecorder(const std::string &path, const SessionHeader &header);
+
+    /**
+     * @brief Check if the log file could be opened.
+     *
+     * @return True if events are recorded, else false.
+     */
+    bool good() const noexcept;
+
+    /**
+     * @brief Record an input event.
+     *
+     * @param[in] event The event.
+     */
+    void record(const InputEvent &event);
+
+    SessionRecorder()                                    = delete; // No default constructor.
+    SessionRecorder(const SessionRecorder &)             = delete; // No copy constructor.
+    SessionRecorder(SessionRecorder &&)                  = delete; // No move constructor.
+    SessionRecorder & operator=(const SessionRecorder &) = delete; // No copy assignment.
+    SessionRecorder & operator=(SessionRecorder &&)      = delete; // No move assignment.
+
+private:
+    /** Stream writing the log. */
+    std::ofstream myOstream;
+
+    /** Buffer an event is encoded into before it's written. */
+    std::string myBuffer;
+};
+} // namespace game
+} // namespace language
@@ -0,0 +1,102 @@
+/**
+ * @brief Replay of recorded game sessions.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "game/session_log.h"
+
+namespace language
+{
+namespace dictionary
+{
+class AdapterInterface;
+} // namespace dictionary
+
+namespace game
+{
+/**
+ * @brief Enumeration of replay results.
+ */
+enum class ReplayResult
+{
+    /** The session was replayed and all events were consumed. */
+    Replayed,
+
+    /** The session was replayed, but the game ended before all events were consumed or asked for more. */
+    Diverged,
+
+    /** The phrases differ from the phrases of the recorded session. */
+    PhrasesChanged,
+};
+
+/**
+ * @brief Replayer of a recorded session, feeding the recorded input to the game without the
+ *        terminal and measuring the time the game spends on each event.
+ *
+ *        The game is seeded like the recorded session and its clock only advances by the
+ *        recorded delays, so it takes the same path: the same phrases in the same order,
+ *        timeouts and time limits hit at the same prompts. Events are fed as soon as the game
+ *        waits for input.
+ */
+class SessionReplayer final
+{
+public:
+    /**
+     * @brief Create replayer.
+     *
+     * @param[in] dictionaryAdapter Adapter providing the phrases, loaded like for the recorded
+     *                              session, with its number of phrases to play.
+     * @param[in] log The recorded session.
+     */
+    SessionReplayer(dictionary::AdapterInterface &dictionaryAdapter, const SessionLog &log);
+
+    /**
+     * @brief Replay the session.
+     *
+     * @param[in] ostream Stream to write the output of the game to.
+     *
+     * @return The result of the replay.
+     */
+    ReplayResult replay(std::ostream &ostream);
+
+    /**
+     * @brief Get the time spent by the game before the first event, i.e. preparing the session.
+     *
+     * @return The time in nanoseconds.
+     */
+    std::uint64_t setupTime() const noexcept;
+
+    /**
+     * @brief Get the time spent by the game processing each event, until it waited for the next
+     *        event or ended.
+     *
+     * @return The times in nanoseconds, one per consumed event.
+     */
+    const std::vector<std::uint64_t> &engineTimes() const noexcept;
+
+    SessionReplayer()                                    = delete; // No default constructor.
+    SessionReplayer(const SessionReplayer &)             = delete; // No copy constructor.
+    SessionReplayer(SessionReplayer &&)                  = delete; // No move constructor.
+    SessionReplayer & operator=(const SessionReplayer &) = delete; // No copy assignment.
+    SessionReplayer & operator=(SessionReplayer &&)      = delete; // No move assignment.
+
+private:
+    /** Adapter providing the phrases. */
+    dictionary::AdapterInterface &myAdapter;
+
+    /** The recorded session. */
+    const SessionLog &myLog;
+
+    /** Time spent before the first event, in nanoseconds. */
+    std::uint64_t mySetupTime;
+
+    /** Time spent processing each event, in nanoseconds. */
+    std::vector<std::uint64_t> myEngineTimes;
+};
+} // namespace game
+} // namespace language
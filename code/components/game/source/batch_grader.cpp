@@ -0,0 +1,229 @@
+/**
+ * @brief Implementation details of class language::game::BatchGrader.
+ */
+#include <charconv>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "dictionary/dictionary.h"
+#include "game/batch_grader.h"
+#include "game/grading.h"
+#include "utils/record_reader.h"
+#include "utils/utils.h"
+#include "utils/word_alignment.h"
+#include "utils/work_stealing_pool.h"
+
+namespace language
+{
+namespace game
+{
+namespace
+{
+/** The maximum number of batches read ahead per grading thread. */
+constexpr std::size_t kBatchesPerThread{4U};
+
+/**
+ * @brief Answer read from a row of an answer file.
+ */
+struct Answer
+{
+    /** Index of the phrase. */
+    std::size_t phraseIndex;
+
+    /** The guess. */
+    std::string guess;
+};
+
+/** Batch of answers graded by one task. */
+using Batch = std::vector<Answer>;
+
+/** Statistics accumulated by one thread, by phrase index. */
+using ThreadStatistics = std::unordered_map<std::size_t, PhraseStatistics>;
+
+// ---------------------------------------------------------------------------
+bool parsePhraseId(const std::string &field, const std::size_t phraseCount, std::size_t &phraseIndex) noexcept
+{
+    std::size_t id{};
+    const auto *last{field.data() + field.size()};
+    const auto result{std::from_chars(field.data(), last, id)};
+    if ((std::errc{} != result.ec) || (last != result.ptr) || (0U == id) || (phraseCount < id)) { return false; }
+    phraseIndex = id - 1U;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+void gradeBatch(Batch &batch, const std::vector<std::string> &answers, ThreadStatistics &statistics)
+{
+    for (auto &answer : batch)
+    {
+        auto &phraseStatistics{statistics[answer.phraseIndex]};
+        const auto &expected{answers[answer.phraseIndex]};
+        ++phraseStatistics.answerCount;
+        if (isCorrect(answer.guess, expected)) 
+        { 
+            ++phraseStatistics.correctCount; 
+            continue;
+        }
+
+        // Analyze the error the way the game does.
+        utils::removeTrailingWhitespaces(answer.guess);
+        for (const auto &difference : utils::alignWords(answer.guess, expected))
+        {
+            switch (difference.type)
+            {
+                case utils::WordDifference::Type::Missing:    ++phraseStatistics.missingWordCount; break;
+                case utils::WordDifference::Type::Extra:      ++phraseStatistics.extraWordCount; break;
+                case utils::WordDifference::Type::Swapped:    ++phraseStatistics.swappedWordCount; break;
+                case utils::WordDifference::Type::Misspelled: ++phraseStatistics.misspelledWordCount; break;
+            }
+        }
+    }
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+PhraseStatistics &PhraseStatistics::operator+=(const PhraseStatistics &other) noexcept
+{
+    answerCount         += other.answerCount;
+    correctCount        += other.correctCount;
+    missingWordCount    += other.missingWordCount;
+    extraWordCount      += other.extraWordCount;
+    swappedWordCount    += other.swappedWordCount;
+    misspelledWordCount += other.misspelledWordCount;
+    return *this;
+}
+
+// ---------------------------------------------------------------------------
+BatchGrader::BatchGrader(const dictionary::Dictionary &dictionary, const bool reverse, 
+                         const std::size_t threadCount)
+    : myAnswers{}
+    , myStatistics(dictionary.phraseCount())
+    , myThreadCount{threadCount}
+    , myAnswerCount{}
+    , myInvalidRowCount{}
+{
+    myAnswers.reserve(dictionary.phraseCount());
+    for (std::size_t i{}; i < dictionary.phraseCount(); ++i) 
+    { 
+        myAnswers.push_back(expectedAnswer(dictionary.phrase(i), reverse)); 
+    }
+}
+
+// ---------------------------------------------------------------------------
+bool BatchGrader::grade(const std::string &filePath, const bool skipHeader)
+{
+    const auto format{utils::recordFormat(filePath)};
+    utils::RecordReader reader{filePath, 
+        ((utils::RecordFormat::Csv == format) || (utils::RecordFormat::JsonLines == format)) 
+            ? format : utils::RecordFormat::Tsv};
+    if (!reader.isOpen()) { return false; }
+
+    // Each thread accumulates the statistics of its answers, they are merged at the end.
+    utils::WorkStealingPool pool{myThreadCount};
+    std::vector<ThreadStatistics> threadStatistics(pool.threadCount());
+
+    // Limit the number of batches read ahead, so that memory usage stays bounded.
+    std::mutex mutex{};
+    std::condition_variable condition{};
+    std::size_t pendingBatches{};
+    const auto maxPendingBatches{kBatchesPerThread * pool.threadCount()};
+
+    auto submit = [&](std::shared_ptr<Batch> batch)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            condition.wait(lock, [&]() { return pendingBatches < maxPendingBatches; });
+            ++pendingBatches;
+        }
+        pool.submit([&, batch](const std::size_t thread)
+        {
+            gradeBatch(*batch, myAnswers, threadStatistics[thread]);
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                --pendingBatches;
+            }
+            condition.notify_one();
+        });
+    };
+
+    std::vector<std::string> fields{};
+    auto batch{std::make_shared<Batch>()};
+    batch->reserve(kBatchSize);
+
+    for (bool header{skipHeader}; reader.next(fields); header = false)
+    {
+        std::size_t phraseIndex{};
+        if (header) { continue; }
+        if (!parsePhraseId(fields[0U], myAnswers.size(), phraseIndex))
+        {
+            ++myInvalidRowCount;
+            continue;
+        }
+        batch->push_back(Answer{phraseIndex, (1U < fields.size()) ? std::move(fields[1U]) : std::string{}});
+        ++myAnswerCount;
+        if (kBatchSize == batch->size())
+        {
+            submit(std::move(batch));
+            batch = std::make_shared<Batch>();
+            batch->reserve(kBatchSize);
+        }
+    }
+    if (!batch->empty()) { submit(std::move(batch)); }
+    pool.wait();
+
+    for (const auto &statistics : threadStatistics)
+    {
+        for (const auto &[phraseIndex, phraseStatistics] : statistics) 
+        { 
+            myStatistics[phraseIndex] += phraseStatistics; 
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+const std::vector<PhraseStatistics> &BatchGrader::statistics() const noexcept
+{
+    return myStatistics;
+}
+
+// ---------------------------------------------------------------------------
+std::uint64_t BatchGrader::answerCount() const noexcept
+{
+    return myAnswerCount;
+}
+
+// ---------------------------------------------------------------------------
+std::uint64_t BatchGrader::invalidRowCount() const noexcept
+{
+    return myInvalidRowCount;
+}
+
+// ---------------------------------------------------------------------------
+void BatchGrader::write(std::ostream &ostream) const
+{
+    ostream << "phrase_id\tanswers\tcorrect\tsuccess_rate\tmissing_words\textra_words\t"
+               "swapped_words\tmisspelled_words\tanswer\n";
+    ostream.setf(std::ios::fixed);
+    ostream.precision(1);
+
+    for (std::size_t i{}; i < myStatistics.size(); ++i)
+    {
+        const auto &statistics{myStatistics[i]};
+        if (0U == statistics.answerCount) { continue; }
+        ostream << i + 1U << "\t" << statistics.answerCount << "\t" << statistics.correctCount << "\t"
+                << 100.0 * static_cast<double>(statistics.correctCount) / static_cast<double>(statistics.answerCount) 
+                << "\t" << statistics.missingWordCount << "\t" << statistics.extraWordCount << "\t" 
+                << statistics.swappedWordCount << "\t" << statistics.misspelledWordCount << "\t" 
+                << myAnswers[i] << "\n";
+    }
+}
+} // namespace game
+} // namespace language
@@ -0,0 +1,129 @@
+/**
+ * @brief Implementation details of class language::game::DistractorIndex.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "distractor_index.h"
+
+namespace language
+{
+namespace game
+{
+namespace
+{
+/** Posting lists longer than this are skipped, common trigrams say little about similarity. */
+constexpr std::size_t kMaxPostingSize{4096U};
+
+// ---------------------------------------------------------------------------
+std::vector<std::uint32_t> trigrams(const std::string &text)
+{
+    // Pad the text with spaces so that short words get trigrams of their own.
+    const std::string padded{" " + text + " "};
+    std::vector<std::uint32_t> result{};
+
+    for (std::size_t i{}; i + 3U <= padded.size(); ++i)
+    {
+        std::uint32_t trigram{};
+        for (std::size_t j{i}; j < i + 3U; ++j)
+        {
+            const auto c{static_cast<unsigned char>(padded[j])};
+            trigram = (trigram << 8U) | (('A' <= c) && ('Z' >= c) ? c + ('a' - 'A') : c);
+        }
+        result.push_back(trigram);
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+DistractorIndex::DistractorIndex(const std::vector<std::string> &answers)
+    : myAnswers{}
+    , myTrigramCounts{}
+    , myPostings{}
+    , myLengthOrder{}
+{
+    std::unordered_set<std::string> uniqueAnswers{};
+
+    for (const auto &answer : answers)
+    {
+        if (answer.empty() || !uniqueAnswers.insert(answer).second) { continue; }
+        const auto id{static_cast<std::uint32_t>(myAnswers.size())};
+        const auto answerTrigrams{trigrams(answer)};
+
+        myAnswers.push_back(answer);
+        myTrigramCounts.push_back(static_cast<std::uint32_t>(answerTrigrams.size()));
+        for (const auto trigram : answerTrigrams) { myPostings[trigram].push_back(id); }
+    }
+    myLengthOrder.resize(myAnswers.size());
+    for (std::uint32_t i{}; i < myLengthOrder.size(); ++i) { myLengthOrder[i] = i; }
+    std::stable_sort(myLengthOrder.begin(), myLengthOrder.end(), [this](const auto x, const auto y) 
+        { return myAnswers[x].size() < myAnswers[y].size(); });
+}
+
+// ---------------------------------------------------------------------------
+std::vector<std::string> DistractorIndex::distractors(const std::string &answer, 
+                                                      const std::size_t count) const
+{
+    // Count the trigrams each answer shares with the correct answer.
+    const auto answerTrigrams{trigrams(answer)};
+    std::unordered_map<std::uint32_t, std::uint32_t> sharedTrigrams{};
+
+    for (const auto trigram : answerTrigrams)
+    {
+        const auto postings{myPostings.find(trigram)};
+        if ((myPostings.end() == postings) || (kMaxPostingSize < postings->second.size())) { continue; }
+        for (const auto id : postings->second) { ++sharedTrigrams[id]; }
+    }
+
+    // Rank candidates by Dice similarity, penalize length differences.
+    std::vector<std::pair<double, std::uint32_t>> candidates{};
+    candidates.reserve(sharedTrigrams.size());
+
+    for (const auto &shared : sharedTrigrams)
+    {
+        const auto &candidate{myAnswers[shared.first]};
+        if (candidate == answer) { continue; }
+        const auto dice{2.0 * shared.second / (answerTrigrams.size() + myTrigramCounts[shared.first])};
+        const auto lengthDifference{std::abs(static_cast<double>(candidate.size()) - answer.size())};
+        candidates.emplace_back(dice - 0.01 * lengthDifference, shared.first);
+    }
+    const auto selected{std::min(count, candidates.size())};
+    std::partial_sort(candidates.begin(), candidates.begin() + selected, candidates.end(),
+        [](const auto &x, const auto &y) 
+        { 
+            return (x.first > y.first) || ((x.first == y.first) && (x.second < y.second)); 
+        });
+
+    std::vector<std::string> result{};
+    std::unordered_set<std::uint32_t> used{};
+    for (std::size_t i{}; i < selected; ++i) 
+    { 
+        result.push_back(myAnswers[candidates[i].second]); 
+        used.insert(candidates[i].second);
+    }
+
+    // Fill up with the answers closest in length, alternating shorter and longer ones.
+    const auto middle{std::lower_bound(myLengthOrder.begin(), myLengthOrder.end(), answer.size(),
+        [this](const std::uint32_t id, const std::size_t length) { return myAnswers[id].size() < length; })};
+    auto shorter{middle}, longer{middle};
+
+    while ((result.size() < count) && 
+           ((myLengthOrder.begin() != shorter) || (myLengthOrder.end() != longer)))
+    {
+        const auto takeLonger{(myLengthOrder.end() != longer) && 
+            ((myLengthOrder.begin() == shorter) || (result.size() % 2U == 0U))};
+        const auto id{takeLonger ? *longer++ : *--shorter};
+        if ((myAnswers[id] != answer) && used.insert(id).second) { result.push_back(myAnswers[id]); }
+    }
+    return result;
+}
+} // namespace game
+} // namespace language
@@ -0,0 +1,64 @@
+/**
+ * @brief Index for finding distractors similar to an answer in multiple-choice mode.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace language
+{
+namespace game
+{
+/**
+ * @brief Nearest-neighbour index over character trigrams of all possible answers.
+ * 
+ *        The index is built once, after which distractors are found by counting trigrams 
+ *        shared with the answer through the posting lists of its trigrams, without scanning 
+ *        all answers. Candidates are ranked by trigram similarity and length difference. 
+ *        If too few lexically similar answers exist, answers of similar length are used.
+ */
+class DistractorIndex
+{
+public:
+    /**
+     * @brief Create distractor index.
+     * 
+     * @param[in] answers All possible answers, duplicates are ignored.
+     */
+    explicit DistractorIndex(const std::vector<std::string> &answers);
+
+    /**
+     * @brief Find distractors for an answer.
+     * 
+     * @param[in] answer The correct answer.
+     * @param[in] count The number of distractors to find.
+     * 
+     * @return Up to the given number of distractors, all different from the answer and 
+     *         each other, ordered by similarity.
+     */
+    std::vector<std::string> distractors(const std::string &answer, std::size_t count) const;
+
+    DistractorIndex()                                   = delete; // No default constructor.
+    DistractorIndex(const DistractorIndex&)             = delete; // No copy constructor.
+    DistractorIndex(DistractorIndex&&)                  = delete; // No move constructor.
+    DistractorIndex& operator=(const DistractorIndex&)  = delete; // No copy assignment.
+    DistractorIndex& operator=(DistractorIndex&&)       = delete; // No move assignment.
+
+private:
+    /** Answers in the index, without duplicates. */
+    std::vector<std::string> myAnswers;
+
+    /** The number of distinct trigrams of each answer. */
+    std::vector<std::uint32_t> myTrigramCounts;
+
+    /** Posting lists holding the answers containing each trigram. */
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> myPostings;
+
+    /** Answers sorted by length, used when too few similar answers are found. */
+    std::vector<std::uint32_t> myLengthOrder;
+};
+} // namespace game
+} // namespace language
@@ -11,8 +11,8 @@ namespace language
 namespace game
 {
 // ---------------------------------------------------------------------------
-Game::Game(dictionary::AdapterInterface &dictionaryAdapter)
-    : myImpl{std::make_unique<GameImpl>(dictionaryAdapter)}
+Game::Game(dictionary::AdapterInterface &dictionaryAdapter, const Options &options)
+    : myImpl{std::make_unique<GameImpl>(dictionaryAdapter, options)}
 {}
 
 // ---------------------------------------------------------------------------
@@ -1,17 +1,27 @@
 /**
  * @brief Implementation details of class language::game::GameImpl.
  */
-#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "dictionary/adapter_interface.h"
 #include "dictionary/dictionary.h"
+#include "game/grading.h"
 #include "game_impl.h"
+#include "utils/fingerprint.h"
+#include "utils/metrics.h"
 #include "utils/phrase.h"
 #include "utils/utils.h"
+#include "utils/word_alignment.h"
 
 namespace language
 {
@@ -19,21 +29,36 @@ namespace game
 {
 namespace
 {
-bool performAnalysis();
-void removeAdditionalPhraseInfo(std::string& str);
-bool playAgainInReverse();
-bool response();
 const std::string errorFilePath();
 } // namespace
 
 // ---------------------------------------------------------------------------
-GameImpl::GameImpl(dictionary::AdapterInterface &dictionaryAdapter)
+GameImpl::GameImpl(dictionary::AdapterInterface &dictionaryAdapter, const Options &options,
+                   std::unique_ptr<InputSource> input, std::ostream &ostream)
     : myDictionary{dictionaryAdapter}
+    , myOptions{options}
+    , myOutput{ostream}
+    , myInput{input ? std::move(input) : std::make_unique<TerminalInput>(options.timed())}
+    , myInputClosed{false}
+    , myInputTime{}
+    , myRecorder{}
     , myGuessCount{}
     , myErrorCount{}
     , myPhraseIndexes{}
+    , myPhrasePosition{}
+    , myIncorrectPhrases{}
+    , mySessionPhrases{}
+    , mySecondDirection{false}
     , myReverse{false}
     , myErrorsWrittenToFile{false}
+    , myDistractorIndexes{}
+    , myRoundAnswerTimes{}
+    , myRoundProcessingTimes{}
+    , myAnswerTimes{}
+    , myLastInputTime{}
+    , myRoundDeadline{std::chrono::steady_clock::time_point::max()}
+    , myCheckpoint{}
+    , myCheckpointWriter{}
 {}   
 
 // ---------------------------------------------------------------------------
@@ -42,132 +67,408 @@ bool GameImpl::play(const bool reverse)
     // Return false if no phrases are present.
     if (myDictionary.empty()) { return false; }
 
-    myReverse             = reverse;
-    myErrorsWrittenToFile = false;
+    myLastInputTime = std::chrono::steady_clock::now();
+    myInputTime     = myInput->now();
+
+    // Seed the random generator explicitly, so that the session can be repeated.
+    const auto seed{myOptions.seed ? *myOptions.seed : static_cast<unsigned>(std::time(nullptr))};
+    utils::initRandomGenerator(seed);
 
-    std::vector<Phrase> remainingPhrases{phrases()};
-    preparePhrasesForSession(remainingPhrases);
-    auto phraseBackup{remainingPhrases};
+    std::vector<std::size_t> remainingPhrases{};
+    const bool resumed{myOptions.resume && resumeSession(remainingPhrases)};
+    if (!resumed)
+    {
+        remainingPhrases = prepareSession(reverse);
+        startRecording(reverse, seed);
+    }
+    startCheckpoints();
+
+    // Don't play with incomplete phrases, e.g. if a shard worker has ended.
+    if (myDictionary.failed())
+    {
+        myOutput << "The phrases couldn't be read!\n\n";
+        myOutput.flush();
+        return false;
+    }
 
     printStartInfo();
-    runRound(remainingPhrases);
+    if (resumed) { myOutput << "Resuming the saved session!\n\n"; }
+    if (!mySecondDirection)
+    {
+        runRound(remainingPhrases);
 
-    // Play the game again if desired.
-    if (playAgainInReverse())
+        // Play the game again if desired.
+        mySecondDirection = playAgainInReverse();
+        if (mySecondDirection)
+        {
+            myReverse        = !myReverse;
+            remainingPhrases = mySessionPhrases;
+            saveCheckpoint(remainingPhrases);
+        }
+    }
+
+    // A resumed session may already be played again in reverse.
+    if (mySecondDirection)
     {
-        myReverse = !myReverse;
-        runRound(phraseBackup);
+        runRound(remainingPhrases);
+
+        // Compare both directions, each may span several rounds of repeated phrases.
+        myOutput << "--------------------------------------------------------------------------------\n";
+        printLatencies("Answer time (forward):\t\t", myAnswerTimes[0U]);
+        printLatencies("Answer time (reverse):\t\t", myAnswerTimes[1U]);
+        myOutput << "--------------------------------------------------------------------------------\n\n";
     }
+    myOutput.flush();
 
-    // Return true to indicate success.
-    return true;
+    // The session is over, so there's nothing left to resume, unless the input was closed.
+    if (myCheckpointWriter && !myInputClosed) { myCheckpointWriter->remove(); }
+
+    // Return true to indicate success, unless the session was ended since a phrase couldn't be read.
+    return !myDictionary.failed();
+}
+
+// ---------------------------------------------------------------------------
+std::vector<std::size_t> GameImpl::prepareSession(const bool reverse)
+{
+    myReverse             = reverse;
+    myErrorsWrittenToFile = false;
+
+    std::vector<std::size_t> phrases{this->phrases()};
+    preparePhrasesForSession(phrases);
+    initDistractorIndexes();
+    mySessionPhrases = phrases;
+    return phrases;
 }
 
 // ---------------------------------------------------------------------------
-std::vector<Phrase> GameImpl::phrases() const 
+std::vector<std::size_t> GameImpl::phrases() const 
 { 
-    const auto &phraseList{myDictionary.phrases()};
-    return std::vector<Phrase>{phraseList.begin(), phraseList.end()}; 
+    // Phrases are referred to by their index and only fetched from the dictionary when asked.
+    std::vector<std::size_t> phrases(myDictionary.phraseCount());
+    for (std::size_t i{}; i < phrases.size(); ++i) { phrases[i] = i; }
+    return phrases;
 }
 
 // ---------------------------------------------------------------------------
-void GameImpl::runRound(std::vector<Phrase>& phrases)
+void GameImpl::runRound(std::vector<std::size_t>& phrases)
 {
-    while (!phrases.empty() && (correctAnswerCount() < phraseCountForSession())) 
+    LANGUAGE_METRICS_TIME("round", "Time spent per round.");
+    myRoundDeadline = (0 < myOptions.roundTimeLimit.count()) 
+        ? myInputTime + myOptions.roundTimeLimit 
+        : std::chrono::steady_clock::time_point::max();
+
+    while (!phrases.empty() && (correctAnswerCount() < phraseCountForSession()) && !roundTimeIsUp() && 
+           !myInputClosed) 
     { 
         runRemainingPhrases(phrases); 
     }
+    if (roundTimeIsUp()) { myOutput << "Time is up for this round!\n\n"; }
     printResults();
     clearStats();
 }
 
 // ---------------------------------------------------------------------------
-void GameImpl::runRemainingPhrases(std::vector<Phrase>& phrases)
+void GameImpl::runRemainingPhrases(std::vector<std::size_t>& phrases)
 {
-    std::vector<Phrase> incorrectPhrases{};
-    initPhraseIndexes(phrases.size());
+    // A resumed pass continues in the saved order.
+    if (0U == myPhrasePosition)
+    {
+        myIncorrectPhrases.clear();
+        initPhraseIndexes(phrases.size());
+    }
 
-    for (const auto& i : myPhraseIndexes)
+    while (myPhrasePosition < myPhraseIndexes.size())
     {
+        if (roundTimeIsUp()) { break; }
         printCurrentStatus();
-        runNextPhrase(phrases[i], incorrectPhrases);
-        if (correctAnswerCount() >= phraseCountForSession()) { return; }
+        runNextPhrase(phrases[myPhraseIndexes[myPhrasePosition++]], myIncorrectPhrases);
+        if (myInputClosed) { return; }
+        saveCheckpoint(phrases);
+        if (correctAnswerCount() >= phraseCountForSession()) 
+        { 
+            myPhrasePosition = 0U;
+            return; 
+        }
     }
 
-    writeErrorsToFile(incorrectPhrases);
-    phrases = incorrectPhrases;
+    myPhrasePosition = 0U;
+    writeErrorsToFile(myIncorrectPhrases);
+    phrases = myIncorrectPhrases;
 }
 
 // ---------------------------------------------------------------------------
-void GameImpl::runNextPhrase(const Phrase& phrase, std::vector<Phrase>& incorrectPhrases)
+void GameImpl::runNextPhrase(const std::size_t phraseIndex, 
+                             std::vector<std::size_t>& incorrectPhrases)
 {
-    const auto currentPhrase{!myReverse ? phrase.primary : phrase.target};
-    std::cout << "Translate the following phrase:\n" << currentPhrase << "\n"; 
+    LANGUAGE_METRICS_TIME("prompt", "Time spent per prompt, including input and grading.");
+    const auto phrase{myDictionary.phrase(phraseIndex)};
+    if (myDictionary.failed())
+    {
+        // End the session like closed input, so that the checkpoint is kept to resume it.
+        myOutput << "The phrase couldn't be read, ending the session!\n\n";
+        myInputClosed = true;
+        return;
+    }
+    std::vector<std::string> choices{};
+    {
+        LANGUAGE_METRICS_TIME("render", "Time spent rendering prompts.");
+        const auto currentPhrase{!myReverse ? phrase.primary : phrase.target};
+        myOutput << "Translate the following phrase:\n" << currentPhrase << "\n"; 
+        choices = answerChoices(phrase);
+        printChoices(choices);
+    }
     std::string guess{};
-
-    utils::readLine(guess);
+    const auto answerTime{readLine(guess, promptDeadline())};
+    if (myInputClosed) { return; }
+    if (!answerTime)
+    {
+        checkGuess(guess, phrase, true);
+        incorrectPhrases.push_back(phraseIndex);
+        return;
+    }
+    myRoundAnswerTimes.record(*answerTime);
+    myAnswerTimes[myReverse ? 1U : 0U].record(*answerTime);
     utils::removeTrailingWhitespaces(guess);
-    checkGuess(guess, phrase, incorrectPhrases);
+
+    // Accept the number of an answer option in multiple-choice mode.
+    const auto choice{static_cast<std::size_t>(std::atoi(guess.c_str()))};
+    if ((0U < choice) && (choices.size() >= choice) && (std::to_string(choice) == guess)) 
+    { 
+        guess = choices[choice - 1U]; 
+    }
+    if (!checkGuess(guess, phrase)) { incorrectPhrases.push_back(phraseIndex); }
 }
 
 // ---------------------------------------------------------------------------
-void GameImpl::checkGuess(const std::string& guess, const Phrase& phrase, 
-                          std::vector<Phrase>& incorrectPhrases)
+void GameImpl::initDistractorIndexes()
 {
-    auto answer{myReverse ? phrase.primary : phrase.target};
-    removeAdditionalPhraseInfo(answer);
+    if ((0U == myOptions.choiceCount) || myDistractorIndexes[0U]) { return; }
+    std::vector<std::string> primaryAnswers{}, targetAnswers{};
 
-    if (guess == answer) { std::cout << "Correct answer!\n\n"; }
-    else
+    // Index the answers the way they are checked, i.e. without additional phrase info.
+    const auto read{myDictionary.forEachPhrase([&](Phrase& phrase)
     {
-        std::cout << "Wrong answer!\n";
-        std::cout << "Your guess:\t" << guess << "\n";
-        std::cout << "Correct answer:\t" << answer << "\n\n";
+        primaryAnswers.push_back(std::move(phrase.primary));
+        targetAnswers.push_back(std::move(phrase.target));
+        removeAdditionalPhraseInfo(primaryAnswers.back());
+        removeAdditionalPhraseInfo(targetAnswers.back());
+    })};
+    if (!read) { return; }
+    myDistractorIndexes[0U] = std::make_unique<DistractorIndex>(targetAnswers);
+    myDistractorIndexes[1U] = std::make_unique<DistractorIndex>(primaryAnswers);
+}
+
+// ---------------------------------------------------------------------------
+std::vector<std::string> GameImpl::answerChoices(const Phrase& phrase) const
+{
+    if (0U == myOptions.choiceCount) { return {}; }
+    const auto answer{expectedAnswer(phrase, myReverse)};
+
+    // Combine the answer with similar distractors and shuffle the options.
+    const auto& distractorIndex{myDistractorIndexes[myReverse ? 1U : 0U]};
+    auto choices{distractorIndex->distractors(answer, myOptions.choiceCount - 1U)};
+    choices.push_back(answer);
+
+    for (std::size_t i{choices.size() - 1U}; 0U < i; --i)
+    {
+        std::swap(choices[i], choices[utils::getRandomInt<std::size_t>(i + 1U)]);
+    }
+    return choices;
+}
 
-        incorrectPhrases.push_back(phrase);
+// ---------------------------------------------------------------------------
+void GameImpl::printChoices(const std::vector<std::string>& choices)
+{
+    if (choices.empty()) { return; }
+    for (std::size_t i{}; i < choices.size(); ++i) 
+    { 
+        myOutput << "  " << i + 1U << ") " << choices[i] << "\n"; 
+    }
+    myOutput << "Enter the number or the text of your answer:\n";
+}
+
+// ---------------------------------------------------------------------------
+bool GameImpl::checkGuess(const std::string& guess, const Phrase& phrase, const bool timedOut)
+{
+    std::string answer{};
+    bool correct{false};
+    if (timedOut)
+    {
+        // Count a timeout as a wrong answer, without offering an analysis.
+        answer = expectedAnswer(phrase, myReverse);
+        ++myGuessCount;
         ++myErrorCount;
-        if (performAnalysis()) { analyzeError(guess, answer); }
+        myOutput << "Time is up!\n";
+        myOutput << "Correct answer:\t" << answer << "\n\n";
+        LANGUAGE_METRICS_COUNT("timeouts", "Prompts not answered in time.", 1U);
+        return false;
+    }
+    {
+        // Only grading is timed, not waiting for the user to request an analysis.
+        LANGUAGE_METRICS_TIME("grade", "Time spent grading answers.");
+        answer  = expectedAnswer(phrase, myReverse);
+        correct = isCorrect(guess, answer);
     }
     ++myGuessCount;
+    if (correct) 
+    { 
+        myOutput << "Correct answer!\n\n"; 
+        return true;
+    }
+    myOutput << "Wrong answer!\n";
+    myOutput << "Your guess:\t" << guess << "\n";
+    myOutput << "Correct answer:\t" << answer << "\n\n";
+
+    ++myErrorCount;
+    LANGUAGE_METRICS_COUNT("wrong_answers", "Wrong answers given.", 1U);
+    if (performAnalysis()) { analyzeError(guess, answer); }
+    return false;
 }
 
 // ---------------------------------------------------------------------------
-void GameImpl::printStartInfo() const noexcept
+std::optional<std::uint64_t> GameImpl::readLine(std::string& str, 
+                                                const std::chrono::steady_clock::time_point deadline)
 {
-    const auto loadedPhrases{utils::min<std::size_t>(phraseCountForSession(), myDictionary.phraseCount())};
-    std::cout << "--------------------------------------------------------------------------------\n";
-    std::cout << "Starting translation game!\n";
-    std::cout << loadedPhrases << " phrases have been loaded!\n";
-    std::cout << "--------------------------------------------------------------------------------\n\n";
+    // Write the whole screen update at once before waiting for input.
+    myOutput.flush();
+
+    // Time since the previous input is spent by the game, the wait for this input by the user.
+    const auto waitStart{std::chrono::steady_clock::now()};
+    myRoundProcessingTimes.record(static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(waitStart - myLastInputTime).count()));
+    if (myInputClosed) 
+    { 
+        str.clear();
+        return std::nullopt; 
+    }
+
+    // The wait is measured on the clock of the input, which is replayed for recorded sessions.
+    const auto promptTime{myInput->now()};
+    auto event{InputEventType::Line};
+    {
+        LANGUAGE_METRICS_TIME("input_wait", "Time spent waiting for user input.");
+        event = myInput->readLine(str, deadline);
+    }
+    myLastInputTime = std::chrono::steady_clock::now();
+    const auto previousInputTime{myInputTime};
+    myInputTime = myInput->now();
+    if (myRecorder) 
+    { 
+        myRecorder->record(InputEvent{static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(myInputTime - previousInputTime).count()), event, str}); 
+    }
+
+    if (InputEventType::Timeout == event) { myOutput << "\n"; }
+    if (InputEventType::Line != event)
+    {
+        myInputClosed = InputEventType::Closed == event;
+        return std::nullopt;
+    }
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(myInputTime - promptTime).count());
 }
 
 // ---------------------------------------------------------------------------
-void GameImpl::printCurrentStatus() const noexcept
+std::chrono::steady_clock::time_point GameImpl::promptDeadline() const noexcept
 {
-    if (0U == myGuessCount) { return; }
-    std::cout << "--------------------------------------------------------------------------------\n";
-    std::cout << "Number of guesses:\t\t" << myGuessCount << "\n";
-    std::cout << "Number of correct answers:\t" << correctAnswerCount() << "\n";
-    std::cout << "Number of incorrect guesses:\t" << myErrorCount << "\n";
-    std::cout << "Number of phrases remaining:\t" << phraseCountForSession() - correctAnswerCount() << "\n";
-    std::cout << "--------------------------------------------------------------------------------\n\n";
+    if (0 == myOptions.promptTimeLimit.count()) { return myRoundDeadline; }
+    return std::min(myInput->now() + myOptions.promptTimeLimit, myRoundDeadline);
 }
 
 // ---------------------------------------------------------------------------
-void GameImpl::printResults() const noexcept
+bool GameImpl::roundTimeIsUp() const noexcept
 {
-    std::cout << "--------------------------------------------------------------------------------\n";
-    std::cout << "Total number of guesses:\t" << myGuessCount << "\n";
-    std::cout << "Number of correct answers:\t" << correctAnswerCount() << "\n";
-    std::cout << "Number of incorrect answers:\t" << myErrorCount << "\n";
-    std::cout << "Success rate:\t\t\t";
+    // Checked against the time of the last input, so that replayed sessions end rounds alike.
+    return myInputTime >= myRoundDeadline;
+}
 
-    if (precisionContainsDecimals())
+// ---------------------------------------------------------------------------
+bool GameImpl::response(const std::chrono::steady_clock::time_point deadline)
+{
+    // No answer before the deadline or at the end of the input counts as no.
+    std::string s{};
+    while (1)
     {
-        std::cout << std::fixed << std::setprecision(1U) << getPrecision() << " %\n";
+        if (!readLine(s, deadline)) { return false; }
+        if (s[0U] == 'Y' || s[0U] == 'y') { return true; }
+        else if (s[0U] == 'N' || s[0U] == 'n') { return false; }
+        else { myOutput << "Invalid input, try again!\n"; }
     }
-    else { std::cout << static_cast<int>(getPrecision()) << " %\n"; }
-    std::cout << "--------------------------------------------------------------------------------\n\n";
+}
+
+// ---------------------------------------------------------------------------
+bool GameImpl::performAnalysis() 
+{
+    myOutput << "Analyze error? Y/n\n";
+    return response(promptDeadline());
+}
+
+// ---------------------------------------------------------------------------
+bool GameImpl::playAgainInReverse() 
+{
+    myOutput << "Do you wanna play the game in reverse? Y/n\n";
+
+    // The round is over, so the question is limited like a prompt, or like a round without prompt limit.
+    const auto timeLimit{(0 < myOptions.promptTimeLimit.count()) ? myOptions.promptTimeLimit 
+                                                                 : myOptions.roundTimeLimit};
+    return response((0 < timeLimit.count()) ? myInput->now() + timeLimit 
+                                            : std::chrono::steady_clock::time_point::max());
+}
+
+// ---------------------------------------------------------------------------
+void GameImpl::printStartInfo()
+{
+    const auto loadedPhrases{utils::min<std::size_t>(phraseCountForSession(), myDictionary.phraseCount())};
+    myOutput << "--------------------------------------------------------------------------------\n";
+    myOutput << "Starting translation game!\n";
+    myOutput << loadedPhrases << " phrases have been loaded!\n";
+    myOutput << "--------------------------------------------------------------------------------\n\n";
+}
+
+// ---------------------------------------------------------------------------
+void GameImpl::printCurrentStatus()
+{
+    if ((0U == myGuessCount) || (StatusMode::Quiet == myOptions.statusMode)) { return; }
+    const auto remainingPhrases{phraseCountForSession() - correctAnswerCount()};
+
+    if (StatusMode::Compact == myOptions.statusMode)
+    {
+        myOutput << "[Guesses: " << myGuessCount << " | Correct: " << correctAnswerCount() 
+                 << " | Incorrect: " << myErrorCount << " | Remaining: " << remainingPhrases 
+                 << "]\n\n";
+        return;
+    }
+    myOutput << "--------------------------------------------------------------------------------\n";
+    myOutput << "Number of guesses:\t\t" << myGuessCount << "\n";
+    myOutput << "Number of correct answers:\t" << correctAnswerCount() << "\n";
+    myOutput << "Number of incorrect guesses:\t" << myErrorCount << "\n";
+    myOutput << "Number of phrases remaining:\t" << remainingPhrases << "\n";
+    myOutput << "--------------------------------------------------------------------------------\n\n";
+}
+
+// ---------------------------------------------------------------------------
+void GameImpl::printResults()
+{
+    myOutput << "--------------------------------------------------------------------------------\n";
+    myOutput << "Total number of guesses:\t" << myGuessCount << "\n";
+    myOutput << "Number of correct answers:\t" << correctAnswerCount() << "\n";
+    myOutput << "Number of incorrect answers:\t" << myErrorCount << "\n";
+    myOutput << "Success rate:\t\t\t";
+
+    if (precisionContainsDecimals()) { myOutput.fixed(getPrecision(), 1) << " %\n"; }
+    else { myOutput << static_cast<int>(getPrecision()) << " %\n"; }
+    printLatencies("Answer time:\t\t\t", myRoundAnswerTimes);
+    printLatencies("Processing time:\t\t", myRoundProcessingTimes);
+    myOutput << "--------------------------------------------------------------------------------\n\n";
+}
+
+// ---------------------------------------------------------------------------
+void GameImpl::printLatencies(const char* label, const utils::LatencyHistogram& latencies)
+{
+    if (0U == latencies.count()) { return; }
+    myOutput << label << "p50 " << utils::formatLatency(latencies.percentile(50.0)) 
+             << " | p90 " << utils::formatLatency(latencies.percentile(90.0)) 
+             << " | p99 " << utils::formatLatency(latencies.percentile(99.0)) << "\n";
 }
 
 // ---------------------------------------------------------------------------
@@ -203,22 +504,34 @@ void GameImpl::initPhraseIndexes(const std::size_t size) noexcept
 // ---------------------------------------------------------------------------
 void GameImpl::analyzeError(const std::string& guess, const std::string& answer)
 {
-    auto getOutput = [](const char c, const bool upper_case = false)
-    {
-        return c != ' ' ? std::string{'"', c, '"'} :
-               upper_case ? std::string{"Blank line"} : std::string{"blank line"};
-    };
-    for (std::size_t i{}; i < answer.size(); ++i)
+    const auto differences{utils::alignWords(guess, answer)};
+    if (differences.empty()) { myOutput << "All words are correct, check the spacing.\n"; }
+
+    // Word positions are counted from 1.
+    for (const auto& difference : differences)
     {
-        if (i < guess.size())
+        switch (difference.type)
         {
-            if (guess[i] != answer[i])
-            {
-                std::cout << getOutput(guess[i], true) << " at index " << i
-                          << " should be replaced with " << getOutput(answer[i]) << "\n\n";
-            }
+            case utils::WordDifference::Type::Missing:
+                myOutput << "Missing word \"" << difference.answerWord << "\" (word " 
+                         << difference.answerPosition + 1U << " of the answer)\n";
+                break;
+            case utils::WordDifference::Type::Extra:
+                myOutput << "Extra word \"" << difference.guessWord << "\" (word " 
+                         << difference.guessPosition + 1U << " of your guess)\n";
+                break;
+            case utils::WordDifference::Type::Swapped:
+                myOutput << "Word \"" << difference.answerWord << "\" should be word " 
+                         << difference.answerPosition + 1U << ", not word " 
+                         << difference.guessPosition + 1U << "\n";
+                break;
+            case utils::WordDifference::Type::Misspelled:
+                myOutput << "\"" << difference.guessWord << "\" should be spelled \"" 
+                         << difference.answerWord << "\"\n";
+                break;
         }
     }
+    myOutput << "\n";
 }
 
 // ---------------------------------------------------------------------------
@@ -226,10 +539,12 @@ void GameImpl::clearStats() noexcept
 {
     myGuessCount = 0U;
     myErrorCount = 0U;
+    myRoundAnswerTimes.clear();
+    myRoundProcessingTimes.clear();
 }
 
 // ---------------------------------------------------------------------------
-void GameImpl::preparePhrasesForSession(std::vector<Phrase>& phrases) 
+void GameImpl::preparePhrasesForSession(std::vector<std::size_t>& phrases) 
 {
     utils::initRandomGenerator();
 
@@ -262,71 +577,140 @@ std::size_t GameImpl::correctAnswerCount() const noexcept { return myGuessCount
 std::size_t GameImpl::phraseCountForSession() const { return myDictionary.phraseCountToUse(); }
 
 // ---------------------------------------------------------------------------
-void GameImpl::writeErrorsToFile(const std::vector<Phrase>& errors)
+void GameImpl::writeErrorsToFile(const std::vector<std::size_t>& errors)
 {
-    if (!errors.empty() && !myErrorsWrittenToFile)
+    if (!errors.empty() && !myErrorsWrittenToFile && myOptions.writeErrorFiles)
     {
         const std::string errorPath{errorFilePath()};
-        utils::writePhrasesToFile(errorPath, errors);   
+        std::vector<Phrase> phrases{};
+        phrases.reserve(errors.size());
+        for (const auto i : errors) { phrases.push_back(myDictionary.phrase(i)); }
+        utils::writePhrasesToFile(errorPath, phrases);   
         myErrorsWrittenToFile = true;
 
         if (1U == errors.size())
         {
-            std::cout << "One incorrectly guessed phrase "
+            myOutput << "One incorrectly guessed phrase "
                 "has been written to file \"" << errorPath << "\"!\n\n";
         }
         else
         {
-            std::cout << errors.size() << " incorrectly guessed phrases "
+            myOutput << errors.size() << " incorrectly guessed phrases "
                 "have been written to file \"" << errorPath << "\"!\n\n";
         }
     }
 }
 
-namespace
-{
 // ---------------------------------------------------------------------------
-bool performAnalysis() 
+bool GameImpl::resumeSession(std::vector<std::size_t>& phrases)
 {
-    std::string s{};
-    std::cout << "Analyze error? Y/n\n";
-    return response();
+    SessionState state{};
+    if (!readCheckpoint(myOptions.checkpointPath, state))
+    {
+        myOutput << "No session to resume in \"" << myOptions.checkpointPath << "\", starting a new session!\n\n";
+        return false;
+    }
+
+    // Only resume if the checkpoint refers to the same phrases, which is checked without reading other phrases.
+    const auto valid = [this](const std::vector<std::size_t>& indexes)
+    {
+        return std::all_of(indexes.begin(), indexes.end(), [this](const auto i) { return i < myDictionary.phraseCount(); });
+    };
+    if (!valid(state.sessionPhrases) || !valid(state.phrases) || !valid(state.incorrectPhrases) ||
+        (fingerprint(state.sessionPhrases) != state.fingerprint))
+    {
+        myOutput << "The phrases have changed since the session was saved, starting a new session!\n\n";
+        return false;
+    }
+
+    // Restore the session as it was after the last answer, the phrase order is kept as well.
+    utils::initRandomGenerator();
+    myReverse             = state.reverse;
+    mySecondDirection     = state.secondDirection;
+    myErrorsWrittenToFile = state.errorsWrittenToFile;
+    myGuessCount          = static_cast<std::size_t>(state.guessCount);
+    myErrorCount          = static_cast<std::size_t>(state.errorCount);
+    myPhrasePosition      = static_cast<std::size_t>(state.position);
+    mySessionPhrases      = std::move(state.sessionPhrases);
+    myPhraseIndexes       = std::move(state.phraseIndexes);
+    myIncorrectPhrases    = std::move(state.incorrectPhrases);
+    phrases               = std::move(state.phrases);
+    initDistractorIndexes();
+    return true;
 }
 
 // ---------------------------------------------------------------------------
-void removeAdditionalPhraseInfo(std::string& str) 
+void GameImpl::startCheckpoints()
 {
-    for (std::size_t i{}; i < str.size(); ++i) 
-    {
-        if ('(' == str[i]) 
-        {
-            str = str.std::string::substr(0U, i);
-            utils::removeTrailingWhitespaces(str);
-            break;
-        }
-    }
+    if (myOptions.checkpointPath.empty()) { return; }
+
+    // The session phrases don't change, so they are only set once.
+    myCheckpoint.fingerprint    = fingerprint(mySessionPhrases);
+    myCheckpoint.sessionPhrases = mySessionPhrases;
+    myCheckpointWriter          = std::make_unique<CheckpointWriter>(myOptions.checkpointPath);
 }
 
 // ---------------------------------------------------------------------------
-bool playAgainInReverse() 
+void GameImpl::saveCheckpoint(const std::vector<std::size_t>& phrases)
 {
-    std::cout << "Do you wanna play the game in reverse? Y/n\n";
-    return response();
+    if (!myCheckpointWriter) { return; }
+    myCheckpoint.reverse             = myReverse;
+    myCheckpoint.secondDirection     = mySecondDirection;
+    myCheckpoint.errorsWrittenToFile = myErrorsWrittenToFile;
+    myCheckpoint.guessCount          = myGuessCount;
+    myCheckpoint.errorCount          = myErrorCount;
+    myCheckpoint.position            = myPhrasePosition;
+    myCheckpoint.phrases.assign(phrases.begin(), phrases.end());
+    myCheckpoint.phraseIndexes.assign(myPhraseIndexes.begin(), myPhraseIndexes.end());
+    myCheckpoint.incorrectPhrases.assign(myIncorrectPhrases.begin(), myIncorrectPhrases.end());
+    myCheckpointWriter->write(myCheckpoint);
 }
 
 // ---------------------------------------------------------------------------
-bool response()
+std::uint64_t GameImpl::corpusFingerprint() const 
+{ 
+    // Same hash as over the indexes of all phrases, but reading the phrases in blocks.
+    utils::Fingerprint fingerprint{};
+    fingerprint.add(std::to_string(phraseCountForSession()));
+    myDictionary.forEachPhrase([&fingerprint](const Phrase& phrase) { fingerprint.add(phrase); });
+    return fingerprint.value();
+}
+
+// ---------------------------------------------------------------------------
+void GameImpl::startRecording(const bool reverse, const unsigned seed)
 {
-    std::string s{};
-    while (1)
+    if (myOptions.recordPath.empty()) { return; }
+    SessionHeader header{};
+    header.seed              = seed;
+    header.corpusFingerprint = corpusFingerprint();
+    header.phraseCount       = myDictionary.phraseCount();
+    header.phraseCountToUse  = phraseCountForSession();
+    header.reverse           = reverse;
+    header.options           = myOptions;
+
+    // A session can't be replayed without the fingerprint of all phrases.
+    if (myDictionary.failed()) { return; }
+
+    myRecorder = std::make_unique<SessionRecorder>(myOptions.recordPath, header);
+    if (!myRecorder->good())
     {
-        utils::readLine(s);
-        if (s[0U] == 'Y' || s[0U] == 'y') { return true; }
-        else if (s[0U] == 'N' || s[0U] == 'n') { return false; }
-        else { std::cout << "Invalid input, try again!\n"; }
+        myOutput << "The session can't be recorded to \"" << myOptions.recordPath << "\"!\n\n";
+        myRecorder.reset();
     }
 }
 
+// ---------------------------------------------------------------------------
+std::uint64_t GameImpl::fingerprint(const std::vector<std::size_t>& phrases) const
+{
+    // Fingerprint of the session size and the given phrases.
+    utils::Fingerprint fingerprint{};
+    fingerprint.add(std::to_string(phraseCountForSession()));
+    for (const auto i : phrases) { fingerprint.add(myDictionary.phrase(i)); }
+    return fingerprint.value();
+}
+
+namespace
+{
 // ---------------------------------------------------------------------------
 const std::string errorFilePath()
 {
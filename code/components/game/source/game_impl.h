@@ -3,11 +3,24 @@
  */
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <limits>
+#include <memory>
+#include <optional>
+#include <ostream>
 #include <string>
 #include <vector>
 
 #include "dictionary/dictionary.h"
+#include "distractor_index.h"
+#include "game/options.h"
+#include "game/session_log.h"
+#include "input_source.h"
+#include "session_checkpoint.h"
+#include "utils/latency_histogram.h"
+#include "utils/output.h"
 #include "utils/phrase.h"
 
 namespace language
@@ -33,8 +46,12 @@ public:
      * @brief Create language game.
      *
      * @param[in] adapter Adapter providing information about the phrases to load.
+     * @param[in] options Game options.
+     * @param[in] input Source of the input, nullptr to read from the terminal (default = nullptr).
+     * @param[in] ostream Stream to write the output to (default = stdout).
      */
-    explicit GameImpl(dictionary::AdapterInterface &dictionaryAdapter);
+    GameImpl(dictionary::AdapterInterface &dictionaryAdapter, const Options &options,
+             std::unique_ptr<InputSource> input = nullptr, std::ostream &ostream = std::cout);
 
     /**
      * @brief Play the game.
@@ -45,6 +62,24 @@ public:
      */
     bool play(const bool reverse);
 
+    /**
+     * @brief Prepare a session: select the phrases to play in random order and index the
+     *        answer choices, if multiple-choice mode is enabled.
+     * 
+     * @param reverse Prepare the session in reverse.
+     * 
+     * @return Indexes of the phrases to play.
+     */
+    std::vector<std::size_t> prepareSession(bool reverse);
+
+    /**
+     * @brief Get a hash over all phrases of the dictionary, to check that a recorded session
+     *        is replayed with the same phrases.
+     * 
+     * @return The hash.
+     */
+    std::uint64_t corpusFingerprint() const;
+
     GameImpl()                           = delete; // No default constructor.
     GameImpl(const GameImpl&)            = delete; // No copy constructor.
     GameImpl(GameImpl&&)                 = delete; // No move constructor.
@@ -52,15 +87,25 @@ public:
     GameImpl& operator=(GameImpl&&)      = delete; // No copy assignment.
     
 private:
-    std::vector<Phrase> phrases() const;
-    void runRound(std::vector<Phrase>& phrases);
-    void runRemainingPhrases(std::vector<Phrase>& phrases);
-    void runNextPhrase(const Phrase& phrase, std::vector<Phrase>& incorrectPhrases);
-    void checkGuess(const std::string& guess, const Phrase& phrase,
-                    std::vector<Phrase>& incorrectPhrases);
-    void printStartInfo() const noexcept;
-    void printCurrentStatus() const noexcept;
-    void printResults() const noexcept;
+    std::vector<std::size_t> phrases() const;
+    void runRound(std::vector<std::size_t>& phrases);
+    void runRemainingPhrases(std::vector<std::size_t>& phrases);
+    void runNextPhrase(std::size_t phraseIndex, std::vector<std::size_t>& incorrectPhrases);
+    void initDistractorIndexes();
+    std::vector<std::string> answerChoices(const Phrase& phrase) const;
+    void printChoices(const std::vector<std::string>& choices);
+    bool checkGuess(const std::string& guess, const Phrase& phrase, bool timedOut = false);
+    std::optional<std::uint64_t> readLine(std::string& str, 
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max());
+    std::chrono::steady_clock::time_point promptDeadline() const noexcept;
+    bool roundTimeIsUp() const noexcept;
+    bool response(std::chrono::steady_clock::time_point deadline);
+    bool performAnalysis();
+    bool playAgainInReverse();
+    void printStartInfo();
+    void printCurrentStatus();
+    void printResults();
+    void printLatencies(const char* label, const utils::LatencyHistogram& latencies);
     void setPhraseIndexCount(const std::size_t size) noexcept;
     void shufflePhraseIndexes() noexcept;
     void initPhraseIndexes(const std::size_t size) noexcept;
@@ -69,13 +114,36 @@ private:
     double getPrecision() const noexcept;
     bool precisionContainsDecimals() const noexcept;
     std::size_t correctAnswerCount() const noexcept;
-    void preparePhrasesForSession(std::vector<Phrase>& phrases);
+    void preparePhrasesForSession(std::vector<std::size_t>& phrases);
     std::size_t phraseCountForSession() const;
-    void writeErrorsToFile(const std::vector<Phrase>& errors);
+    void writeErrorsToFile(const std::vector<std::size_t>& errors);
+    bool resumeSession(std::vector<std::size_t>& phrases);
+    void startCheckpoints();
+    void saveCheckpoint(const std::vector<std::size_t>& phrases);
+    std::uint64_t fingerprint(const std::vector<std::size_t>& phrases) const;
+    void startRecording(bool reverse, unsigned seed);
 
     /** Dictionary implementation. */
     dictionary::Dictionary myDictionary;
 
+    /** Game options. */
+    Options myOptions;
+
+    /** Buffered output, flushed once per prompt. */
+    utils::Output myOutput;
+
+    /** Source of the input and of the time seen by the game. */
+    std::unique_ptr<InputSource> myInput;
+
+    /** Indicate whether the input has been closed, which ends the session. */
+    bool myInputClosed;
+
+    /** Game time when the last input was received, on the clock of the input source. */
+    std::chrono::steady_clock::time_point myInputTime;
+
+    /** Recorder of the input, nullptr if the session isn't recorded. */
+    std::unique_ptr<SessionRecorder> myRecorder;
+
     /** The number of made guesses. */
     std::size_t myGuessCount;
 
@@ -85,11 +153,47 @@ private:
     /** Vector holding randomized phrases indexes. */
     std::vector<std::size_t> myPhraseIndexes;
 
+    /** Position of the next phrase to play in the randomized phrase indexes. */
+    std::size_t myPhrasePosition;
+
+    /** Indexes of the phrases guessed incorrectly in the current pass. */
+    std::vector<std::size_t> myIncorrectPhrases;
+
+    /** Indexes of all phrases of the session, to play them again in reverse. */
+    std::vector<std::size_t> mySessionPhrases;
+
+    /** Indicate whether the session is played again in reverse. */
+    bool mySecondDirection;
+
     /** Indicate whether to play the game in reverse. */
     bool myReverse;
 
     /** Indicate whether incorrectly guesses phrases have been written to the error file. */
     bool myErrorsWrittenToFile;
+
+    /** Distractor indexes for multiple-choice mode, one per direction (forward, reverse). */
+    std::array<std::unique_ptr<DistractorIndex>, 2U> myDistractorIndexes;
+
+    /** Answer times of the current round, from showing a prompt to receiving the answer. */
+    utils::LatencyHistogram myRoundAnswerTimes;
+
+    /** Processing times of the current round, from receiving an input to waiting for the next. */
+    utils::LatencyHistogram myRoundProcessingTimes;
+
+    /** Answer times per direction (forward, reverse). */
+    std::array<utils::LatencyHistogram, 2U> myAnswerTimes;
+
+    /** Time when the last input was received, to measure the processing time. */
+    std::chrono::steady_clock::time_point myLastInputTime;
+
+    /** Time when the current round ends in timed mode, time_point::max() without limit. */
+    std::chrono::steady_clock::time_point myRoundDeadline;
+
+    /** Session state reused for each checkpoint. */
+    SessionState myCheckpoint;
+
+    /** Writer of the checkpoints, nullptr if the session isn't saved. */
+    std::unique_ptr<CheckpointWriter> myCheckpointWriter;
 };
 } // namespace game
 } // namespace language
\ No newline at end of file
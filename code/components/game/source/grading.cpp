@@ -0,0 +1,40 @@
+/**
+ * @brief Implementation details of the grading rules of language game.
+ */
+#include <string>
+#include <string_view>
+
+#include "game/grading.h"
+#include "utils/phrase.h"
+#include "utils/scan.h"
+#include "utils/utils.h"
+
+namespace language
+{
+namespace game
+{
+// ---------------------------------------------------------------------------
+void removeAdditionalPhraseInfo(std::string &str)
+{
+    const auto i{str.find('(')};
+    if (std::string::npos == i) { return; }
+    str.erase(i);
+    utils::removeTrailingWhitespaces(str);
+}
+
+// ---------------------------------------------------------------------------
+std::string expectedAnswer(const Phrase &phrase, const bool reverse)
+{
+    auto answer{reverse ? phrase.primary : phrase.target};
+    removeAdditionalPhraseInfo(answer);
+    return answer;
+}
+
+// ---------------------------------------------------------------------------
+bool isCorrect(const std::string_view guess, const std::string_view answer) noexcept
+{
+    const auto *last{utils::trimTrailingWhitespaces(guess.data(), guess.data() + guess.size())};
+    return std::string_view{guess.data(), static_cast<std::size_t>(last - guess.data())} == answer;
+}
+} // namespace game
+} // namespace language
@@ -0,0 +1,103 @@
+/**
+ * @brief Implementation details of the input sources of language game.
+ */
+#include "input_source.h"
+#include "utils/input_reader.h"
+#include "utils/utils.h"
+
+namespace language
+{
+namespace game
+{
+namespace
+{
+// ---------------------------------------------------------------------------
+std::uint64_t nanoseconds(const std::chrono::steady_clock::duration duration) noexcept
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+TerminalInput::TerminalInput(const bool timed) noexcept
+    : myTimed{timed}
+{}
+
+// ---------------------------------------------------------------------------
+InputEventType TerminalInput::readLine(std::string &line, const std::chrono::steady_clock::time_point deadline)
+{
+    // In timed mode, all input is read on a separate thread to wait with a deadline.
+    if (!myTimed) { return utils::readLine(line) ? InputEventType::Line : InputEventType::Closed; }
+    auto &reader{utils::InputReader::instance()};
+    if (!reader.readLine(line, deadline)) { return InputEventType::Timeout; }
+    return (line.empty() && reader.closed()) ? InputEventType::Closed : InputEventType::Line;
+}
+
+// ---------------------------------------------------------------------------
+std::chrono::steady_clock::time_point TerminalInput::now() const noexcept
+{
+    return std::chrono::steady_clock::now();
+}
+
+// ---------------------------------------------------------------------------
+ReplayInput::ReplayInput(const std::vector<InputEvent> &events)
+    : myEvents{events}
+    , myNextEvent{}
+    , myTime{}
+    , myLastEventTime{std::chrono::steady_clock::now()}
+    , mySetupTime{}
+    , myEngineTimes{}
+    , myFinished{false}
+    , myOverrun{false}
+{
+    myEngineTimes.reserve(events.size());
+}
+
+// ---------------------------------------------------------------------------
+InputEventType ReplayInput::readLine(std::string &line, std::chrono::steady_clock::time_point)
+{
+    // The game waits for input, so the previous event has been processed.
+    finish();
+    myFinished = false;
+    line.clear();
+    if (myEvents.size() <= myNextEvent) 
+    { 
+        myOverrun = true;
+        return InputEventType::Closed; 
+    }
+
+    const auto &event{myEvents[myNextEvent++]};
+    myTime += std::chrono::microseconds{event.delay};
+    if (InputEventType::Line == event.type) { line = event.line; }
+    myLastEventTime = std::chrono::steady_clock::now();
+    return event.type;
+}
+
+// ---------------------------------------------------------------------------
+std::chrono::steady_clock::time_point ReplayInput::now() const noexcept { return myTime; }
+
+// ---------------------------------------------------------------------------
+void ReplayInput::start() { myLastEventTime = std::chrono::steady_clock::now(); }
+
+// ---------------------------------------------------------------------------
+void ReplayInput::finish()
+{
+    if (myFinished) { return; }
+    myFinished = true;
+
+    // Time after handing out the last event, or before the first event.
+    const auto engineTime{nanoseconds(std::chrono::steady_clock::now() - myLastEventTime)};
+    if (0U == myNextEvent) { mySetupTime = engineTime; }
+    else if (myEngineTimes.size() < myNextEvent) { myEngineTimes.push_back(engineTime); }
+}
+
+// ---------------------------------------------------------------------------
+std::uint64_t ReplayInput::setupTime() const noexcept { return mySetupTime; }
+
+// ---------------------------------------------------------------------------
+const std::vector<std::uint64_t> &ReplayInput::engineTimes() const noexcept { return myEngineTimes; }
+
+// ---------------------------------------------------------------------------
+bool ReplayInput::overrun() const noexcept { return myOverrun; }
+} // namespace game
+} // namespace language
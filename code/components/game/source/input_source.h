@@ -0,0 +1,145 @@
+/**
+ * @brief Sources of the input of language game.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "game/session_log.h"
+
+namespace language
+{
+namespace game
+{
+/**
+ * @brief Interface of the input of the game, which also provides the time seen by the game.
+ */
+class InputSource
+{
+public:
+    /**
+     * @brief Delete input source.
+     */
+    virtual ~InputSource() noexcept = default;
+
+    /**
+     * @brief Wait for the next line until a deadline.
+     *
+     * @param[out] line The entered line, empty unless a line was entered.
+     * @param[in] deadline Time until which to wait, time_point::max() to wait without limit.
+     *
+     * @return The type of the received input.
+     */
+    virtual InputEventType readLine(std::string &line, std::chrono::steady_clock::time_point deadline) = 0;
+
+    /**
+     * @brief Get the current time of the game.
+     *
+     * @return The current time.
+     */
+    virtual std::chrono::steady_clock::time_point now() const noexcept = 0;
+};
+
+/**
+ * @brief Input entered in the terminal.
+ */
+class TerminalInput final : public InputSource
+{
+public:
+    /**
+     * @brief Create terminal input.
+     *
+     * @param[in] timed Wait for input with deadlines, which reads the input on a separate thread.
+     */
+    explicit TerminalInput(bool timed) noexcept;
+
+    InputEventType readLine(std::string &line, std::chrono::steady_clock::time_point deadline) override;
+    std::chrono::steady_clock::time_point now() const noexcept override;
+
+private:
+    /** Indicate whether to wait for input with deadlines. */
+    bool myTimed;
+};
+
+/**
+ * @brief Input replayed from a recorded session, as fast as possible.
+ *
+ *        The time of the game only advances by the recorded delays, so that timeouts and time
+ *        limits are hit exactly as in the recorded session. The time the game spends between
+ *        the events is measured on the steady clock.
+ */
+class ReplayInput final : public InputSource
+{
+public:
+    /**
+     * @brief Create replayed input.
+     *
+     * @param[in] events The recorded events, which must outlive the input.
+     */
+    explicit ReplayInput(const std::vector<InputEvent> &events);
+
+    InputEventType readLine(std::string &line, std::chrono::steady_clock::time_point deadline) override;
+    std::chrono::steady_clock::time_point now() const noexcept override;
+
+    /**
+     * @brief Start measuring, i.e. the game is about to prepare the session.
+     */
+    void start();
+
+    /**
+     * @brief Stop measuring, i.e. the game has finished processing the last event.
+     */
+    void finish();
+
+    /**
+     * @brief Get the time spent by the game before the first event.
+     *
+     * @return The time in nanoseconds.
+     */
+    std::uint64_t setupTime() const noexcept;
+
+    /**
+     * @brief Get the time spent by the game processing each replayed event.
+     *
+     * @return The times in nanoseconds, in the order of the events.
+     */
+    const std::vector<std::uint64_t> &engineTimes() const noexcept;
+
+    /**
+     * @brief Check if the game asked for input after the last event.
+     *
+     * @return True if input was read past the last event, which the recorded game didn't do.
+     */
+    bool overrun() const noexcept;
+
+private:
+    /** Recorded events. */
+    const std::vector<InputEvent> &myEvents;
+
+    /** Index of the next event. */
+    std::size_t myNextEvent;
+
+    /** Time of the game, advanced by the delay of each replayed event. */
+    std::chrono::steady_clock::time_point myTime;
+
+    /** Time the last event was handed to the game, or measuring was started. */
+    std::chrono::steady_clock::time_point myLastEventTime;
+
+    /** Time spent before the first event, in nanoseconds. */
+    std::uint64_t mySetupTime;
+
+    /** Time spent processing each replayed event, in nanoseconds. */
+    std::vector<std::uint64_t> myEngineTimes;
+
+    /** Indicate whether measuring has stopped. */
+    bool myFinished;
+
+    /** Indicate whether input was read past the last event. */
+    bool myOverrun;
+};
+} // namespace game
+} // namespace language
@@ -0,0 +1,83 @@
+/**
+ * @brief Implementation details of language game options.
+ */
+#include <iostream>
+#include <string>
+
+#include "game/options.h"
+#include "utils/arguments.h"
+#include "utils/utils.h"
+
+namespace language
+{
+namespace game
+{
+namespace
+{
+/** Default number of answer options in multiple-choice mode. */
+constexpr std::size_t kDefaultChoiceCount{4U};
+
+/** Minimum number of answer options in multiple-choice mode. */
+constexpr std::size_t kMinChoiceCount{2U};
+
+/** Default time limit per prompt in timed mode, in seconds. */
+constexpr std::size_t kDefaultPromptTimeLimit{10U};
+
+/** Default path to the checkpoint file. */
+constexpr const char *kDefaultCheckpointPath{"session.checkpoint"};
+
+// ---------------------------------------------------------------------------
+StatusMode statusMode(const std::string &mode)
+{
+    if ("compact" == mode) { return StatusMode::Compact; }
+    else if ("quiet" == mode) { return StatusMode::Quiet; }
+    else if (!mode.empty() && ("full" != mode))
+    {
+        std::cerr << "Invalid status mode \"" << mode << "\", using full status!\n\n";
+    }
+    return StatusMode::Full;
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+Options parseOptions(const int argc, const char **argv)
+{
+    const utils::Arguments args{argc, argv};
+    Options options{};
+    options.statusMode = statusMode(args.option("status"));
+
+    // Show at least one distractor besides the correct answer in multiple-choice mode.
+    if (args.hasOption("choices"))
+    {
+        options.choiceCount = utils::max<std::size_t>(
+            args.numericOption("choices", kDefaultChoiceCount), kMinChoiceCount);
+    }
+
+    // Limit the time per prompt and/or per round in timed mode.
+    if (args.hasOption("timed"))
+    {
+        options.promptTimeLimit = std::chrono::seconds{static_cast<std::chrono::seconds::rep>(
+            utils::max<std::size_t>(args.numericOption("timed", kDefaultPromptTimeLimit), std::size_t{1U}))};
+    }
+    options.roundTimeLimit = std::chrono::seconds{
+        static_cast<std::chrono::seconds::rep>(args.numericOption("round-time", 0U))};
+
+    // Resuming a session keeps saving it, to the same file unless another one is given.
+    options.resume         = args.hasOption("resume");
+    options.checkpointPath = args.option("resume");
+    if (options.checkpointPath.empty()) { options.checkpointPath = args.option("checkpoint"); }
+    if (options.checkpointPath.empty() && (options.resume || args.hasOption("checkpoint")))
+    {
+        options.checkpointPath = kDefaultCheckpointPath;
+    }
+
+    // Repeat the phrase selection and order of a session with the same seed.
+    if (!args.option("seed").empty()) 
+    { 
+        options.seed = static_cast<unsigned>(args.numericOption("seed", 0U)); 
+    }
+    options.recordPath = args.option("record");
+    return options;
+}
+} // namespace game
+} // namespace language
@@ -0,0 +1,190 @@
+/**
+ * @brief Implementation details of session checkpoints.
+ */
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "session_checkpoint.h"
+#include "utils/binary_encoding.h"
+#include "utils/metrics.h"
+
+namespace language
+{
+namespace game
+{
+namespace
+{
+/** Magic number at the start of checkpoint files. */
+constexpr char kMagic[]{'L', 'G', 'S', 'C'};
+
+/** Version of the checkpoint format. */
+constexpr std::uint64_t kVersion{1U};
+
+/** Flags of the session state. */
+constexpr unsigned char kReverseFlag{0x01U}, kSecondDirectionFlag{0x02U}, kErrorsWrittenFlag{0x04U};
+
+// ---------------------------------------------------------------------------
+void encode(const SessionState &state, std::string &buffer)
+{
+    buffer.assign(std::begin(kMagic), std::end(kMagic));
+    utils::encodeVarint(kVersion, buffer);
+    utils::encodeFixed(state.fingerprint, buffer);
+    buffer.push_back(static_cast<char>((state.reverse ? kReverseFlag : 0U) |
+        (state.secondDirection ? kSecondDirectionFlag : 0U) | (state.errorsWrittenToFile ? kErrorsWrittenFlag : 0U)));
+    utils::encodeVarint(state.guessCount, buffer);
+    utils::encodeVarint(state.errorCount, buffer);
+    utils::encodeVarint(state.position, buffer);
+    utils::encodeIndexes(state.sessionPhrases, buffer);
+    utils::encodeIndexes(state.phrases, buffer);
+    utils::encodeIndexes(state.phraseIndexes, buffer);
+    utils::encodeIndexes(state.incorrectPhrases, buffer);
+    utils::encodeFixed(utils::checksum(buffer.data(), buffer.data() + buffer.size()), buffer);
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+bool readCheckpoint(const std::string &path, SessionState &state)
+{
+    std::ifstream ifstream{path, std::ios::binary};
+    const std::string data{std::istreambuf_iterator<char>{ifstream}, std::istreambuf_iterator<char>{}};
+    constexpr std::size_t checksumSize{sizeof(std::uint64_t)};
+    if ((sizeof(kMagic) + checksumSize > data.size()) || (0 != data.compare(0U, sizeof(kMagic), kMagic, sizeof(kMagic))))
+    {
+        return false;
+    }
+
+    // Reject torn or modified files before decoding anything.
+    const auto *const payloadEnd{data.data() + data.size() - checksumSize};
+    std::uint64_t storedChecksum{};
+    if (!utils::Decoder{payloadEnd, data.data() + data.size()}.fixed(storedChecksum) ||
+        (utils::checksum(data.data(), payloadEnd) != storedChecksum))
+    {
+        return false;
+    }
+
+    utils::Decoder decoder{data.data() + sizeof(kMagic), payloadEnd};
+    SessionState decoded{};
+    std::uint64_t version{};
+    unsigned char flags{};
+    if (!decoder.varint(version) || (kVersion != version) || !decoder.fixed(decoded.fingerprint) ||
+        !decoder.byte(flags) || !decoder.varint(decoded.guessCount) || !decoder.varint(decoded.errorCount) ||
+        !decoder.varint(decoded.position) || !decoder.indexes(decoded.sessionPhrases) ||
+        !decoder.indexes(decoded.phrases) || !decoder.indexes(decoded.phraseIndexes) ||
+        !decoder.indexes(decoded.incorrectPhrases) || !decoder.done())
+    {
+        return false;
+    }
+    decoded.reverse             = 0U != (flags & kReverseFlag);
+    decoded.secondDirection     = 0U != (flags & kSecondDirectionFlag);
+    decoded.errorsWrittenToFile = 0U != (flags & kErrorsWrittenFlag);
+
+    // The phrase order must refer to the phrases of the pass.
+    if ((decoded.position > decoded.phraseIndexes.size()) || (decoded.errorCount > decoded.guessCount)) { return false; }
+    for (const auto index : decoded.phraseIndexes)
+    {
+        if (index >= decoded.phrases.size()) { return false; }
+    }
+    state = std::move(decoded);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+CheckpointWriter::CheckpointWriter(std::string path)
+    : myPath{std::move(path)}
+    , myFrontBuffer{}
+    , myPendingBuffer{}
+    , myBackBuffer{}
+    , myMutex{}
+    , myCondition{}
+    , myIdleCondition{}
+    , myPending{false}
+    , myWriting{false}
+    , myStopRequested{false}
+    , myThread{}
+{
+    myThread = std::thread{&CheckpointWriter::run, this};
+}
+
+// ---------------------------------------------------------------------------
+CheckpointWriter::~CheckpointWriter() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        myStopRequested = true;
+    }
+    myCondition.notify_one();
+    myThread.join();
+}
+
+// ---------------------------------------------------------------------------
+void CheckpointWriter::write(const SessionState &state)
+{
+    LANGUAGE_METRICS_TIME("checkpoint", "Time spent encoding session checkpoints.");
+    encode(state, myFrontBuffer);
+    {
+        // Swap the buffers, an older state still pending is dropped and its buffer reused.
+        std::lock_guard<std::mutex> lock{myMutex};
+        std::swap(myFrontBuffer, myPendingBuffer);
+        myPending = true;
+    }
+    myCondition.notify_one();
+}
+
+// ---------------------------------------------------------------------------
+void CheckpointWriter::remove()
+{
+    wait();
+    std::remove(myPath.c_str());
+}
+
+// ---------------------------------------------------------------------------
+void CheckpointWriter::wait()
+{
+    std::unique_lock<std::mutex> lock{myMutex};
+    myIdleCondition.wait(lock, [this]() { return !myPending && !myWriting; });
+}
+
+// ---------------------------------------------------------------------------
+void CheckpointWriter::run()
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock{myMutex};
+            myWriting = false;
+            myIdleCondition.notify_all();
+            myCondition.wait(lock, [this]() { return myStopRequested || myPending; });
+            if (!myPending) { return; }
+            std::swap(myPendingBuffer, myBackBuffer);
+            myPending = false;
+            myWriting = true;
+        }
+        writeFile(myBackBuffer);
+    }
+}
+
+// ---------------------------------------------------------------------------
+bool CheckpointWriter::writeFile(const std::string &data) const
+{
+    LANGUAGE_METRICS_TIME("checkpoint_write", "Time spent writing session checkpoints.");
+
+    // Write next to the checkpoint, sync and rename, which replaces the checkpoint atomically.
+    const auto tempPath{myPath + ".tmp"};
+    const auto file{::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)};
+    if (0 > file) { return false; }
+    std::size_t size{};
+    for (ssize_t count{}; (data.size() > size) && (0 < (count = ::write(file, data.data() + size, data.size() - size))); )
+    {
+        size += static_cast<std::size_t>(count);
+    }
+    const bool written{(data.size() == size) && (0 == ::fsync(file))};
+    ::close(file);
+    return written && (0 == std::rename(tempPath.c_str(), myPath.c_str()));
+}
+} // namespace game
+} // namespace language
@@ -0,0 +1,148 @@
+/**
+ * @brief Checkpoints of game sessions, to resume a session after the game has been closed.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace language
+{
+namespace game
+{
+/**
+ * @brief State of a game session, i.e. everything needed to continue it after the last answer.
+ */
+struct SessionState
+{
+    /** Hash of the session phrases, to detect changes of the phrase file before resuming. */
+    std::uint64_t fingerprint{};
+
+    /** Indicate whether the current round is played in reverse. */
+    bool reverse{};
+
+    /** Indicate whether the session is played again in the other direction. */
+    bool secondDirection{};
+
+    /** Indicate whether the incorrectly guessed phrases have been written to the error file. */
+    bool errorsWrittenToFile{};
+
+    /** The number of guesses in the current round. */
+    std::uint64_t guessCount{};
+
+    /** The number of errors in the current round. */
+    std::uint64_t errorCount{};
+
+    /** Position of the next phrase in the phrase indexes. */
+    std::uint64_t position{};
+
+    /** Indexes of all phrases of the session, in the order they were first played. */
+    std::vector<std::size_t> sessionPhrases;
+
+    /** Indexes of the phrases of the current pass of the round. */
+    std::vector<std::size_t> phrases;
+
+    /** Order in which the phrases of the current pass are played. */
+    std::vector<std::size_t> phraseIndexes;
+
+    /** Indexes of the phrases guessed incorrectly in the current pass. */
+    std::vector<std::size_t> incorrectPhrases;
+};
+
+/**
+ * @brief Read a session checkpoint.
+ *
+ * @param[in] path Path to the checkpoint file.
+ * @param[out] state The session state, only updated if the checkpoint is valid.
+ *
+ * @return True if the checkpoint was read and is intact, else false.
+ */
+bool readCheckpoint(const std::string &path, SessionState &state);
+
+/**
+ * @brief Writer of session checkpoints in the background.
+ *
+ *        The state is encoded into one buffer on the calling thread, with variable-length
+ *        integers, and handed over to a writer thread, which writes it to a temporary file and
+ *        renames the file to the checkpoint path. The checkpoint file therefore always holds a
+ *        complete state. If a state hasn't been picked up by the thread when the next one
+ *        arrives, it is replaced, so that the game never waits for the disk.
+ */
+class CheckpointWriter final
+{
+public:
+    /**
+     * @brief Create writer and start its thread.
+     *
+     * @param[in] path Path to the checkpoint file.
+     */
+    explicit CheckpointWriter(std::string path);
+
+    /**
+     * @brief Write the last handed over state, then stop the thread and delete the writer.
+     */
+    ~CheckpointWriter() noexcept;
+
+    /**
+     * @brief Hand over a state to write.
+     *
+     * @param[in] state The session state.
+     */
+    void write(const SessionState &state);
+
+    /**
+     * @brief Wait for pending writes and delete the checkpoint file, e.g. when the session is over.
+     */
+    void remove();
+
+    CheckpointWriter()                                     = delete; // No default constructor.
+    CheckpointWriter(const CheckpointWriter &)             = delete; // No copy constructor.
+    CheckpointWriter(CheckpointWriter &&)                  = delete; // No move constructor.
+    CheckpointWriter & operator=(const CheckpointWriter &) = delete; // No copy assignment.
+    CheckpointWriter & operator=(CheckpointWriter &&)      = delete; // No move assignment.
+
+private:
+    void run();
+    void wait();
+    bool writeFile(const std::string &data) const;
+
+    /** Path to the checkpoint file. */
+    std::string myPath;
+
+    /** Buffer the calling thread encodes into. */
+    std::string myFrontBuffer;
+
+    /** Encoded state waiting for the thread. */
+    std::string myPendingBuffer;
+
+    /** Buffer the thread writes from. */
+    std::string myBackBuffer;
+
+    /** Mutex protecting the pending buffer and the flags. */
+    std::mutex myMutex;
+
+    /** Condition used to wake up the thread when a state was handed over or it is stopped. */
+    std::condition_variable myCondition;
+
+    /** Condition used to wake up waiting callers when the thread is idle. */
+    std::condition_variable myIdleCondition;
+
+    /** Indicate whether the pending buffer holds a state not picked up yet. */
+    bool myPending;
+
+    /** Indicate whether the thread is writing. */
+    bool myWriting;
+
+    /** Indicate whether the thread has been requested to stop. */
+    bool myStopRequested;
+
+    /** Thread writing the checkpoints. */
+    std::thread myThread;
+};
+} // namespace game
+} // namespace language
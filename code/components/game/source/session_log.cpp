@@ -0,0 +1,108 @@
+/**
+ * @brief Implementation details of session recording.
+ */
+#include <iterator>
+#include <utility>
+
+#include "game/session_log.h"
+#include "utils/binary_encoding.h"
+#include "utils/metrics.h"
+
+namespace language
+{
+namespace game
+{
+namespace
+{
+/** Magic number at the start of session logs. */
+constexpr char kMagic[]{'L', 'G', 'S', 'R'};
+
+/** Version of the log format. */
+constexpr std::uint64_t kVersion{1U};
+} // namespace
+
+// ---------------------------------------------------------------------------
+bool readSessionLog(const std::string &path, SessionLog &log)
+{
+    std::ifstream ifstream{path, std::ios::binary};
+    const std::string data{std::istreambuf_iterator<char>{ifstream}, std::istreambuf_iterator<char>{}};
+    if ((sizeof(kMagic) > data.size()) || (0 != data.compare(0U, sizeof(kMagic), kMagic, sizeof(kMagic))))
+    {
+        return false;
+    }
+
+    utils::Decoder decoder{data.data() + sizeof(kMagic), data.data() + data.size()};
+    SessionLog decoded{};
+    auto &header{decoded.header};
+    std::uint64_t version{}, seed{}, choiceCount{}, promptTimeLimit{}, roundTimeLimit{};
+    unsigned char reverse{}, statusMode{};
+    if (!decoder.varint(version) || (kVersion != version) || !decoder.varint(seed) ||
+        !decoder.fixed(header.corpusFingerprint) || !decoder.varint(header.phraseCount) ||
+        !decoder.varint(header.phraseCountToUse) || !decoder.byte(reverse) || !decoder.byte(statusMode) ||
+        !decoder.varint(choiceCount) || !decoder.varint(promptTimeLimit) || !decoder.varint(roundTimeLimit) ||
+        (static_cast<unsigned char>(StatusMode::Quiet) < statusMode))
+    {
+        return false;
+    }
+    header.seed                    = static_cast<unsigned>(seed);
+    header.reverse                 = 0U != reverse;
+    header.options.statusMode      = static_cast<StatusMode>(statusMode);
+    header.options.choiceCount     = static_cast<std::size_t>(choiceCount);
+    header.options.promptTimeLimit = std::chrono::seconds{static_cast<std::chrono::seconds::rep>(promptTimeLimit)};
+    header.options.roundTimeLimit  = std::chrono::seconds{static_cast<std::chrono::seconds::rep>(roundTimeLimit)};
+
+    // Stop at the first incomplete event.
+    for (InputEvent event{}; !decoder.done(); decoded.events.push_back(std::move(event)))
+    {
+        unsigned char type{};
+        if (!decoder.byte(type) || (static_cast<unsigned char>(InputEventType::Closed) < type) ||
+            !decoder.varint(event.delay))
+        {
+            break;
+        }
+        event.type = static_cast<InputEventType>(type);
+        event.line.clear();
+        if ((InputEventType::Line == event.type) && !decoder.text(event.line)) { break; }
+    }
+    log = std::move(decoded);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+SessionRecorder::SessionRecorder(const std::string &path, const SessionHeader &header)
+    : myOstream{path, std::ios::binary | std::ios::trunc}
+    , myBuffer{}
+{
+    myBuffer.assign(std::begin(kMagic), std::end(kMagic));
+    utils::encodeVarint(kVersion, myBuffer);
+    utils::encodeVarint(header.seed, myBuffer);
+    utils::encodeFixed(header.corpusFingerprint, myBuffer);
+    utils::encodeVarint(header.phraseCount, myBuffer);
+    utils::encodeVarint(header.phraseCountToUse, myBuffer);
+    myBuffer.push_back(static_cast<char>(header.reverse ? 1U : 0U));
+    myBuffer.push_back(static_cast<char>(header.options.statusMode));
+    utils::encodeVarint(header.options.choiceCount, myBuffer);
+    utils::encodeVarint(static_cast<std::uint64_t>(header.options.promptTimeLimit.count()), myBuffer);
+    utils::encodeVarint(static_cast<std::uint64_t>(header.options.roundTimeLimit.count()), myBuffer);
+    myOstream.write(myBuffer.data(), static_cast<std::streamsize>(myBuffer.size()));
+    myOstream.flush();
+}
+
+// ---------------------------------------------------------------------------
+bool SessionRecorder::good() const noexcept { return myOstream.good(); }
+
+// ---------------------------------------------------------------------------
+void SessionRecorder::record(const InputEvent &event)
+{
+    LANGUAGE_METRICS_TIME("record", "Time spent recording input events.");
+    myBuffer.clear();
+    myBuffer.push_back(static_cast<char>(event.type));
+    utils::encodeVarint(event.delay, myBuffer);
+    if (InputEventType::Line == event.type) { utils::encodeText(event.line, myBuffer); }
+
+    // Flush each event, the game may be closed at any input.
+    myOstream.write(myBuffer.data(), static_cast<std::streamsize>(myBuffer.size()));
+    myOstream.flush();
+}
+} // namespace game
+} // namespace language
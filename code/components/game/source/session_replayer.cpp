@@ -0,0 +1,62 @@
+/**
+ * @brief Implementation details of class language::game::SessionReplayer.
+ */
+#include <memory>
+#include <utility>
+
+#include "dictionary/adapter_interface.h"
+#include "game/session_replayer.h"
+#include "game_impl.h"
+#include "input_source.h"
+
+namespace language
+{
+namespace game
+{
+// ---------------------------------------------------------------------------
+SessionReplayer::SessionReplayer(dictionary::AdapterInterface &dictionaryAdapter, const SessionLog &log)
+    : myAdapter{dictionaryAdapter}
+    , myLog{log}
+    , mySetupTime{}
+    , myEngineTimes{}
+{}
+
+// ---------------------------------------------------------------------------
+ReplayResult SessionReplayer::replay(std::ostream &ostream)
+{
+    // Play with the recorded options and seed, without checkpoints, recording or error files.
+    const auto &header{myLog.header};
+    Options options{};
+    options.statusMode      = header.options.statusMode;
+    options.choiceCount     = header.options.choiceCount;
+    options.promptTimeLimit = header.options.promptTimeLimit;
+    options.roundTimeLimit  = header.options.roundTimeLimit;
+    options.seed            = header.seed;
+    options.writeErrorFiles = false;
+
+    if ((myAdapter.phraseCount() != header.phraseCount) || (myAdapter.phraseCountToUse() != header.phraseCountToUse))
+    {
+        return ReplayResult::PhrasesChanged;
+    }
+    auto input{std::make_unique<ReplayInput>(myLog.events)};
+    auto &replayInput{*input};
+    GameImpl game{myAdapter, options, std::move(input), ostream};
+    if (game.corpusFingerprint() != header.corpusFingerprint) { return ReplayResult::PhrasesChanged; }
+
+    replayInput.start();
+    game.play(header.reverse);
+    replayInput.finish();
+
+    mySetupTime   = replayInput.setupTime();
+    myEngineTimes = replayInput.engineTimes();
+    return ((myLog.events.size() == myEngineTimes.size()) && !replayInput.overrun()) ? ReplayResult::Replayed 
+                                                                                     : ReplayResult::Diverged;
+}
+
+// ---------------------------------------------------------------------------
+std::uint64_t SessionReplayer::setupTime() const noexcept { return mySetupTime; }
+
+// ---------------------------------------------------------------------------
+const std::vector<std::uint64_t> &SessionReplayer::engineTimes() const noexcept { return myEngineTimes; }
+} // namespace game
+} // namespace language
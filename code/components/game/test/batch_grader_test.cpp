@@ -0,0 +1,151 @@
+/**
+ * @brief Unit test for class language::game::BatchGrader.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/adapter.h"
+#include "dictionary/dictionary.h"
+#include "game/batch_grader.h"
+#include "game/grading.h"
+#include "utils/phrase.h"
+
+namespace
+{
+using namespace language;
+
+/** Phrases the answers refer to. */
+const std::list<Phrase> kPhrases{
+    {"Good morning (formal)", "Guten Morgen"},
+    {"See you later", "Bis später (informal)"},
+    {"I hope it will be a great aid to you.", "Ich hoffe, es wird dir eine grosse Hilfe sein."},
+    {"Thank you", "Danke"}};
+
+/** Guesses cycled through by the answers, some correct in either direction. */
+const std::vector<std::string> kGuesses{
+    "Guten Morgen", "Guten Morgen  ", "guten Morgen", "Good morning", "Bis später", "Bis spater",
+    "See you later", "later See you", "Ich hoffe es wird dir eine Hilfe sein.",
+    "Ich hoffe, es wird dir eine grosse Hilfe sein.", "Danke", "Thank you", "Thank", ""};
+
+/** The number of valid answers, spanning several batches with a partial last batch. */
+constexpr std::size_t kAnswerCount{3U * game::BatchGrader::kBatchSize + 17U};
+
+/** Rows referring to no phrase, every 1000th row. */
+constexpr std::size_t kInvalidRowInterval{1000U};
+
+/**
+ * @brief Expected statistics of a phrase, computed sequentially.
+ */
+struct ExpectedStatistics
+{
+    /** The number of answers. */
+    std::uint64_t answerCount{};
+
+    /** The number of correct answers. */
+    std::uint64_t correctCount{};
+};
+
+// -----------------------------------------------------------------------------
+std::vector<ExpectedStatistics> writeAnswers(const std::string &filePath, const bool reverse,
+                                             std::size_t &invalidRowCount)
+{
+    const std::vector<Phrase> phrases{kPhrases.begin(), kPhrases.end()};
+    std::vector<ExpectedStatistics> statistics(phrases.size());
+    std::ofstream ostream{filePath};
+    ostream << "phrase_id\tguess\n";
+    invalidRowCount = 0U;
+
+    for (std::size_t i{}; i < kAnswerCount; ++i)
+    {
+        if (0U == i % kInvalidRowInterval)
+        {
+            ostream << ((0U == i % (2U * kInvalidRowInterval)) ? "0" : "x") << "\tGuten Morgen\n";
+            ++invalidRowCount;
+        }
+        const auto phraseIndex{(i / 3U) % phrases.size()};
+        const auto &guess{kGuesses[i % kGuesses.size()]};
+        ostream << phraseIndex + 1U << "\t" << guess << "\n";
+        ++statistics[phraseIndex].answerCount;
+        if (game::isCorrect(guess, game::expectedAnswer(phrases[phraseIndex], reverse)))
+        {
+            ++statistics[phraseIndex].correctCount;
+        }
+    }
+    return statistics;
+}
+
+/**
+ * @brief Verify that all answers are graded like game::isCorrect() grades them, and that the
+ *        results don't depend on the number of threads.
+ */
+TEST(BatchGraderTest, ThreadCountTest)
+{
+    constexpr const char *filePath{"batch_grader_answers.tsv"};
+    dictionary::Adapter adapter{kPhrases};
+    dictionary::Dictionary dictionary{adapter};
+
+    for (const bool reverse : {false, true})
+    {
+        std::size_t invalidRowCount{};
+        const auto expected{writeAnswers(filePath, reverse, invalidRowCount)};
+        std::string firstOutput{};
+        std::vector<game::PhraseStatistics> firstStatistics{};
+
+        for (const std::size_t threadCount : {1U, 2U, 4U, 8U})
+        {
+            game::BatchGrader grader{dictionary, reverse, threadCount};
+            ASSERT_TRUE(grader.grade(filePath, true));
+
+            // Expect each valid answer to be graded exactly once.
+            EXPECT_EQ(grader.answerCount(), kAnswerCount);
+            EXPECT_EQ(grader.invalidRowCount(), invalidRowCount);
+            const auto &statistics{grader.statistics()};
+            ASSERT_EQ(statistics.size(), expected.size());
+            for (std::size_t i{}; i < statistics.size(); ++i)
+            {
+                EXPECT_EQ(statistics[i].answerCount, expected[i].answerCount) << "Threads " << threadCount;
+                EXPECT_EQ(statistics[i].correctCount, expected[i].correctCount) << "Threads " << threadCount;
+            }
+
+            // Expect the same statistics and report as with a single thread.
+            std::ostringstream output{};
+            grader.write(output);
+            if (1U == threadCount)
+            {
+                firstOutput     = output.str();
+                firstStatistics = statistics;
+                continue;
+            }
+            EXPECT_EQ(output.str(), firstOutput) << "Threads " << threadCount;
+            for (std::size_t i{}; i < statistics.size(); ++i)
+            {
+                EXPECT_EQ(statistics[i].missingWordCount, firstStatistics[i].missingWordCount);
+                EXPECT_EQ(statistics[i].extraWordCount, firstStatistics[i].extraWordCount);
+                EXPECT_EQ(statistics[i].swappedWordCount, firstStatistics[i].swappedWordCount);
+                EXPECT_EQ(statistics[i].misspelledWordCount, firstStatistics[i].misspelledWordCount);
+            }
+        }
+    }
+    std::remove(filePath);
+}
+
+/**
+ * @brief Verify that a missing file isn't graded.
+ */
+TEST(BatchGraderTest, MissingFileTest)
+{
+    dictionary::Adapter adapter{kPhrases};
+    dictionary::Dictionary dictionary{adapter};
+    game::BatchGrader grader{dictionary, false, 2U};
+    EXPECT_FALSE(grader.grade("missing_answers.tsv", false));
+    EXPECT_EQ(grader.answerCount(), 0U);
+}
+} // namespace
@@ -0,0 +1,244 @@
+/**
+ * @brief Unit test for class language::game::DistractorIndex, and of the answer options shown
+ *        by the game in multiple-choice mode.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/adapter.h"
+#include "distractor_index.h"
+#include "game_impl.h"
+#include "input_source.h"
+#include "utils/phrase.h"
+
+namespace
+{
+using namespace language;
+
+/** Text shown after the answer options. */
+const std::string kChoicePrompt{"Enter the number or the text of your answer:\n"};
+
+/** Text shown before each phrase to translate. */
+const std::string kPrompt{"Translate the following phrase:\n"};
+
+// -----------------------------------------------------------------------------
+std::set<std::string> trigrams(const std::string &text)
+{
+    // Trigrams of the text padded with spaces, ignoring the case of ASCII letters.
+    std::string padded{" " + text + " "};
+    for (auto &c : padded) { c = (('A' <= c) && ('Z' >= c)) ? static_cast<char>(c - 'A' + 'a') : c; }
+    std::set<std::string> result{};
+    for (std::size_t i{}; i + 3U <= padded.size(); ++i) { result.insert(padded.substr(i, 3U)); }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+std::size_t sharedTrigramCount(const std::string &x, const std::string &y)
+{
+    const auto xTrigrams{trigrams(x)}, yTrigrams{trigrams(y)};
+    return static_cast<std::size_t>(std::count_if(xTrigrams.begin(), xTrigrams.end(),
+        [&yTrigrams](const std::string &trigram) { return 0U != yTrigrams.count(trigram); }));
+}
+
+// -----------------------------------------------------------------------------
+double similarity(const std::string &answer, const std::string &candidate)
+{
+    // Dice similarity of the trigrams, penalized by the length difference.
+    const auto dice{2.0 * sharedTrigramCount(answer, candidate) /
+                    (trigrams(answer).size() + trigrams(candidate).size())};
+    return dice - 0.01 * std::abs(static_cast<double>(candidate.size()) - answer.size());
+}
+
+// -----------------------------------------------------------------------------
+void expectValidDistractors(const std::vector<std::string> &distractors, const std::string &answer)
+{
+    EXPECT_EQ(std::set<std::string>(distractors.begin(), distractors.end()).size(), distractors.size());
+    EXPECT_EQ(std::count(distractors.begin(), distractors.end(), answer), 0);
+}
+
+/**
+ * @brief Input choosing the number of the correct answer option at each prompt, and recording
+ *        the shown options. Any other question is answered with no.
+ */
+class ChoosingInput final : public game::InputSource
+{
+public:
+    /** @brief Create input, reading the prompts from the output of the game. */
+    ChoosingInput(const std::ostringstream &output, const std::list<Phrase> &phrases,
+                  std::vector<std::pair<std::string, std::vector<std::string>>> &shownChoices)
+        : myOutput{output}
+        , myAnswers{}
+        , myShownChoices{shownChoices}
+    {
+        for (const auto &phrase : phrases) { myAnswers.emplace(phrase.primary, phrase.target); }
+    }
+
+    /** @brief Choose the correct option at a prompt with options, else answer the question. */
+    game::InputEventType readLine(std::string &line, std::chrono::steady_clock::time_point) override
+    {
+        const auto output{myOutput.str()};
+        line = "n";
+        if ((output.size() < kChoicePrompt.size()) ||
+            (0 != output.compare(output.size() - kChoicePrompt.size(), kChoicePrompt.size(), kChoicePrompt)))
+        {
+            return game::InputEventType::Line;
+        }
+
+        // The phrase is followed by the options, formatted as "  <number>) <option>".
+        std::istringstream istream{output.substr(output.rfind(kPrompt) + kPrompt.size())};
+        std::string shown{}, text{};
+        std::getline(istream, shown);
+        std::vector<std::string> choices{};
+        while (std::getline(istream, text) && (kChoicePrompt != text + "\n"))
+        {
+            choices.push_back(text.substr(text.find(") ") + 2U));
+        }
+        const auto &answer{myAnswers.at(shown)};
+        const auto choice{std::find(choices.begin(), choices.end(), answer)};
+        if (choices.end() != choice) { line = std::to_string(choice - choices.begin() + 1); }
+        myShownChoices.emplace_back(answer, choices);
+        return game::InputEventType::Line;
+    }
+
+    /** @brief Get the time, which doesn't matter without time limits. */
+    std::chrono::steady_clock::time_point now() const noexcept override { return {}; }
+
+private:
+    /** Output of the game. */
+    const std::ostringstream &myOutput;
+
+    /** Answers by shown phrase. */
+    std::map<std::string, std::string> myAnswers;
+
+    /** The answer and the options shown at each prompt. */
+    std::vector<std::pair<std::string, std::vector<std::string>>> &myShownChoices;
+};
+
+/**
+ * @brief Verify that lexically similar answers are ranked by trigram similarity, and that
+ *        distractors are distinct and never equal to the answer.
+ */
+TEST(DistractorIndexTest, RankingTest)
+{
+    const std::vector<std::string> answers{
+        "Guten Morgen", "Guten Abend", "Guten Tag", "Gute Nacht", "Morgen", "Danke", "Bitte",
+        "guten morgen!", "Guten Morgen", "Morgenstern", "Sorgen"};
+    const game::DistractorIndex index{answers};
+
+    for (const std::string answer : {"Guten Morgen", "Guten Abend", "Morgen"})
+    {
+        // Rank the distinct answers sharing trigrams with the answer, first ones first on ties.
+        std::vector<std::string> similar{};
+        for (const auto &candidate : answers)
+        {
+            if ((candidate == answer) || (0U == sharedTrigramCount(answer, candidate)) ||
+                (similar.end() != std::find(similar.begin(), similar.end(), candidate)))
+            {
+                continue;
+            }
+            similar.push_back(candidate);
+        }
+        std::stable_sort(similar.begin(), similar.end(), [&answer](const auto &x, const auto &y)
+        {
+            return similarity(answer, x) > similarity(answer, y);
+        });
+
+        for (std::size_t count{}; count <= similar.size(); ++count)
+        {
+            const auto distractors{index.distractors(answer, count)};
+            expectValidDistractors(distractors, answer);
+            EXPECT_EQ(distractors, std::vector<std::string>(similar.begin(), similar.begin() + count))
+                << "Answer \"" << answer << "\", count " << count;
+        }
+    }
+
+    // Expect the case to be ignored.
+    EXPECT_EQ(index.distractors("Guten Morgen", 1U), std::vector<std::string>{"guten morgen!"});
+}
+
+/**
+ * @brief Verify that answers closest in length fill up too few similar answers, and that fewer
+ *        distractors than asked for are found if there are too few answers.
+ */
+TEST(DistractorIndexTest, FallbackTest)
+{
+    const game::DistractorIndex index{{"Guten Morgen", "Guten Tag", "xy", "abcdefghijk", "q", "", "xy"}};
+
+    // The similar answer first, then the others closest in length.
+    auto distractors{index.distractors("Guten Morgen", 3U)};
+    expectValidDistractors(distractors, "Guten Morgen");
+    EXPECT_EQ(distractors, (std::vector<std::string>{"Guten Tag", "abcdefghijk", "xy"}));
+
+    // All other answers, without the duplicate and the empty answer.
+    distractors = index.distractors("Guten Morgen", 10U);
+    expectValidDistractors(distractors, "Guten Morgen");
+    EXPECT_EQ(distractors.size(), 4U);
+
+    // Answers without similar answers, which aren't in the index.
+    distractors = index.distractors("zz", 10U);
+    expectValidDistractors(distractors, "zz");
+    EXPECT_EQ(distractors.size(), 5U);
+    EXPECT_EQ(distractors.front(), "xy");
+    EXPECT_TRUE(index.distractors("Guten Morgen", 0U).empty());
+
+    // Expect no distractors if the answer is the only answer.
+    const game::DistractorIndex singleIndex{{"eins", "eins"}};
+    EXPECT_TRUE(singleIndex.distractors("eins", 3U).empty());
+}
+
+/**
+ * @brief Verify that the game shows the answer among distinct options, one option per phrase if
+ *        there are fewer phrases than options, and accepts the number of the correct option.
+ */
+TEST(DistractorIndexTest, MultipleChoiceTest)
+{
+    const std::list<Phrase> phrases{
+        {"Good morning", "Guten Morgen"}, {"Good evening", "Guten Abend"}, {"Good day", "Guten Tag"},
+        {"Good night", "Gute Nacht"}, {"Thank you", "Danke"}, {"Please (formal)", "Bitte"}};
+
+    for (const auto phraseCount : {phrases.size(), std::size_t{2U}})
+    {
+        const std::list<Phrase> played{phrases.begin(), std::next(phrases.begin(), phraseCount)};
+        game::Options options{};
+        options.seed            = 3U;
+        options.statusMode      = game::StatusMode::Quiet;
+        options.writeErrorFiles = false;
+        options.choiceCount     = 4U;
+
+        std::ostringstream output{};
+        std::vector<std::pair<std::string, std::vector<std::string>>> shownChoices{};
+        dictionary::Adapter adapter{played};
+        game::GameImpl game{adapter, options, std::make_unique<ChoosingInput>(output, played, shownChoices),
+                            output};
+        ASSERT_TRUE(game.play(false));
+
+        // Expect each phrase to be answered correctly by choosing the number of its answer.
+        ASSERT_EQ(shownChoices.size(), phraseCount);
+        for (const auto &[answer, choices] : shownChoices)
+        {
+            EXPECT_EQ(choices.size(), std::min(options.choiceCount, phraseCount));
+            EXPECT_EQ(std::set<std::string>(choices.begin(), choices.end()).size(), choices.size());
+            EXPECT_EQ(std::count(choices.begin(), choices.end(), answer), 1) << "Answer \"" << answer << "\"";
+        }
+        std::size_t correctCount{};
+        for (auto position{output.str().find("Correct answer!")}; std::string::npos != position;
+             position = output.str().find("Correct answer!", position + 1U))
+        {
+            ++correctCount;
+        }
+        EXPECT_EQ(correctCount, phraseCount);
+    }
+}
+} // namespace
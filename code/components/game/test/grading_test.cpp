@@ -0,0 +1,205 @@
+/**
+ * @brief Unit test of the grading shared by language::game::GameImpl and language::game::BatchGrader.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/adapter.h"
+#include "game/grading.h"
+#include "game_impl.h"
+#include "input_source.h"
+#include "utils/phrase.h"
+
+namespace
+{
+using namespace language;
+
+/** Text shown before each phrase to translate. */
+const std::string kPrompt{"Translate the following phrase:\n"};
+
+/** Question asked after the first direction. */
+const std::string kReverseQuestion{"Do you wanna play the game in reverse? Y/n\n"};
+
+/**
+ * @brief Guess entered at a prompt.
+ */
+struct Guess
+{
+    /** The phrase to translate. */
+    Phrase phrase;
+
+    /** Indicate whether the phrase was played in reverse. */
+    bool reverse;
+
+    /** The entered guess. */
+    std::string guess;
+
+    /** Size of the output when the guess was entered, the game grades it after that. */
+    std::size_t outputSize;
+};
+
+/**
+ * @brief Input entering scripted guesses at the prompts shown by the game, and recording them.
+ *
+ *        At each prompt, the next scripted guess for the shown text is entered, and the answer
+ *        once all guesses are used up. The game is played again in reverse, and no error is
+ *        analyzed.
+ */
+class ScriptedInput final : public game::InputSource
+{
+public:
+    /** @brief Create input, reading the prompts from the output of the game. */
+    ScriptedInput(const std::ostringstream &output, const std::list<Phrase> &phrases,
+                  std::map<std::string, std::vector<std::string>> guesses, std::vector<Guess> &enteredGuesses)
+        : myOutput{output}
+        , myPhrases{}
+        , myGuesses{std::move(guesses)}
+        , myEnteredGuesses{enteredGuesses}
+        , myTime{}
+    {
+        for (const auto &phrase : phrases)
+        {
+            myPhrases.emplace(phrase.primary, std::make_pair(phrase, false));
+            myPhrases.emplace(phrase.target, std::make_pair(phrase, true));
+        }
+    }
+
+    /** @brief Enter the next guess at a prompt, else answer the question. */
+    game::InputEventType readLine(std::string &line, std::chrono::steady_clock::time_point) override
+    {
+        myTime += std::chrono::seconds{1};
+        const auto output{myOutput.str()};
+        const auto prompt{output.rfind(kPrompt)};
+        const auto shown{(std::string::npos == prompt) ? std::string{} : output.substr(prompt + kPrompt.size())};
+
+        // Only the prompt and the shown text follow the prompt as long as no guess was entered.
+        if (shown.empty() || (shown.find('\n') + 1U != shown.size()))
+        {
+            line = ((output.size() >= kReverseQuestion.size()) &&
+                    (0 == output.compare(output.size() - kReverseQuestion.size(), kReverseQuestion.size(),
+                                         kReverseQuestion))) ? "y" : "n";
+            return game::InputEventType::Line;
+        }
+
+        const auto text{shown.substr(0U, shown.size() - 1U)};
+        const auto &[phrase, reverse]{myPhrases.at(text)};
+        auto &guesses{myGuesses[text]};
+        if (guesses.empty()) { line = reverse ? phrase.primary : phrase.target; }
+        else
+        {
+            line = guesses.front();
+            guesses.erase(guesses.begin());
+        }
+        myEnteredGuesses.push_back(Guess{phrase, reverse, line, output.size()});
+        return game::InputEventType::Line;
+    }
+
+    /** @brief Get the time, advanced by a second per line. */
+    std::chrono::steady_clock::time_point now() const noexcept override { return myTime; }
+
+private:
+    /** Output of the game. */
+    const std::ostringstream &myOutput;
+
+    /** Phrases and their direction by shown text. */
+    std::map<std::string, std::pair<Phrase, bool>> myPhrases;
+
+    /** Guesses still to enter by shown text. */
+    std::map<std::string, std::vector<std::string>> myGuesses;
+
+    /** Guesses entered so far. */
+    std::vector<Guess> &myEnteredGuesses;
+
+    /** Time of the game. */
+    std::chrono::steady_clock::time_point myTime;
+};
+
+/**
+ * @brief Verify that the game grades guesses exactly like game::isCorrect() against
+ *        game::expectedAnswer(), which BatchGrader relies on, in both directions.
+ */
+TEST(GradingTest, GameConsistencyTest)
+{
+    const std::list<Phrase> phrases{
+        {"Good morning (formal)", "Guten Morgen"},
+        {"See you later", "Bis später (informal)"},
+        {"Thank you", "Danke"}};
+    std::map<std::string, std::vector<std::string>> guesses{
+        {"Good morning (formal)", {"guten Morgen", "Guten  Morgen", "Guten Morgen (formal)", "Guten Morgen \t "}},
+        {"Guten Morgen",          {"Good morning (formal)", "Good morning\r"}},
+        {"See you later",         {"Bis später (informal)", "Bis spater", " Bis später", "Bis später  "}},
+        {"Bis später (informal)", {"See you", "See you later later", "See you later\t"}},
+        {"Thank you",             {"", "Danke!", "Danke\n"}},
+        {"Danke",                 {"Thank  you", "Thank you"}}};
+
+    game::Options options{};
+    options.seed            = 1U;
+    options.statusMode      = game::StatusMode::Quiet;
+    options.writeErrorFiles = false;
+
+    std::ostringstream output{};
+    std::vector<Guess> enteredGuesses{};
+    dictionary::Adapter adapter{phrases};
+    game::GameImpl game{adapter, options,
+                        std::make_unique<ScriptedInput>(output, phrases, guesses, enteredGuesses), output};
+    ASSERT_TRUE(game.play(false));
+
+    // Expect all guesses to be entered, only the last guess of each phrase being correct.
+    std::size_t guessCount{};
+    for (const auto &[text, phraseGuesses] : guesses) { guessCount += phraseGuesses.size(); }
+    EXPECT_EQ(enteredGuesses.size(), guessCount);
+
+    const auto text{output.str()};
+    for (const auto &entered : enteredGuesses)
+    {
+        // The verdict of the game is the first one shown after the guess was entered.
+        const auto correct{text.find("Correct answer!\n", entered.outputSize)};
+        const auto wrong{text.find("Wrong answer!\n", entered.outputSize)};
+        ASSERT_NE(std::min(correct, wrong), std::string::npos);
+        EXPECT_EQ(correct < wrong,
+                  game::isCorrect(entered.guess, game::expectedAnswer(entered.phrase, entered.reverse)))
+            << "Guess \"" << entered.guess << "\" for \"" << entered.phrase.primary << "\"";
+    }
+}
+
+/**
+ * @brief Verify the expected answers and the grading of trailing whitespaces and additional info.
+ */
+TEST(GradingTest, IsCorrectTest)
+{
+    const Phrase phrase{"Good morning (formal)", "Guten Morgen"};
+    EXPECT_EQ(game::expectedAnswer(phrase, false), "Guten Morgen");
+    EXPECT_EQ(game::expectedAnswer(phrase, true), "Good morning");
+
+    EXPECT_TRUE(game::isCorrect("Guten Morgen", "Guten Morgen"));
+    EXPECT_TRUE(game::isCorrect("Guten Morgen \t\r\n", "Guten Morgen"));
+    EXPECT_FALSE(game::isCorrect(" Guten Morgen", "Guten Morgen"));
+    EXPECT_FALSE(game::isCorrect("guten Morgen", "Guten Morgen"));
+    EXPECT_FALSE(game::isCorrect("Guten  Morgen", "Guten Morgen"));
+    EXPECT_FALSE(game::isCorrect("", "Guten Morgen"));
+}
+} // namespace
+
+/**
+ * @brief Run tests.
+ *
+ * @param[in] argc The number of input arguments entered from the terminal at runtime.
+ * @param[in] argv Vector storing all input arguments entered from the terminal at runtime.
+ *
+ * @return Success code 0 if all tests succeeded, otherwise a non-zero value.
+ */
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
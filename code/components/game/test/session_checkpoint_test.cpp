@@ -0,0 +1,246 @@
+/**
+ * @brief Unit test of the session checkpoints, i.e. of language::game::readCheckpoint() and
+ *        language::game::CheckpointWriter.
+ */
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "session_checkpoint.h"
+#include "utils/binary_encoding.h"
+
+namespace
+{
+using namespace language;
+
+/** Path to the checkpoint file of the tests. */
+const std::string kPath{"session_checkpoint_test.bin"};
+
+// -----------------------------------------------------------------------------
+std::string readFile(const std::string &filePath)
+{
+    std::ifstream istream{filePath, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{istream}, std::istreambuf_iterator<char>{}};
+}
+
+// -----------------------------------------------------------------------------
+void writeFile(const std::string &filePath, const std::string &data)
+{
+    std::ofstream ostream{filePath, std::ios::binary | std::ios::trunc};
+    ostream << data;
+}
+
+// -----------------------------------------------------------------------------
+bool fileExists(const std::string &filePath)
+{
+    return std::ifstream{filePath}.good();
+}
+
+// -----------------------------------------------------------------------------
+game::SessionState makeState()
+{
+    game::SessionState state{};
+    state.fingerprint         = 0x0123456789ABCDEFULL;
+    state.reverse             = true;
+    state.secondDirection     = false;
+    state.errorsWrittenToFile = true;
+    state.guessCount          = 300U;
+    state.errorCount          = 7U;
+    state.position            = 2U;
+    state.sessionPhrases      = {4U, 0U, 200U, 3U, 70000U};
+    state.phrases             = {4U, 200U, 70000U};
+    state.phraseIndexes       = {2U, 0U, 1U};
+    state.incorrectPhrases    = {200U};
+    return state;
+}
+
+// -----------------------------------------------------------------------------
+void expectEqual(const game::SessionState &x, const game::SessionState &y)
+{
+    EXPECT_EQ(x.fingerprint, y.fingerprint);
+    EXPECT_EQ(x.reverse, y.reverse);
+    EXPECT_EQ(x.secondDirection, y.secondDirection);
+    EXPECT_EQ(x.errorsWrittenToFile, y.errorsWrittenToFile);
+    EXPECT_EQ(x.guessCount, y.guessCount);
+    EXPECT_EQ(x.errorCount, y.errorCount);
+    EXPECT_EQ(x.position, y.position);
+    EXPECT_EQ(x.sessionPhrases, y.sessionPhrases);
+    EXPECT_EQ(x.phrases, y.phrases);
+    EXPECT_EQ(x.phraseIndexes, y.phraseIndexes);
+    EXPECT_EQ(x.incorrectPhrases, y.incorrectPhrases);
+}
+
+// -----------------------------------------------------------------------------
+std::string encode(const game::SessionState &state)
+{
+    // Encoded independently of the writer, following the documented layout of version 1.
+    std::string buffer{"LGSC"};
+    utils::encodeVarint(1U, buffer);
+    utils::encodeFixed(state.fingerprint, buffer);
+    buffer.push_back(static_cast<char>((state.reverse ? 0x01U : 0U) | (state.secondDirection ? 0x02U : 0U) |
+                                       (state.errorsWrittenToFile ? 0x04U : 0U)));
+    utils::encodeVarint(state.guessCount, buffer);
+    utils::encodeVarint(state.errorCount, buffer);
+    utils::encodeVarint(state.position, buffer);
+    utils::encodeIndexes(state.sessionPhrases, buffer);
+    utils::encodeIndexes(state.phrases, buffer);
+    utils::encodeIndexes(state.phraseIndexes, buffer);
+    utils::encodeIndexes(state.incorrectPhrases, buffer);
+    utils::encodeFixed(utils::checksum(buffer.data(), buffer.data() + buffer.size()), buffer);
+    return buffer;
+}
+
+/**
+ * @brief Verify that a written state is read back unchanged, and that the writer writes the
+ *        format of version 1.
+ */
+TEST(SessionCheckpointTest, RoundTripTest)
+{
+    const auto state{makeState()};
+    {
+        game::CheckpointWriter writer{kPath};
+        writer.write(state);
+    }
+    EXPECT_EQ(readFile(kPath), encode(state));
+
+    game::SessionState decoded{};
+    ASSERT_TRUE(game::readCheckpoint(kPath, decoded));
+    expectEqual(decoded, state);
+
+    // Expect an empty session to round trip as well.
+    {
+        game::CheckpointWriter writer{kPath};
+        writer.write(game::SessionState{});
+    }
+    ASSERT_TRUE(game::readCheckpoint(kPath, decoded));
+    expectEqual(decoded, game::SessionState{});
+    std::remove(kPath.c_str());
+}
+
+/**
+ * @brief Verify that modified and truncated checkpoints are rejected, without changing the state.
+ */
+TEST(SessionCheckpointTest, CorruptionTest)
+{
+    const auto data{encode(makeState())};
+    game::SessionState state{};
+    state.guessCount = 1U;
+
+    // Expect each flipped byte to be detected, in the header, the payload and the checksum.
+    for (std::size_t i{}; i < data.size(); ++i)
+    {
+        auto modified{data};
+        modified[i] = static_cast<char>(modified[i] ^ 0x20);
+        writeFile(kPath, modified);
+        EXPECT_FALSE(game::readCheckpoint(kPath, state)) << "Byte " << i;
+    }
+
+    // Expect each truncation to be detected, as after a torn write.
+    for (std::size_t size{}; size < data.size(); ++size)
+    {
+        writeFile(kPath, data.substr(0U, size));
+        EXPECT_FALSE(game::readCheckpoint(kPath, state)) << "Size " << size;
+    }
+
+    // Expect trailing data and a missing file to be rejected.
+    writeFile(kPath, data + '\0');
+    EXPECT_FALSE(game::readCheckpoint(kPath, state));
+    std::remove(kPath.c_str());
+    EXPECT_FALSE(game::readCheckpoint(kPath, state));
+    EXPECT_EQ(state.guessCount, 1U);
+}
+
+/**
+ * @brief Verify that intact checkpoints with a position, phrase order or error count not
+ *        matching the session are rejected.
+ */
+TEST(SessionCheckpointTest, RangeTest)
+{
+    game::SessionState state{};
+    writeFile(kPath, encode(makeState()));
+    ASSERT_TRUE(game::readCheckpoint(kPath, state));
+
+    // Expect the position to be at most the number of phrases of the pass.
+    auto invalid{makeState()};
+    invalid.position = invalid.phraseIndexes.size();
+    writeFile(kPath, encode(invalid));
+    game::SessionState finished{};
+    EXPECT_TRUE(game::readCheckpoint(kPath, finished));
+    invalid.position = invalid.phraseIndexes.size() + 1U;
+    writeFile(kPath, encode(invalid));
+    EXPECT_FALSE(game::readCheckpoint(kPath, state));
+
+    // Expect the phrase order to refer to the phrases of the pass.
+    invalid = makeState();
+    invalid.phraseIndexes.back() = invalid.phrases.size();
+    writeFile(kPath, encode(invalid));
+    EXPECT_FALSE(game::readCheckpoint(kPath, state));
+
+    // Expect no more errors than guesses.
+    invalid = makeState();
+    invalid.errorCount = invalid.guessCount + 1U;
+    writeFile(kPath, encode(invalid));
+    EXPECT_FALSE(game::readCheckpoint(kPath, state));
+
+    // Expect other versions to be rejected.
+    auto data{encode(makeState())};
+    data[4U] = 2;
+    data.resize(data.size() - sizeof(std::uint64_t));
+    utils::encodeFixed(utils::checksum(data.data(), data.data() + data.size()), data);
+    writeFile(kPath, data);
+    EXPECT_FALSE(game::readCheckpoint(kPath, state));
+
+    // Expect the last accepted state to be kept.
+    expectEqual(state, makeState());
+    std::remove(kPath.c_str());
+}
+
+/**
+ * @brief Verify that the writer replaces the checkpoint atomically, with the last handed over
+ *        state, and removes it when asked.
+ */
+TEST(SessionCheckpointTest, AtomicReplaceTest)
+{
+    auto first{makeState()};
+    {
+        game::CheckpointWriter writer{kPath};
+        writer.write(first);
+    }
+    const auto firstData{readFile(kPath)};
+
+    // Keep the old checkpoint open, it stays intact while the new one replaces it.
+    std::ifstream oldFile{kPath, std::ios::binary};
+    ASSERT_TRUE(oldFile.good());
+
+    // Leave a stale temporary file, as if the game had been killed while writing.
+    writeFile(kPath + ".tmp", "torn");
+
+    auto last{makeState()};
+    {
+        game::CheckpointWriter writer{kPath};
+        for (std::uint64_t i{}; i < 100U; ++i)
+        {
+            last.guessCount = 1000U + i;
+            last.sessionPhrases.push_back(i);
+            writer.write(last);
+        }
+    }
+    EXPECT_EQ((std::string{std::istreambuf_iterator<char>{oldFile}, std::istreambuf_iterator<char>{}}), firstData);
+    EXPECT_FALSE(fileExists(kPath + ".tmp"));
+
+    game::SessionState decoded{};
+    ASSERT_TRUE(game::readCheckpoint(kPath, decoded));
+    expectEqual(decoded, last);
+
+    game::CheckpointWriter writer{kPath};
+    writer.write(first);
+    writer.remove();
+    EXPECT_FALSE(fileExists(kPath));
+    EXPECT_FALSE(fileExists(kPath + ".tmp"));
+}
+} // namespace
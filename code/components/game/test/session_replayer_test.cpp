@@ -0,0 +1,149 @@
+/**
+ * @brief Unit test for class language::game::SessionReplayer, with sessions recorded by the game.
+ */
+#include <cstdio>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/adapter.h"
+#include "game/session_log.h"
+#include "game/session_replayer.h"
+#include "game_impl.h"
+#include "input_source.h"
+#include "utils/phrase.h"
+
+namespace
+{
+using namespace language;
+
+/** Path to the session log of the tests. */
+constexpr const char *kLogPath{"session_replayer_test.log"};
+
+/** Phrases of the recorded session, with the same answer whatever the order they're played in. */
+const std::list<Phrase> kPhrases{{"one", "eins"}, {"uno", "eins"}, {"un", "eins"}};
+
+// -----------------------------------------------------------------------------
+game::InputEvent line(const std::string &text)
+{
+    return game::InputEvent{1500000U, game::InputEventType::Line, text};
+}
+
+// -----------------------------------------------------------------------------
+std::vector<std::string> verdicts(const std::string &output)
+{
+    std::vector<std::string> verdicts{};
+    std::istringstream istream{output};
+    for (std::string text{}; std::getline(istream, text); )
+    {
+        if (("Correct answer!" == text) || ("Wrong answer!" == text)) { verdicts.push_back(text); }
+    }
+    return verdicts;
+}
+
+/**
+ * @brief Session recorded from scripted input: a correct answer, a wrong answer without analysis,
+ *        a correct answer, the wrong answer repeated correctly, and no reverse game.
+ */
+class SessionReplayerTest : public testing::Test
+{
+protected:
+    /** @brief Record the scripted session. */
+    void SetUp() override
+    {
+        myScript = {line("eins"), line("x"), line("n"), line("eins"), line("eins"), line("n")};
+        game::Options options{};
+        options.seed            = 7U;
+        options.statusMode      = game::StatusMode::Quiet;
+        options.writeErrorFiles = false;
+        options.recordPath      = kLogPath;
+        {
+            dictionary::Adapter adapter{kPhrases};
+            game::GameImpl game{adapter, options, std::make_unique<game::ReplayInput>(myScript), myOutput};
+            ASSERT_TRUE(game.play(false));
+        }
+        ASSERT_TRUE(game::readSessionLog(kLogPath, myLog));
+    }
+
+    /** @brief Delete the session log. */
+    void TearDown() override { std::remove(kLogPath); }
+
+    /** Scripted input of the recorded session. */
+    std::vector<game::InputEvent> myScript;
+
+    /** Output of the recorded session. */
+    std::ostringstream myOutput;
+
+    /** The recorded session. */
+    game::SessionLog myLog;
+};
+
+/**
+ * @brief Verify that the recorded session holds the scripted input and settings, and that it's
+ *        replayed along the same path.
+ */
+TEST_F(SessionReplayerTest, ReplayedTest)
+{
+    EXPECT_EQ(myLog.header.seed, 7U);
+    EXPECT_EQ(myLog.header.phraseCount, kPhrases.size());
+    EXPECT_FALSE(myLog.header.reverse);
+    ASSERT_EQ(myLog.events.size(), myScript.size());
+    for (std::size_t i{}; i < myScript.size(); ++i)
+    {
+        EXPECT_EQ(myLog.events[i].type, myScript[i].type);
+        EXPECT_EQ(myLog.events[i].delay, myScript[i].delay);
+        EXPECT_EQ(myLog.events[i].line, myScript[i].line);
+    }
+
+    dictionary::Adapter adapter{kPhrases};
+    game::SessionReplayer replayer{adapter, myLog};
+    std::ostringstream output{};
+    EXPECT_EQ(replayer.replay(output), game::ReplayResult::Replayed);
+    EXPECT_EQ(replayer.engineTimes().size(), myScript.size());
+    EXPECT_EQ(verdicts(output.str()), verdicts(myOutput.str()));
+    EXPECT_EQ(verdicts(output.str()), (std::vector<std::string>{"Correct answer!", "Wrong answer!",
+                                                                "Correct answer!", "Correct answer!"}));
+}
+
+/**
+ * @brief Verify that a changed answer or additional input is reported as a divergence.
+ */
+TEST_F(SessionReplayerTest, DivergedTest)
+{
+    dictionary::Adapter adapter{kPhrases};
+    std::ostringstream output{};
+
+    // The correct answer instead of the wrong one leaves a phrase without answer.
+    auto log{myLog};
+    log.events[1U].line = "eins";
+    EXPECT_EQ(game::SessionReplayer(adapter, log).replay(output), game::ReplayResult::Diverged);
+
+    // The game ends before the additional input is consumed.
+    log = myLog;
+    log.events.push_back(line("eins"));
+    game::SessionReplayer replayer{adapter, log};
+    EXPECT_EQ(replayer.replay(output), game::ReplayResult::Diverged);
+    EXPECT_EQ(replayer.engineTimes().size(), myScript.size());
+}
+
+/**
+ * @brief Verify that a session isn't replayed with other phrases.
+ */
+TEST_F(SessionReplayerTest, PhrasesChangedTest)
+{
+    std::ostringstream output{};
+
+    // Same number of phrases, but a different corpus fingerprint.
+    dictionary::Adapter changedAdapter{{{"one", "eins"}, {"uno", "eins"}, {"une", "eins"}}};
+    EXPECT_EQ(game::SessionReplayer(changedAdapter, myLog).replay(output), game::ReplayResult::PhrasesChanged);
+
+    // Fewer phrases.
+    dictionary::Adapter smallerAdapter{{{"one", "eins"}, {"uno", "eins"}}};
+    EXPECT_EQ(game::SessionReplayer(smallerAdapter, myLog).replay(output), game::ReplayResult::PhrasesChanged);
+    EXPECT_TRUE(output.str().empty());
+}
+} // namespace
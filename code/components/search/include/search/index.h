@@ -0,0 +1,196 @@
+/**
+ * @brief Inverted word index over the phrases of a dictionary.
+ */
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace dictionary
+{
+/** Dictionary implementation. */
+class Dictionary;
+} // namespace dictionary
+
+namespace search
+{
+/** Phrase ID, corresponding to the position of the phrase in the dictionary. */
+using PhraseId = std::uint32_t;
+
+/**
+ * @brief Inverted index mapping each word to the phrases containing it, in either language.
+ * 
+ *        Each posting list is stored as ascending phrase IDs, delta encoded and compressed 
+ *        with variable-length integers. Multi-term queries are evaluated as an AND of the 
+ *        posting lists with galloping intersection, starting from the shortest list.
+ *        The index can be saved to and loaded from file to avoid rebuilding it on each launch.
+ */
+class Index final
+{
+public:
+    /**
+     * @brief Create empty index.
+     */
+    Index() noexcept;
+
+    /**
+     * @brief Create index over the phrases of a dictionary.
+     * 
+     * @param[in] dictionary The dictionary to index.
+     */
+    explicit Index(const dictionary::Dictionary &dictionary);
+
+    /**
+     * @brief Delete index.
+     */
+    ~Index() noexcept = default;
+
+    /**
+     * @brief Build the index over the given phrases, replacing the current content.
+     * 
+     * @param[in] phrases The phrases to index, IDs are assigned in list order.
+     */
+    void build(const std::list<Phrase> &phrases);
+
+    /**
+     * @brief Build the index over the phrases of a dictionary, replacing the current content.
+     * 
+     *        The phrases are read in blocks, without a list of all phrases.
+     * 
+     * @param[in] dictionary The dictionary to index, IDs are the positions of the phrases.
+     */
+    void build(const dictionary::Dictionary &dictionary);
+
+    /**
+     * @brief Find phrases containing all words of a query.
+     * 
+     * @param[in] query The query, tokenized the same way as the phrases.
+     * 
+     * @return Ascending IDs of the phrases containing all words of the query.
+     */
+    std::vector<PhraseId> find(const std::string &query) const;
+
+    /**
+     * @brief Find phrases containing all given terms.
+     * 
+     * @param[in] terms The terms to search for, each term is a tokenized word.
+     * 
+     * @return Ascending IDs of the phrases containing all terms.
+     */
+    std::vector<PhraseId> findAll(const std::vector<std::string> &terms) const;
+
+    /**
+     * @brief Get the phrase IDs of a single term.
+     * 
+     * @param[in] term The term to search for.
+     * 
+     * @return Ascending IDs of the phrases containing the term.
+     */
+    std::vector<PhraseId> postings(const std::string &term) const;
+
+    /**
+     * @brief Get the number of distinct words in the index.
+     * 
+     * @return The number of distinct words.
+     */
+    std::size_t termCount() const noexcept;
+
+    /**
+     * @brief Get the number of indexed phrases.
+     * 
+     * @return The number of indexed phrases.
+     */
+    std::size_t phraseCount() const noexcept;
+
+    /**
+     * @brief Get the fingerprint of the indexed phrases.
+     * 
+     * @return The fingerprint of the indexed phrases.
+     */
+    std::uint64_t fingerprint() const noexcept;
+
+    /**
+     * @brief Save the index to file.
+     * 
+     * @param[in] filePath Path to the index file.
+     * 
+     * @return True if the index was saved, otherwise false.
+     */
+    bool save(const std::string &filePath) const;
+
+    /**
+     * @brief Load an index from file.
+     * 
+     *        The index is only loaded if it was built from phrases with the expected fingerprint.
+     * 
+     * @param[in] filePath Path to the index file.
+     * @param[in] expectedFingerprint Fingerprint of the phrases the index must be built from.
+     * 
+     * @return True if the index was loaded, otherwise false.
+     */
+    bool load(const std::string &filePath, std::uint64_t expectedFingerprint);
+
+    /**
+     * @brief Calculate the fingerprint of phrases, used to match saved indexes to phrases, see
+     *        utils::Fingerprint.
+     * 
+     * @param[in] phrases The phrases to calculate the fingerprint of.
+     * 
+     * @return The fingerprint of the phrases.
+     */
+    static std::uint64_t fingerprint(const std::list<Phrase> &phrases) noexcept;
+
+    /**
+     * @brief Calculate the fingerprint of the phrases of a dictionary, reading them in blocks.
+     * 
+     * @param[in] dictionary The dictionary to calculate the fingerprint of.
+     * 
+     * @return The fingerprint of the phrases, equal to the fingerprint of a list of them.
+     */
+    static std::uint64_t fingerprint(const dictionary::Dictionary &dictionary);
+
+private:
+    /** Phrase IDs containing each word, while building the index. */
+    using Postings = std::unordered_map<std::string, std::vector<PhraseId>>;
+
+    static void addPostings(const Phrase &phrase, PhraseId id, Postings &postings);
+    void encode(const Postings &postings, std::size_t phraseCount, std::uint64_t fingerprint);
+
+    /**
+     * @brief Struct representing a compressed posting list.
+     */
+    struct PostingList
+    {
+        /** Offset of the encoded posting list in the posting data. */
+        std::uint64_t offset;
+
+        /** The number of bytes of the encoded posting list. */
+        std::uint32_t size;
+
+        /** The number of phrase IDs in the posting list. */
+        std::uint32_t count;
+    };
+
+    std::vector<PhraseId> decode(const PostingList &postingList) const;
+
+    /** Posting lists of each word. */
+    std::unordered_map<std::string, PostingList> myPostingLists;
+
+    /** Encoded posting lists of all words. */
+    std::vector<std::uint8_t> myPostingData;
+
+    /** The number of indexed phrases. */
+    std::size_t myPhraseCount;
+
+    /** Fingerprint of the indexed phrases. */
+    std::uint64_t myFingerprint;
+};
+} // namespace search
+} // namespace language
@@ -0,0 +1,153 @@
+/**
+ * @brief Suffix array for substring search across the phrases of a dictionary.
+ */
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "search/index.h"
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace dictionary
+{
+/** Dictionary implementation. */
+class Dictionary;
+} // namespace dictionary
+
+namespace search
+{
+/**
+ * @brief Suffix array over the concatenated primary and target texts of all phrases.
+ * 
+ *        Substring queries are answered in O(m log n) time by binary search over the sorted 
+ *        suffixes, where m is the query length and n the total text length. Matching is case 
+ *        insensitive for ASCII letters. The phrases are split into shards, whose suffix arrays 
+ *        are built in parallel with the linear-time SA-IS algorithm. The suffix array can be 
+ *        saved to and loaded from file to avoid rebuilding it on each launch.
+ */
+class SuffixArray final
+{
+public:
+    /**
+     * @brief Create empty suffix array.
+     */
+    SuffixArray() noexcept;
+
+    /**
+     * @brief Create suffix array over the phrases of a dictionary.
+     * 
+     * @param[in] dictionary The dictionary to build the suffix array over.
+     */
+    explicit SuffixArray(const dictionary::Dictionary &dictionary);
+
+    /**
+     * @brief Delete suffix array.
+     */
+    ~SuffixArray() noexcept = default;
+
+    /**
+     * @brief Build the suffix array over the given phrases, replacing the current content.
+     * 
+     * @param[in] phrases The phrases to build the suffix array over, IDs are assigned in list order.
+     * @param[in] threadCount The maximum number of threads to use, 0 uses all available cores.
+     */
+    void build(const std::list<Phrase> &phrases, std::size_t threadCount = 0U);
+
+    /**
+     * @brief Build the suffix array over the phrases of a dictionary, replacing the current content.
+     * 
+     *        The phrases are read in blocks, without a list of all phrases.
+     * 
+     * @param[in] dictionary The dictionary to build the suffix array over, IDs are the positions 
+     *                       of the phrases.
+     * @param[in] threadCount The maximum number of threads to use, 0 uses all available cores.
+     */
+    void build(const dictionary::Dictionary &dictionary, std::size_t threadCount = 0U);
+
+    /**
+     * @brief Find phrases containing a substring, in either language.
+     * 
+     * @param[in] substring The substring to search for.
+     * 
+     * @return Ascending IDs of the phrases containing the substring.
+     */
+    std::vector<PhraseId> find(std::string_view substring) const;
+
+    /**
+     * @brief Get the number of phrases covered by the suffix array.
+     * 
+     * @return The number of phrases.
+     */
+    std::size_t phraseCount() const noexcept;
+
+    /**
+     * @brief Get the number of shards, each shard has a separate suffix array.
+     * 
+     * @return The number of shards.
+     */
+    std::size_t shardCount() const noexcept;
+
+    /**
+     * @brief Save the suffix array to file.
+     * 
+     * @param[in] filePath Path to the suffix array file.
+     * 
+     * @return True if the suffix array was saved, otherwise false.
+     */
+    bool save(const std::string &filePath) const;
+
+    /**
+     * @brief Load a suffix array from file.
+     * 
+     *        The suffix array is only loaded if it was built from phrases with the expected 
+     *        fingerprint, see utils::Fingerprint.
+     * 
+     * @param[in] filePath Path to the suffix array file.
+     * @param[in] expectedFingerprint Fingerprint of the phrases the suffix array must be built from.
+     * 
+     * @return True if the suffix array was loaded, otherwise false.
+     */
+    bool load(const std::string &filePath, std::uint64_t expectedFingerprint);
+
+private:
+    /**
+     * @brief Struct representing a shard of consecutive phrases.
+     */
+    struct Shard
+    {
+        /** ID of the first phrase in the shard. */
+        PhraseId firstId;
+
+        /** Concatenated texts, each text is terminated by a newline. */
+        std::string text;
+
+        /** Start offset of each phrase in the text. */
+        std::vector<std::uint32_t> phraseOffsets;
+
+        /** Start offsets of all suffixes of the text in sorted order. */
+        std::vector<std::int32_t> suffixes;
+    };
+
+    void addPhrase(const Phrase &phrase, PhraseId id, std::size_t shardSize);
+    void buildShards();
+    static void buildShard(Shard &shard);
+    static void findInShard(const Shard &shard, std::string_view substring, 
+                            std::vector<PhraseId> &ids);
+
+    /** Shards of the suffix array. */
+    std::vector<Shard> myShards;
+
+    /** The number of phrases covered by the suffix array. */
+    std::size_t myPhraseCount;
+
+    /** Fingerprint of the phrases. */
+    std::uint64_t myFingerprint;
+};
+} // namespace search
+} // namespace language
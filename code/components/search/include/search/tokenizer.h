@@ -0,0 +1,27 @@
+/**
+ * @brief Tokenizer splitting phrases into searchable words.
+ */
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace language
+{
+namespace search
+{
+/**
+ * @brief Split text into lowercase word tokens.
+ *
+ *        Words consist of ASCII letters and digits, which are converted to lowercase, and 
+ *        non-ASCII bytes, which are kept as is so that UTF-8 encoded letters stay within their 
+ *        words. All other characters separate words.
+ *
+ * @param[in] text The text to tokenize.
+ *
+ * @return Vector holding the tokens in order of appearance.
+ */
+std::vector<std::string> tokenize(std::string_view text);
+} // namespace search
+} // namespace language
@@ -0,0 +1,334 @@
+/**
+ * @brief Implementation details of class language::search::Index.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dictionary/dictionary.h"
+#include "search/index.h"
+#include "search/tokenizer.h"
+#include "utils/fingerprint.h"
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace search
+{
+namespace
+{
+/** Magic number identifying index files. */
+constexpr char kMagic[4U]{'L', 'G', 'I', 'X'};
+
+/** Version of the index file format. */
+constexpr std::uint32_t kVersion{1U};
+
+// ---------------------------------------------------------------------------
+void encodeVarint(std::uint32_t value, std::vector<std::uint8_t> &data)
+{
+    // Store seven bits per byte, the high bit indicates that more bytes follow.
+    while (0x80U <= value)
+    {
+        data.push_back(static_cast<std::uint8_t>(value | 0x80U));
+        value >>= 7U;
+    }
+    data.push_back(static_cast<std::uint8_t>(value));
+}
+
+// ---------------------------------------------------------------------------
+std::uint32_t decodeVarint(const std::uint8_t *&data) noexcept
+{
+    std::uint32_t value{};
+
+    for (std::uint32_t shift{}; ; shift += 7U)
+    {
+        const auto byte{*data++};
+        value |= static_cast<std::uint32_t>(byte & 0x7FU) << shift;
+        if (0U == (byte & 0x80U)) { return value; }
+    }
+}
+
+// ---------------------------------------------------------------------------
+std::vector<PhraseId> intersect(const std::vector<PhraseId> &small, 
+                                const std::vector<PhraseId> &large)
+{
+    std::vector<PhraseId> result{};
+    std::size_t low{};
+
+    for (const auto id : small)
+    {
+        // Gallop ahead with doubling steps until passing the searched ID, then binary search.
+        std::size_t step{1U}, high{low};
+        while ((high < large.size()) && (large[high] < id))
+        {
+            low  = high + 1U;
+            high += step;
+            step *= 2U;
+        }
+        const auto end{large.begin() + std::min(high + 1U, large.size())};
+        const auto match{std::lower_bound(large.begin() + low, end, id)};
+        low = static_cast<std::size_t>(match - large.begin());
+
+        if (low == large.size()) { break; }
+        if (id == *match) { result.push_back(id); }
+    }
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+template <typename T>
+void writeValue(std::ofstream &ofstream, const T &value)
+{
+    ofstream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+// ---------------------------------------------------------------------------
+template <typename T>
+bool readValue(std::ifstream &ifstream, T &value)
+{
+    return static_cast<bool>(ifstream.read(reinterpret_cast<char *>(&value), sizeof(value)));
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+Index::Index() noexcept
+    : myPostingLists{}
+    , myPostingData{}
+    , myPhraseCount{}
+    , myFingerprint{fingerprint(std::list<Phrase>{})}
+{}
+
+// ---------------------------------------------------------------------------
+Index::Index(const dictionary::Dictionary &dictionary)
+    : Index{}
+{
+    build(dictionary);
+}
+
+// ---------------------------------------------------------------------------
+void Index::build(const std::list<Phrase> &phrases)
+{
+    Postings postings{};
+    PhraseId id{};
+    utils::Fingerprint fingerprint{};
+
+    for (const auto &phrase : phrases)
+    {
+        addPostings(phrase, id++, postings);
+        fingerprint.add(phrase);
+    }
+    encode(postings, phrases.size(), fingerprint.value());
+}
+
+// ---------------------------------------------------------------------------
+void Index::build(const dictionary::Dictionary &dictionary)
+{
+    Postings postings{};
+    PhraseId id{};
+    utils::Fingerprint fingerprint{};
+
+    dictionary.forEachPhrase([&](const Phrase &phrase)
+    {
+        addPostings(phrase, id++, postings);
+        fingerprint.add(phrase);
+    });
+    encode(postings, id, fingerprint.value());
+}
+
+// ---------------------------------------------------------------------------
+std::vector<PhraseId> Index::find(const std::string &query) const 
+{ 
+    return findAll(tokenize(query)); 
+}
+
+// ---------------------------------------------------------------------------
+std::vector<PhraseId> Index::findAll(const std::vector<std::string> &terms) const
+{
+    std::vector<const PostingList *> postingLists{};
+
+    for (const auto &term : terms)
+    {
+        // Return no matches if any of the terms is missing.
+        const auto postingList{myPostingLists.find(term)};
+        if (myPostingLists.end() == postingList) { return {}; }
+        postingLists.push_back(&postingList->second);
+    }
+    if (postingLists.empty()) { return {}; }
+
+    // Intersect the shortest lists first to keep intermediate results small.
+    std::sort(postingLists.begin(), postingLists.end(), 
+        [](const PostingList *x, const PostingList *y) { return x->count < y->count; });
+    auto result{decode(*postingLists.front())};
+
+    for (auto i{std::next(postingLists.begin())}; i != postingLists.end() && !result.empty(); ++i)
+    {
+        result = intersect(result, decode(**i));
+    }
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+std::vector<PhraseId> Index::postings(const std::string &term) const
+{
+    const auto postingList{myPostingLists.find(term)};
+    return myPostingLists.end() != postingList ? decode(postingList->second) : std::vector<PhraseId>{};
+}
+
+// ---------------------------------------------------------------------------
+std::size_t Index::termCount() const noexcept { return myPostingLists.size(); }
+
+// ---------------------------------------------------------------------------
+std::size_t Index::phraseCount() const noexcept { return myPhraseCount; }
+
+// ---------------------------------------------------------------------------
+std::uint64_t Index::fingerprint() const noexcept { return myFingerprint; }
+
+// ---------------------------------------------------------------------------
+bool Index::save(const std::string &filePath) const
+{
+    std::ofstream ofstream{filePath, std::ios::binary};
+    if (!ofstream) { return false; }
+
+    ofstream.write(kMagic, sizeof(kMagic));
+    writeValue(ofstream, kVersion);
+    writeValue(ofstream, myFingerprint);
+    writeValue(ofstream, static_cast<std::uint64_t>(myPhraseCount));
+    writeValue(ofstream, static_cast<std::uint64_t>(myPostingLists.size()));
+
+    // Store each word with its encoded posting list.
+    for (const auto &postingList : myPostingLists)
+    {
+        const auto &term{postingList.first};
+        const auto &list{postingList.second};
+        writeValue(ofstream, static_cast<std::uint32_t>(term.size()));
+        ofstream.write(term.data(), static_cast<std::streamsize>(term.size()));
+        writeValue(ofstream, list.count);
+        writeValue(ofstream, list.size);
+        ofstream.write(reinterpret_cast<const char *>(myPostingData.data() + list.offset), list.size);
+    }
+    return static_cast<bool>(ofstream);
+}
+
+// ---------------------------------------------------------------------------
+bool Index::load(const std::string &filePath, const std::uint64_t expectedFingerprint)
+{
+    std::ifstream ifstream{filePath, std::ios::binary};
+    char magic[sizeof(kMagic)]{};
+    std::uint32_t version{};
+    std::uint64_t fingerprint{}, phraseCount{}, termCount{};
+
+    if (!ifstream.read(magic, sizeof(magic)) || (0 != std::memcmp(magic, kMagic, sizeof(kMagic))) ||
+        !readValue(ifstream, version) || (kVersion != version) || 
+        !readValue(ifstream, fingerprint) || (expectedFingerprint != fingerprint) ||
+        !readValue(ifstream, phraseCount) || !readValue(ifstream, termCount))
+    {
+        return false;
+    }
+    std::unordered_map<std::string, PostingList> postingLists{};
+    std::vector<std::uint8_t> postingData{};
+    postingLists.reserve(termCount);
+
+    for (std::uint64_t i{}; i < termCount; ++i)
+    {
+        std::uint32_t termSize{};
+        PostingList list{postingData.size(), 0U, 0U};
+        if (!readValue(ifstream, termSize)) { return false; }
+
+        std::string term(termSize, '\0');
+        if (!ifstream.read(&term[0U], termSize) || !readValue(ifstream, list.count) || 
+            !readValue(ifstream, list.size)) 
+        { 
+            return false; 
+        }
+        postingData.resize(postingData.size() + list.size);
+        if (!ifstream.read(reinterpret_cast<char *>(postingData.data() + list.offset), list.size)) 
+        { 
+            return false; 
+        }
+        postingLists[term] = list;
+    }
+    myPostingLists = std::move(postingLists);
+    myPostingData  = std::move(postingData);
+    myPhraseCount  = static_cast<std::size_t>(phraseCount);
+    myFingerprint  = fingerprint;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+std::uint64_t Index::fingerprint(const std::list<Phrase> &phrases) noexcept
+{
+    utils::Fingerprint fingerprint{};
+    for (const auto &phrase : phrases) { fingerprint.add(phrase); }
+    return fingerprint.value();
+}
+
+// ---------------------------------------------------------------------------
+std::uint64_t Index::fingerprint(const dictionary::Dictionary &dictionary)
+{
+    utils::Fingerprint fingerprint{};
+    dictionary.forEachPhrase([&fingerprint](const Phrase &phrase) { fingerprint.add(phrase); });
+    return fingerprint.value();
+}
+
+// ---------------------------------------------------------------------------
+void Index::addPostings(const Phrase &phrase, const PhraseId id, Postings &postings)
+{
+    for (const auto *text : {&phrase.primary, &phrase.target})
+    {
+        for (auto &token : tokenize(*text))
+        {
+            // IDs are added in ascending order, so repeated words only need to check the last ID.
+            auto &ids{postings[token]};
+            if (ids.empty() || (id != ids.back())) { ids.push_back(id); }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+void Index::encode(const Postings &postings, const std::size_t phraseCount, const std::uint64_t fingerprint)
+{
+    myPostingLists.clear();
+    myPostingData.clear();
+    myPostingLists.reserve(postings.size());
+
+    for (const auto &posting : postings)
+    {
+        const auto offset{myPostingData.size()};
+        PhraseId previousId{};
+
+        for (const auto phraseId : posting.second)
+        {
+            encodeVarint(phraseId - previousId, myPostingData);
+            previousId = phraseId;
+        }
+        myPostingLists[posting.first] = PostingList{offset, 
+            static_cast<std::uint32_t>(myPostingData.size() - offset), 
+            static_cast<std::uint32_t>(posting.second.size())};
+    }
+    myPostingData.shrink_to_fit();
+    myPhraseCount = phraseCount;
+    myFingerprint = fingerprint;
+}
+
+// ---------------------------------------------------------------------------
+std::vector<PhraseId> Index::decode(const PostingList &postingList) const
+{
+    std::vector<PhraseId> ids{};
+    ids.reserve(postingList.count);
+    const auto *data{myPostingData.data() + postingList.offset};
+    PhraseId id{};
+
+    for (std::uint32_t i{}; i < postingList.count; ++i)
+    {
+        id += decodeVarint(data);
+        ids.push_back(id);
+    }
+    return ids;
+}
+} // namespace search
+} // namespace language
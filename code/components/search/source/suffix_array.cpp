@@ -0,0 +1,453 @@
+/**
+ * @brief Implementation details of class language::search::SuffixArray.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "dictionary/dictionary.h"
+#include "search/index.h"
+#include "search/suffix_array.h"
+#include "utils/fingerprint.h"
+#include "utils/metrics.h"
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace search
+{
+namespace
+{
+/** Magic number identifying suffix array files. */
+constexpr char kMagic[4U]{'L', 'G', 'S', 'A'};
+
+/** Version of the suffix array file format. */
+constexpr std::uint32_t kVersion{1U};
+
+/** Maximum text size per shard in bytes, offsets are stored as 32-bit integers. */
+constexpr std::size_t kMaxShardSize{1U << 30U};
+
+/** Minimum text size per shard in bytes, smaller corpora aren't worth splitting. */
+constexpr std::size_t kMinShardSize{1U << 16U};
+
+/** Alphabet size of the text, each byte is shifted by one to make room for the sentinel. */
+constexpr std::int32_t kAlphabetSize{257};
+
+// ---------------------------------------------------------------------------
+constexpr char toLower(const char c) noexcept
+{
+    return (('A' <= c) && ('Z' >= c)) ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t phraseSize(const Phrase &phrase) noexcept
+{
+    // Both texts are terminated by a newline.
+    return phrase.primary.size() + phrase.target.size() + 2U;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t shardSizeFor(const std::size_t totalSize, const std::size_t threadCount)
+{
+    // Split the phrases into shards of roughly equal text size, one shard per thread.
+    const auto threads{std::max<std::size_t>(
+        0U != threadCount ? threadCount : std::thread::hardware_concurrency(), 1U)};
+    return std::min(std::max(totalSize / threads + 1U, kMinShardSize), kMaxShardSize);
+}
+
+// ---------------------------------------------------------------------------
+void bucketBounds(const std::int32_t *s, const std::int32_t n, const std::int32_t k,
+                  std::vector<std::int32_t> &buckets, const bool end)
+{
+    std::fill(buckets.begin(), buckets.end(), 0);
+    for (std::int32_t i{}; i < n; ++i) { ++buckets[s[i]]; }
+    std::int32_t sum{};
+
+    for (std::int32_t i{}; i < k; ++i)
+    {
+        sum += buckets[i];
+        buckets[i] = end ? sum : sum - buckets[i];
+    }
+}
+
+// ---------------------------------------------------------------------------
+void induceL(const std::vector<bool> &types, std::int32_t *sa, const std::int32_t *s, 
+             const std::int32_t n, const std::int32_t k, std::vector<std::int32_t> &buckets)
+{
+    bucketBounds(s, n, k, buckets, false);
+
+    for (std::int32_t i{}; i < n; ++i)
+    {
+        const auto j{sa[i] - 1};
+        if ((0 <= j) && !types[j]) { sa[buckets[s[j]]++] = j; }
+    }
+}
+
+// ---------------------------------------------------------------------------
+void induceS(const std::vector<bool> &types, std::int32_t *sa, const std::int32_t *s, 
+             const std::int32_t n, const std::int32_t k, std::vector<std::int32_t> &buckets)
+{
+    bucketBounds(s, n, k, buckets, true);
+
+    for (std::int32_t i{n - 1}; 0 <= i; --i)
+    {
+        const auto j{sa[i] - 1};
+        if ((0 <= j) && types[j]) { sa[--buckets[s[j]]] = j; }
+    }
+}
+
+// ---------------------------------------------------------------------------
+void sais(const std::int32_t *s, std::int32_t *sa, const std::int32_t n, const std::int32_t k)
+{
+    // Classify suffixes as S-type (true) or L-type (false), the sentinel s[n - 1] is S-type.
+    std::vector<bool> types(static_cast<std::size_t>(n));
+    types[n - 1] = true;
+
+    for (std::int32_t i{n - 2}; 0 <= i; --i)
+    {
+        types[i] = (s[i] < s[i + 1]) || ((s[i] == s[i + 1]) && types[i + 1]);
+    }
+    auto isLms = [&types](const std::int32_t i) { return (0 < i) && types[i] && !types[i - 1]; };
+    std::vector<std::int32_t> buckets(static_cast<std::size_t>(k));
+
+    // Sort the LMS substrings by placing LMS suffixes at bucket ends and inducing the rest.
+    bucketBounds(s, n, k, buckets, true);
+    std::fill(sa, sa + n, -1);
+    for (std::int32_t i{1}; i < n; ++i) 
+    { 
+        if (isLms(i)) { sa[--buckets[s[i]]] = i; } 
+    }
+    induceL(types, sa, s, n, k, buckets);
+    induceS(types, sa, s, n, k, buckets);
+
+    // Compact the sorted LMS substrings into the first part of the suffix array.
+    std::int32_t lmsCount{};
+    for (std::int32_t i{}; i < n; ++i) 
+    { 
+        if (isLms(sa[i])) { sa[lmsCount++] = sa[i]; } 
+    }
+    std::fill(sa + lmsCount, sa + n, -1);
+
+    // Name the LMS substrings, equal substrings get the same name.
+    std::int32_t name{}, previous{-1};
+
+    for (std::int32_t i{}; i < lmsCount; ++i)
+    {
+        const auto position{sa[i]};
+        bool different{false};
+
+        for (std::int32_t d{}; ; ++d)
+        {
+            if ((-1 == previous) || (s[position + d] != s[previous + d]) || 
+                (types[position + d] != types[previous + d]))
+            {
+                different = true;
+                break;
+            }
+            else if ((0 < d) && (isLms(position + d) || isLms(previous + d))) { break; }
+        }
+        if (different)
+        {
+            ++name;
+            previous = position;
+        }
+        sa[lmsCount + position / 2] = name - 1;
+    }
+    for (std::int32_t i{n - 1}, j{n - 1}; lmsCount <= i; --i) 
+    { 
+        if (0 <= sa[i]) { sa[j--] = sa[i]; } 
+    }
+
+    // Sort the reduced string recursively, unless all names are unique.
+    auto *s1{sa + n - lmsCount};
+    auto *sa1{sa};
+    if (name < lmsCount) { sais(s1, sa1, lmsCount, name); }
+    else 
+    { 
+        for (std::int32_t i{}; i < lmsCount; ++i) { sa1[s1[i]] = i; } 
+    }
+
+    // Place the sorted LMS suffixes at bucket ends and induce the final order.
+    bucketBounds(s, n, k, buckets, true);
+    for (std::int32_t i{1}, j{}; i < n; ++i) 
+    { 
+        if (isLms(i)) { s1[j++] = i; } 
+    }
+    for (std::int32_t i{}; i < lmsCount; ++i) { sa1[i] = s1[sa1[i]]; }
+    std::fill(sa + lmsCount, sa + n, -1);
+
+    for (std::int32_t i{lmsCount - 1}; 0 <= i; --i)
+    {
+        const auto j{sa[i]};
+        sa[i] = -1;
+        sa[--buckets[s[j]]] = j;
+    }
+    induceL(types, sa, s, n, k, buckets);
+    induceS(types, sa, s, n, k, buckets);
+}
+
+// ---------------------------------------------------------------------------
+template <typename T>
+void writeValue(std::ofstream &ofstream, const T &value)
+{
+    ofstream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+// ---------------------------------------------------------------------------
+template <typename T>
+void writeVector(std::ofstream &ofstream, const std::vector<T> &values)
+{
+    writeValue(ofstream, static_cast<std::uint64_t>(values.size()));
+    ofstream.write(reinterpret_cast<const char *>(values.data()), 
+                   static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+// ---------------------------------------------------------------------------
+template <typename T>
+bool readValue(std::ifstream &ifstream, T &value)
+{
+    return static_cast<bool>(ifstream.read(reinterpret_cast<char *>(&value), sizeof(value)));
+}
+
+// ---------------------------------------------------------------------------
+template <typename T>
+bool readVector(std::ifstream &ifstream, std::vector<T> &values)
+{
+    std::uint64_t size{};
+    if (!readValue(ifstream, size) || (kMaxShardSize < size)) { return false; }
+    values.resize(static_cast<std::size_t>(size));
+    return static_cast<bool>(ifstream.read(reinterpret_cast<char *>(values.data()), 
+                                           static_cast<std::streamsize>(size * sizeof(T))));
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+SuffixArray::SuffixArray() noexcept
+    : myShards{}
+    , myPhraseCount{}
+    , myFingerprint{utils::Fingerprint{}.value()}
+{}
+
+// ---------------------------------------------------------------------------
+SuffixArray::SuffixArray(const dictionary::Dictionary &dictionary)
+    : SuffixArray{}
+{
+    build(dictionary);
+}
+
+// ---------------------------------------------------------------------------
+void SuffixArray::build(const std::list<Phrase> &phrases, const std::size_t threadCount)
+{
+    std::size_t totalSize{};
+    for (const auto &phrase : phrases) { totalSize += phraseSize(phrase); }
+    const auto shardSize{shardSizeFor(totalSize, threadCount)};
+
+    myShards.clear();
+    utils::Fingerprint fingerprint{};
+    PhraseId id{};
+
+    for (const auto &phrase : phrases)
+    {
+        fingerprint.add(phrase);
+        addPhrase(phrase, id++, shardSize);
+    }
+    buildShards();
+    myPhraseCount = phrases.size();
+    myFingerprint = fingerprint.value();
+}
+
+// ---------------------------------------------------------------------------
+void SuffixArray::build(const dictionary::Dictionary &dictionary, const std::size_t threadCount)
+{
+    // Read the phrases twice, to size the shards and then to fill them.
+    std::size_t totalSize{};
+    dictionary.forEachPhrase([&totalSize](const Phrase &phrase) { totalSize += phraseSize(phrase); });
+    const auto shardSize{shardSizeFor(totalSize, threadCount)};
+
+    myShards.clear();
+    utils::Fingerprint fingerprint{};
+    PhraseId id{};
+
+    dictionary.forEachPhrase([&](const Phrase &phrase)
+    {
+        fingerprint.add(phrase);
+        addPhrase(phrase, id++, shardSize);
+    });
+    buildShards();
+    myPhraseCount = id;
+    myFingerprint = fingerprint.value();
+}
+
+// ---------------------------------------------------------------------------
+std::vector<PhraseId> SuffixArray::find(const std::string_view substring) const
+{
+    std::vector<PhraseId> ids{};
+    if (substring.empty()) { return ids; }
+
+    std::string query{};
+    std::transform(substring.begin(), substring.end(), std::back_inserter(query), toLower);
+    for (const auto &shard : myShards) { findInShard(shard, query, ids); }
+
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t SuffixArray::phraseCount() const noexcept { return myPhraseCount; }
+
+// ---------------------------------------------------------------------------
+std::size_t SuffixArray::shardCount() const noexcept { return myShards.size(); }
+
+// ---------------------------------------------------------------------------
+bool SuffixArray::save(const std::string &filePath) const
+{
+    std::ofstream ofstream{filePath, std::ios::binary};
+    if (!ofstream) { return false; }
+
+    ofstream.write(kMagic, sizeof(kMagic));
+    writeValue(ofstream, kVersion);
+    writeValue(ofstream, myFingerprint);
+    writeValue(ofstream, static_cast<std::uint64_t>(myPhraseCount));
+    writeValue(ofstream, static_cast<std::uint64_t>(myShards.size()));
+
+    for (const auto &shard : myShards)
+    {
+        writeValue(ofstream, shard.firstId);
+        writeValue(ofstream, static_cast<std::uint64_t>(shard.text.size()));
+        ofstream.write(shard.text.data(), static_cast<std::streamsize>(shard.text.size()));
+        writeVector(ofstream, shard.phraseOffsets);
+        writeVector(ofstream, shard.suffixes);
+    }
+    return static_cast<bool>(ofstream);
+}
+
+// ---------------------------------------------------------------------------
+bool SuffixArray::load(const std::string &filePath, const std::uint64_t expectedFingerprint)
+{
+    std::ifstream ifstream{filePath, std::ios::binary};
+    char magic[sizeof(kMagic)]{};
+    std::uint32_t version{};
+    std::uint64_t fingerprint{}, phraseCount{}, shardCount{};
+
+    if (!ifstream.read(magic, sizeof(magic)) || (0 != std::memcmp(magic, kMagic, sizeof(kMagic))) ||
+        !readValue(ifstream, version) || (kVersion != version) || 
+        !readValue(ifstream, fingerprint) || (expectedFingerprint != fingerprint) ||
+        !readValue(ifstream, phraseCount) || !readValue(ifstream, shardCount))
+    {
+        return false;
+    }
+    std::vector<Shard> shards{};
+
+    for (std::uint64_t i{}; i < shardCount; ++i)
+    {
+        Shard shard{};
+        std::uint64_t textSize{};
+        if (!readValue(ifstream, shard.firstId) || !readValue(ifstream, textSize) || 
+            (kMaxShardSize < textSize)) 
+        { 
+            return false; 
+        }
+        shard.text.resize(static_cast<std::size_t>(textSize));
+
+        if (!ifstream.read(&shard.text[0U], static_cast<std::streamsize>(textSize)) ||
+            !readVector(ifstream, shard.phraseOffsets) || !readVector(ifstream, shard.suffixes) ||
+            (shard.text.size() != shard.suffixes.size()))
+        {
+            return false;
+        }
+        shards.push_back(std::move(shard));
+    }
+    myShards      = std::move(shards);
+    myPhraseCount = static_cast<std::size_t>(phraseCount);
+    myFingerprint = fingerprint;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+void SuffixArray::addPhrase(const Phrase &phrase, const PhraseId id, const std::size_t shardSize)
+{
+    // Start a new shard once the current one has reached its size.
+    const auto size{phraseSize(phrase)};
+    if (myShards.empty() || (shardSize <= myShards.back().text.size()) || 
+        (kMaxShardSize < myShards.back().text.size() + size))
+    {
+        myShards.push_back(Shard{id, {}, {}, {}});
+    }
+    auto &shard{myShards.back()};
+    shard.phraseOffsets.push_back(static_cast<std::uint32_t>(shard.text.size()));
+
+    for (const auto *text : {&phrase.primary, &phrase.target})
+    {
+        std::transform(text->begin(), text->end(), std::back_inserter(shard.text), toLower);
+        shard.text.push_back('\n');
+    }
+}
+
+// ---------------------------------------------------------------------------
+void SuffixArray::buildShards()
+{
+    // Build the suffix array of each shard on a separate thread.
+    std::vector<std::thread> workers{};
+    for (std::size_t i{1U}; i < myShards.size(); ++i) 
+    { 
+        workers.emplace_back(buildShard, std::ref(myShards[i])); 
+    }
+    if (!myShards.empty()) { buildShard(myShards.front()); }
+    for (auto &worker : workers) { worker.join(); }
+}
+
+// ---------------------------------------------------------------------------
+void SuffixArray::buildShard(Shard &shard)
+{
+    LANGUAGE_METRICS_TIME("suffix_array_shard", "Time spent building suffix array shards.");
+    // Shift each byte by one and terminate the text with the sentinel 0.
+    const auto n{static_cast<std::int32_t>(shard.text.size()) + 1};
+    std::vector<std::int32_t> s(static_cast<std::size_t>(n));
+    std::vector<std::int32_t> sa(static_cast<std::size_t>(n));
+
+    for (std::size_t i{}; i < shard.text.size(); ++i)
+    {
+        s[i] = static_cast<std::int32_t>(static_cast<unsigned char>(shard.text[i])) + 1;
+    }
+    s[n - 1] = 0;
+    sais(s.data(), sa.data(), n, kAlphabetSize);
+
+    // Drop the sentinel suffix, which is always sorted first.
+    shard.suffixes.assign(sa.begin() + 1, sa.end());
+}
+
+// ---------------------------------------------------------------------------
+void SuffixArray::findInShard(const Shard &shard, const std::string_view substring, 
+                              std::vector<PhraseId> &ids)
+{
+    const std::string_view text{shard.text};
+
+    // Compare the prefix of each suffix with the substring.
+    auto prefix = [&](const std::int32_t suffix) 
+    { 
+        return text.substr(static_cast<std::size_t>(suffix), substring.size()); 
+    };
+    const auto first{std::lower_bound(shard.suffixes.begin(), shard.suffixes.end(), substring,
+        [&](const std::int32_t suffix, const std::string_view value) { return prefix(suffix) < value; })};
+    const auto last{std::upper_bound(first, shard.suffixes.end(), substring,
+        [&](const std::string_view value, const std::int32_t suffix) { return value < prefix(suffix); })};
+
+    // Map each match to the phrase containing it.
+    for (auto match{first}; match != last; ++match)
+    {
+        const auto phrase{std::upper_bound(shard.phraseOffsets.begin(), shard.phraseOffsets.end(), 
+                                           static_cast<std::uint32_t>(*match))};
+        ids.push_back(shard.firstId + static_cast<PhraseId>(phrase - shard.phraseOffsets.begin() - 1));
+    }
+}
+} // namespace search
+} // namespace language
@@ -0,0 +1,52 @@
+/**
+ * @brief Implementation details of the search tokenizer.
+ */
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "search/tokenizer.h"
+
+namespace language
+{
+namespace search
+{
+namespace
+{
+// ---------------------------------------------------------------------------
+constexpr bool isWordCharacter(const unsigned char c) noexcept
+{
+    return (('a' <= c) && ('z' >= c)) || (('A' <= c) && ('Z' >= c)) || 
+           (('0' <= c) && ('9' >= c)) || (0x80U <= c);
+}
+
+// ---------------------------------------------------------------------------
+constexpr char toLower(const unsigned char c) noexcept
+{
+    return static_cast<char>((('A' <= c) && ('Z' >= c)) ? c + ('a' - 'A') : c);
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+std::vector<std::string> tokenize(const std::string_view text)
+{
+    std::vector<std::string> tokens{};
+    std::string token{};
+
+    for (const auto c : text)
+    {
+        if (isWordCharacter(static_cast<unsigned char>(c))) 
+        { 
+            token.push_back(toLower(static_cast<unsigned char>(c))); 
+        }
+        else if (!token.empty())
+        {
+            tokens.push_back(token);
+            token.clear();
+        }
+    }
+    if (!token.empty()) { tokens.push_back(token); }
+    return tokens;
+}
+} // namespace search
+} // namespace language
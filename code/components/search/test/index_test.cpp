@@ -0,0 +1,151 @@
+/**
+ * @brief Unit test for class language::search::Index.
+ */
+#include <cstdio>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/adapter.h"
+#include "dictionary/dictionary.h"
+#include "search/index.h"
+#include "search/tokenizer.h"
+#include "utils/phrase.h"
+
+namespace 
+{
+using namespace language;
+
+/** Phrases used in the tests. */
+const std::list<Phrase> kPhrases{
+    {"Welcome to my C++ language game.", "Willkommen zu meinem C++ Sprachspiel."},
+    {"I hope it will be a great aid to you.", "Ich hoffe, es wird dir eine grosse Hilfe sein."},
+    {"Don't hesitate to ask me for help.", "Zögern Sie nicht, mich um Hilfe zu bitten."},
+    {"The frog tries to hop away.", "Der Frosch versucht weg zuhüpfen."},
+    {"The stork swallowed the frog.", "Der Storch hat den Frosch verschluckt."}};
+
+/**
+ * @brief Verify that phrases are split into lowercase words.
+ */
+TEST(SearchIndexTest, TokenizerTest) 
+{
+    const std::vector<std::string> expected{"zögern", "sie", "nicht", "mich", "um", "hilfe"};
+    EXPECT_EQ(search::tokenize("Zögern Sie nicht, mich um Hilfe!"), expected);
+    EXPECT_TRUE(search::tokenize(" ,.!? ").empty());
+}
+
+/**
+ * @brief Verify that single and multi-term queries return the matching phrases in either language.
+ */
+TEST(SearchIndexTest, QueryTest) 
+{
+    search::Index index{};
+    index.build(kPhrases);
+    EXPECT_EQ(index.phraseCount(), kPhrases.size());
+
+    // Expect matches in both the primary and the target language, case insensitive.
+    EXPECT_EQ(index.find("frog"), (std::vector<search::PhraseId>{3U, 4U}));
+    EXPECT_EQ(index.find("FROSCH"), (std::vector<search::PhraseId>{3U, 4U}));
+    EXPECT_EQ(index.find("hilfe"), (std::vector<search::PhraseId>{1U, 2U}));
+
+    // Expect multi-term queries to only return phrases containing all terms.
+    EXPECT_EQ(index.find("the frog stork"), (std::vector<search::PhraseId>{4U}));
+    EXPECT_EQ(index.find("to"), (std::vector<search::PhraseId>{0U, 1U, 2U, 3U}));
+    EXPECT_EQ(index.find("to you"), (std::vector<search::PhraseId>{1U}));
+
+    // Expect no matches for missing terms or empty queries.
+    EXPECT_TRUE(index.find("frog elephant").empty());
+    EXPECT_TRUE(index.find("").empty());
+}
+
+/**
+ * @brief Verify galloping intersection over long posting lists.
+ */
+TEST(SearchIndexTest, LongPostingListTest) 
+{
+    std::list<Phrase> phrases{};
+
+    // Every phrase contains "all", every third phrase "three" and every fifth phrase "five".
+    for (std::size_t i{}; i < 3000U; ++i)
+    {
+        std::string primary{"all"};
+        if (0U == i % 3U) { primary += " three"; }
+        if (0U == i % 5U) { primary += " five"; }
+        phrases.push_back(Phrase{primary, std::to_string(i)});
+    }
+    search::Index index{};
+    index.build(phrases);
+
+    const auto matches{index.find("five three all")};
+    ASSERT_EQ(matches.size(), 200U);
+    for (std::size_t i{}; i < matches.size(); ++i) { EXPECT_EQ(matches[i], i * 15U); }
+}
+
+/**
+ * @brief Verify that an index built from a dictionary, reading the phrases in blocks, equals the
+ *        index built from the list of its phrases.
+ */
+TEST(SearchIndexTest, DictionaryTest) 
+{
+    std::list<Phrase> phrases{};
+    for (std::size_t i{}; i < 3U * dictionary::Dictionary::kPhraseBlockSize + 5U; ++i)
+    {
+        phrases.push_back(Phrase{"all " + std::to_string(i % 7U), "alle " + std::to_string(i)});
+    }
+    dictionary::Adapter adapter{phrases};
+    const dictionary::Dictionary dictionary{adapter};
+
+    search::Index index{};
+    index.build(phrases);
+    const search::Index dictionaryIndex{dictionary};
+    EXPECT_EQ(dictionaryIndex.phraseCount(), phrases.size());
+    EXPECT_EQ(dictionaryIndex.termCount(), index.termCount());
+    EXPECT_EQ(dictionaryIndex.fingerprint(), index.fingerprint());
+    EXPECT_EQ(search::Index::fingerprint(dictionary), search::Index::fingerprint(phrases));
+    for (const auto *query : {"all 3", "alle 3071", "alle"})
+    {
+        EXPECT_EQ(dictionaryIndex.find(query), index.find(query)) << query;
+    }
+}
+
+/**
+ * @brief Verify that the index can be saved and loaded, and that stale indexes are rejected.
+ */
+TEST(SearchIndexTest, SerializationTest) 
+{
+    constexpr const char *filePath{"phrases.idx"};
+    search::Index index{};
+    index.build(kPhrases);
+    ASSERT_TRUE(index.save(filePath));
+
+    // Expect the loaded index to give the same results.
+    search::Index loadedIndex{};
+    ASSERT_TRUE(loadedIndex.load(filePath, search::Index::fingerprint(kPhrases)));
+    EXPECT_EQ(loadedIndex.termCount(), index.termCount());
+    EXPECT_EQ(loadedIndex.phraseCount(), index.phraseCount());
+    EXPECT_EQ(loadedIndex.find("der frosch"), index.find("der frosch"));
+
+    // Expect the index to be rejected if the phrases have changed.
+    auto changedPhrases{kPhrases};
+    changedPhrases.pop_back();
+    search::Index staleIndex{};
+    EXPECT_FALSE(staleIndex.load(filePath, search::Index::fingerprint(changedPhrases)));
+    std::remove(filePath);
+}
+} // namespace
+
+/**
+ * @brief Run tests.
+ * 
+ * @param[in] argc The number of input arguments entered from the terminal at runtime.
+ * @param[in] argv Vector storing all input arguments entered from the terminal at runtime.
+ * 
+ * @return Success code 0 if all tests succeeded, otherwise a non-zero value.
+ */
+int main(int argc, char **argv) 
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,146 @@
+/**
+ * @brief Unit test for class language::search::SuffixArray.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dictionary/adapter.h"
+#include "dictionary/dictionary.h"
+#include "search/index.h"
+#include "search/suffix_array.h"
+#include "utils/phrase.h"
+
+namespace 
+{
+using namespace language;
+
+// -----------------------------------------------------------------------------
+std::string toLower(std::string str)
+{
+    std::transform(str.begin(), str.end(), str.begin(), 
+        [](const char c) { return ('A' <= c && 'Z' >= c) ? static_cast<char>(c + 32) : c; });
+    return str;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<search::PhraseId> findByScan(const std::list<Phrase> &phrases, const std::string &substring)
+{
+    std::vector<search::PhraseId> ids{};
+    search::PhraseId id{};
+
+    for (const auto &phrase : phrases)
+    {
+        if ((std::string::npos != toLower(phrase.primary).find(toLower(substring))) || 
+            (std::string::npos != toLower(phrase.target).find(toLower(substring))))
+        {
+            ids.push_back(id);
+        }
+        ++id;
+    }
+    return ids;
+}
+
+/** Phrases used in the tests. */
+const std::list<Phrase> kPhrases{
+    {"The community meets on Sundays.", "Die Gemeinschaft trifft sich sonntags."},
+    {"Science is fun.", "Wissenschaft macht Spass."},
+    {"Friendship lasts forever.", "Freundschaft hält ewig."},
+    {"The frog tries to hop away.", "Der Frosch versucht weg zuhüpfen."},
+    {"banana", "Ananas"}};
+
+/**
+ * @brief Verify that substring queries return the phrases containing the substring.
+ */
+TEST(SuffixArrayTest, QueryTest) 
+{
+    search::SuffixArray suffixArray{};
+    suffixArray.build(kPhrases);
+    EXPECT_EQ(suffixArray.phraseCount(), kPhrases.size());
+
+    EXPECT_EQ(suffixArray.find("schaft"), (std::vector<search::PhraseId>{0U, 1U, 2U}));
+    EXPECT_EQ(suffixArray.find("SCHAFT"), (std::vector<search::PhraseId>{0U, 1U, 2U}));
+    EXPECT_EQ(suffixArray.find("ana"), (std::vector<search::PhraseId>{4U}));
+    EXPECT_EQ(suffixArray.find("hüpf"), (std::vector<search::PhraseId>{3U}));
+    EXPECT_EQ(suffixArray.find("s."), (std::vector<search::PhraseId>{0U, 1U}));
+
+    // Expect no matches across phrase boundaries or for missing and empty substrings.
+    EXPECT_TRUE(suffixArray.find("sonntags.the").empty());
+    EXPECT_TRUE(suffixArray.find("elephant").empty());
+    EXPECT_TRUE(suffixArray.find("").empty());
+}
+
+/**
+ * @brief Verify the suffix array against a linear scan for a larger corpus split into shards.
+ */
+TEST(SuffixArrayTest, ShardTest) 
+{
+    std::list<Phrase> phrases{};
+
+    // Generate repetitive phrases to exercise the recursion of the SA-IS algorithm.
+    for (std::size_t i{}; i < 20000U; ++i)
+    {
+        phrases.push_back(Phrase{"abab" + std::to_string(i % 97U) + "baba", 
+                                 "Nummer " + std::to_string(i) + " schaft"});
+    }
+    search::SuffixArray suffixArray{};
+    suffixArray.build(phrases, 4U);
+    EXPECT_EQ(suffixArray.shardCount(), 4U);
+
+    for (const auto *substring : {"abab1", "9baba", "ber 1999", "schaft", "r 12345 s", "bab9"})
+    {
+        EXPECT_EQ(suffixArray.find(substring), findByScan(phrases, substring)) << substring;
+    }
+}
+
+/**
+ * @brief Verify the suffix array built from a dictionary, reading the phrases in blocks, against
+ *        a linear scan.
+ */
+TEST(SuffixArrayTest, DictionaryTest) 
+{
+    std::list<Phrase> phrases{};
+    for (std::size_t i{}; i < 3U * dictionary::Dictionary::kPhraseBlockSize + 5U; ++i)
+    {
+        phrases.push_back(Phrase{"Satz " + std::to_string(i), "Phrase " + std::to_string(i % 13U)});
+    }
+    dictionary::Adapter adapter{phrases};
+    const dictionary::Dictionary dictionary{adapter};
+
+    search::SuffixArray suffixArray{};
+    suffixArray.build(dictionary, 3U);
+    EXPECT_EQ(suffixArray.phraseCount(), phrases.size());
+    for (const auto *substring : {"satz 1", "3071", "phrase 12", "e 9"})
+    {
+        EXPECT_EQ(suffixArray.find(substring), findByScan(phrases, substring)) << substring;
+    }
+
+    // Expect the suffix array to match the fingerprint of the phrases when saved and loaded.
+    constexpr const char *filePath{"dictionary_phrases.sa"};
+    ASSERT_TRUE(suffixArray.save(filePath));
+    search::SuffixArray loadedSuffixArray{};
+    EXPECT_TRUE(loadedSuffixArray.load(filePath, search::Index::fingerprint(phrases)));
+    std::remove(filePath);
+}
+
+/**
+ * @brief Verify that the suffix array can be saved and loaded.
+ */
+TEST(SuffixArrayTest, SerializationTest) 
+{
+    constexpr const char *filePath{"phrases.sa"};
+    search::SuffixArray suffixArray{};
+    suffixArray.build(kPhrases);
+    ASSERT_TRUE(suffixArray.save(filePath));
+
+    search::SuffixArray loadedSuffixArray{};
+    ASSERT_TRUE(loadedSuffixArray.load(filePath, search::Index::fingerprint(kPhrases)));
+    EXPECT_EQ(loadedSuffixArray.find("schaft"), suffixArray.find("schaft"));
+    EXPECT_FALSE(loadedSuffixArray.load(filePath, search::Index::fingerprint(std::list<Phrase>{})));
+    std::remove(filePath);
+}
+} // namespace
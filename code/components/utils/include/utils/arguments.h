@@ -0,0 +1,84 @@
+/**
+ * @brief Command-line argument parsing for language game.
+ */
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Command-line arguments split into positional arguments and options.
+ *
+ *        Options are entered as "--name" or "--name=value" and may be placed anywhere on the
+ *        command line. All other arguments are positional and keep their relative order,
+ *        with the program name stored first, just like in argv.
+ */
+class Arguments final
+{
+public:
+    /**
+     * @brief Parse command-line arguments.
+     *
+     * @param[in] argc The number of input arguments entered from the terminal at runtime.
+     * @param[in] argv Vector storing all input arguments entered from the terminal at runtime.
+     */
+    Arguments(int argc, const char** argv);
+
+    /**
+     * @brief Get the positional arguments, starting with the program name.
+     *
+     * @return Reference to vector holding the positional arguments.
+     */
+    const std::vector<std::string>& positional() const noexcept;
+
+    /**
+     * @brief Get the number of positional arguments, including the program name.
+     *
+     * @return The number of positional arguments.
+     */
+    std::size_t positionalCount() const noexcept;
+
+    /**
+     * @brief Check if an option has been entered.
+     *
+     * @param[in] name The option name without leading dashes.
+     *
+     * @return True if the option has been entered, else false.
+     */
+    bool hasOption(const std::string& name) const;
+
+    /**
+     * @brief Get the value of an option.
+     *
+     * @param[in] name The option name without leading dashes.
+     * @param[in] defaultValue Value to return if the option has not been entered.
+     *
+     * @return The value of the option, or the default value if the option has not been entered.
+     */
+    std::string option(const std::string& name, const std::string& defaultValue = "") const;
+
+    /**
+     * @brief Get the value of an option as an unsigned number.
+     *
+     * @param[in] name The option name without leading dashes.
+     * @param[in] defaultValue Value to return if the option has not been entered or is invalid.
+     *
+     * @return The value of the option, or the default value.
+     */
+    std::size_t numericOption(const std::string& name, std::size_t defaultValue = 0U) const;
+
+private:
+    /** Positional arguments, starting with the program name. */
+    std::vector<std::string> myPositional;
+
+    /** Options stored as name-value pairs. */
+    std::map<std::string, std::string> myOptions;
+};
+} // namespace utils
+} // namespace language
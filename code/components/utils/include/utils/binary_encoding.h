@@ -0,0 +1,131 @@
+/**
+ * @brief Encoding of integers and strings in binary files and messages.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace language
+{
+namespace utils
+{
+// ---------------------------------------------------------------------------
+inline std::uint64_t checksum(const char *first, const char *const last) noexcept
+{
+    // FNV-1a hash over the encoded data.
+    std::uint64_t hash{0xcbf29ce484222325ULL};
+    for (; first < last; ++first) { hash = (hash ^ static_cast<unsigned char>(*first)) * 0x100000001b3ULL; }
+    return hash;
+}
+
+// ---------------------------------------------------------------------------
+inline void encodeFixed(std::uint64_t value, std::string &buffer)
+{
+    for (std::size_t i{}; i < sizeof(value); ++i, value >>= 8U) { buffer.push_back(static_cast<char>(value & 0xFFU)); }
+}
+
+// ---------------------------------------------------------------------------
+inline void encodeVarint(std::uint64_t value, std::string &buffer)
+{
+    // Seven bits per byte, the highest bit marks that more bytes follow.
+    for (; 0x80U <= value; value >>= 7U) { buffer.push_back(static_cast<char>((value & 0x7FU) | 0x80U)); }
+    buffer.push_back(static_cast<char>(value));
+}
+
+// ---------------------------------------------------------------------------
+inline void encodeText(const std::string &text, std::string &buffer)
+{
+    encodeVarint(text.size(), buffer);
+    buffer.append(text);
+}
+
+// ---------------------------------------------------------------------------
+inline void encodeIndexes(const std::vector<std::size_t> &indexes, std::string &buffer)
+{
+    encodeVarint(indexes.size(), buffer);
+    for (const auto index : indexes) { encodeVarint(index, buffer); }
+}
+
+/**
+ * @brief Decoder of encoded data, which fails on truncated data instead of reading past it.
+ */
+class Decoder
+{
+public:
+    /** @brief Create decoder of the given data. */
+    Decoder(const char *first, const char *last) noexcept : myFirst{first}, myLast{last} {}
+
+    /** @brief Decode fixed-size integer. */
+    bool fixed(std::uint64_t &value) noexcept
+    {
+        if (static_cast<std::size_t>(myLast - myFirst) < sizeof(value)) { return false; }
+        value = 0U;
+        for (std::size_t i{}; i < sizeof(value); ++i, ++myFirst)
+        {
+            value |= static_cast<std::uint64_t>(static_cast<unsigned char>(*myFirst)) << (8U * i);
+        }
+        return true;
+    }
+
+    /** @brief Decode single byte. */
+    bool byte(unsigned char &value) noexcept
+    {
+        if (myLast == myFirst) { return false; }
+        value = static_cast<unsigned char>(*myFirst++);
+        return true;
+    }
+
+    /** @brief Decode variable-length integer. */
+    bool varint(std::uint64_t &value) noexcept
+    {
+        value = 0U;
+        for (unsigned shift{}; (myLast != myFirst) && (64U > shift); shift += 7U)
+        {
+            const auto byte{static_cast<unsigned char>(*myFirst++)};
+            value |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+            if (0U == (byte & 0x80U)) { return true; }
+        }
+        return false;
+    }
+
+    /** @brief Decode text. */
+    bool text(std::string &text)
+    {
+        std::uint64_t size{};
+        if (!varint(size) || (static_cast<std::uint64_t>(myLast - myFirst) < size)) { return false; }
+        text.assign(myFirst, static_cast<std::size_t>(size));
+        myFirst += size;
+        return true;
+    }
+
+    /** @brief Decode vector of indexes. */
+    bool indexes(std::vector<std::size_t> &indexes)
+    {
+        // Each index takes at least one byte, which bounds the count of intact data.
+        std::uint64_t count{};
+        if (!varint(count) || (static_cast<std::uint64_t>(myLast - myFirst) < count)) { return false; }
+        indexes.resize(static_cast<std::size_t>(count));
+        for (auto &index : indexes)
+        {
+            std::uint64_t value{};
+            if (!varint(value)) { return false; }
+            index = static_cast<std::size_t>(value);
+        }
+        return true;
+    }
+
+    /** @brief Check if all data has been decoded. */
+    bool done() const noexcept { return myLast == myFirst; }
+
+private:
+    /** Next byte to decode. */
+    const char *myFirst;
+
+    /** End of the data. */
+    const char *myLast;
+};
+} // namespace utils
+} // namespace language
@@ -0,0 +1,70 @@
+/**
+ * @brief Bloom filter for approximate membership tests.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Bloom filter with a fixed memory footprint.
+ *
+ *        Membership tests never give false negatives, but may give false positives at a rate
+ *        depending on the filter size and the number of inserted elements. Elements are passed
+ *        as 64-bit hashes, from which the bit positions are derived by double hashing.
+ */
+class BloomFilter final
+{
+public:
+    /**
+     * @brief Create Bloom filter.
+     *
+     * @param[in] sizeInBytes The memory footprint of the filter in bytes.
+     * @param[in] hashCount The number of bit positions per element (default = 7).
+     */
+    explicit BloomFilter(std::size_t sizeInBytes, std::size_t hashCount = 7U);
+
+    /**
+     * @brief Insert an element in the filter.
+     *
+     * @param[in] hash Hash of the element to insert.
+     *
+     * @return True if the element was possibly present before the insertion, else false.
+     */
+    bool insert(std::uint64_t hash) noexcept;
+
+    /**
+     * @brief Check if an element is possibly present in the filter.
+     *
+     * @param[in] hash Hash of the element to check.
+     *
+     * @return True if the element is possibly present, false if it's definitely not present.
+     */
+    bool contains(std::uint64_t hash) const noexcept;
+
+    /**
+     * @brief Get the memory footprint of the filter.
+     *
+     * @return The memory footprint in bytes.
+     */
+    std::size_t sizeInBytes() const noexcept;
+
+private:
+    std::uint64_t position(std::uint64_t hash, std::size_t i) const noexcept;
+
+    /** Bits of the filter. */
+    std::vector<std::uint64_t> myBits;
+
+    /** The number of bits in the filter. */
+    std::uint64_t myBitCount;
+
+    /** The number of bit positions per element. */
+    std::size_t myHashCount;
+};
+} // namespace utils
+} // namespace language
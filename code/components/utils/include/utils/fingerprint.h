@@ -0,0 +1,59 @@
+/**
+ * @brief Fingerprint of phrases, matching saved files to the phrases they were made from.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "utils/phrase.h"
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief FNV-1a hash over texts, each text followed by a separator byte.
+ *
+ *        Session checkpoints, session logs and saved search indexes store the fingerprint of
+ *        the phrases they were made from, and are only used with phrases of the same
+ *        fingerprint. They all share this hash, changing it invalidates all of these files.
+ */
+class Fingerprint final
+{
+public:
+    /** @brief Create fingerprint of no text. */
+    Fingerprint() noexcept : myHash{kBasis} {}
+
+    /** @brief Add a text, followed by the separator. */
+    void add(const std::string &text) noexcept
+    {
+        for (const auto c : text) { myHash = (myHash ^ static_cast<unsigned char>(c)) * kPrime; }
+        myHash = (myHash ^ kSeparator) * kPrime;
+    }
+
+    /** @brief Add the primary and the target text of a phrase. */
+    void add(const Phrase &phrase) noexcept
+    {
+        add(phrase.primary);
+        add(phrase.target);
+    }
+
+    /** @brief Get the fingerprint of the texts added so far. */
+    std::uint64_t value() const noexcept { return myHash; }
+
+private:
+    /** Offset basis of the hash. */
+    static constexpr std::uint64_t kBasis{0xcbf29ce484222325ULL};
+
+    /** Prime multiplied with the hash after each byte. */
+    static constexpr std::uint64_t kPrime{0x100000001b3ULL};
+
+    /** Byte added after each text, it never occurs in valid UTF-8. */
+    static constexpr std::uint64_t kSeparator{0xFFU};
+
+    /** The hash of the texts added so far. */
+    std::uint64_t myHash;
+};
+} // namespace utils
+} // namespace language
@@ -0,0 +1,82 @@
+/**
+ * @brief Terminal input read on a dedicated thread, for waiting on input with deadlines.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+#include "utils/spsc_queue.h"
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Reader of lines from standard input on a dedicated thread.
+ *
+ *        The thread passes the lines through a lock-free queue, and only notifies the waiting
+ *        thread through a condition variable, so a line is handed over as soon as it's entered.
+ *        Once created, all input must be read through the reader, which must only be used from
+ *        one thread. The reader thread is detached, since it may be blocked on input at exit.
+ */
+class InputReader final
+{
+public:
+    /** The maximum number of lines entered ahead, further lines wait until one is read. */
+    static constexpr std::size_t kCapacity{64U};
+
+    /**
+     * @brief Get the reader, its thread is started on first use.
+     *
+     * @return Reference to the reader.
+     */
+    static InputReader &instance();
+
+    /**
+     * @brief Wait for the next line until a deadline.
+     *
+     *        Once the input is closed, an empty line is returned immediately, like
+     *        utils::readLine does.
+     *
+     * @param[out] str The entered line.
+     * @param[in] deadline Time until which to wait, time_point::max() to wait without limit.
+     * @param[in] space Space to print after the input has been read (default = no space).
+     *
+     * @return True if a line was read, false if the deadline passed first.
+     */
+    bool readLine(std::string &str, std::chrono::steady_clock::time_point deadline, const char *space = "");
+
+    /**
+     * @brief Check if the input has been closed and all entered lines have been read.
+     *
+     * @return True if no more lines will be read, else false.
+     */
+    bool closed() const noexcept;
+
+    InputReader(const InputReader &)             = delete; // No copy constructor.
+    InputReader(InputReader &&)                  = delete; // No move constructor.
+    InputReader & operator=(const InputReader &) = delete; // No copy assignment.
+    InputReader & operator=(InputReader &&)      = delete; // No move assignment.
+
+private:
+    InputReader();
+    void run();
+
+    /** Entered lines, from the reader thread to the waiting thread. */
+    SpscQueue<std::string, kCapacity> myLines;
+
+    /** Mutex for waiting on the condition only, the lines are passed without locking. */
+    std::mutex myMutex;
+
+    /** Condition used to wake up the waiting thread when a line was entered. */
+    std::condition_variable myCondition;
+
+    /** Indicate whether the input has been closed. */
+    std::atomic<bool> myClosed;
+};
+} // namespace utils
+} // namespace language
@@ -0,0 +1,105 @@
+/**
+ * @brief High-dynamic-range histogram of latencies.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Histogram of latencies in microseconds with a fixed memory footprint.
+ *
+ *        Values below 256 are counted exactly, bigger values in log-linear buckets of 128 per
+ *        power of two, so each value is reported within 0.8 % of its recorded value. Recording
+ *        takes constant time and never allocates. Values beyond kMaxValue are clamped.
+ */
+class LatencyHistogram final
+{
+public:
+    /** The biggest value which can be recorded without clamping, about 12 days in microseconds. */
+    static constexpr std::uint64_t kMaxValue{(std::uint64_t{1U} << 40U) - 1U};
+
+    /**
+     * @brief Record a value.
+     *
+     * @param[in] value The value to record, in microseconds.
+     */
+    void record(std::uint64_t value) noexcept;
+
+    /**
+     * @brief Add all values of another histogram.
+     *
+     * @param[in] other The other histogram.
+     */
+    void add(const LatencyHistogram &other) noexcept;
+
+    /**
+     * @brief Get a percentile of the recorded values.
+     *
+     * @param[in] percentile The percentile between 0 and 100.
+     *
+     * @return The highest value equivalent to the percentile, 0 if no value was recorded.
+     */
+    std::uint64_t percentile(double percentile) const noexcept;
+
+    /**
+     * @brief Get the number of recorded values.
+     *
+     * @return The number of values.
+     */
+    std::uint64_t count() const noexcept { return myCount; }
+
+    /**
+     * @brief Get the biggest recorded value.
+     *
+     * @return The biggest value, 0 if no value was recorded.
+     */
+    std::uint64_t max() const noexcept { return myMax; }
+
+    /**
+     * @brief Remove all recorded values.
+     */
+    void clear() noexcept;
+
+private:
+    /** The number of bits counted exactly, also the number of bits kept of bigger values. */
+    static constexpr std::uint32_t kSubBucketBits{8U};
+
+    /** The number of values counted exactly. */
+    static constexpr std::size_t kSubBucketCount{std::size_t{1U} << kSubBucketBits};
+
+    /** The number of buckets per power of two above the exact values. */
+    static constexpr std::size_t kHalfSubBucketCount{kSubBucketCount / 2U};
+
+    /** The total number of buckets. */
+    static constexpr std::size_t kBucketCount{kSubBucketCount + (40U - kSubBucketBits) * kHalfSubBucketCount};
+
+    static std::size_t index(std::uint64_t value) noexcept;
+    static std::uint64_t highestEquivalentValue(std::size_t index) noexcept;
+
+    /** The number of values per bucket. */
+    std::array<std::uint64_t, kBucketCount> myCounts{};
+
+    /** The number of recorded values. */
+    std::uint64_t myCount{};
+
+    /** The biggest recorded value. */
+    std::uint64_t myMax{};
+};
+
+/**
+ * @brief Format a latency with a suitable unit, e.g. "850 us", "12.5 ms" or "3.20 s".
+ *
+ * @param[in] microseconds The latency in microseconds.
+ *
+ * @return The formatted latency.
+ */
+std::string formatLatency(std::uint64_t microseconds);
+} // namespace utils
+} // namespace language
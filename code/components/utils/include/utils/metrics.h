@@ -0,0 +1,212 @@
+/**
+ * @brief Lightweight timers and counters for the hot paths of language game.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "utils/trace.h"
+
+/** Metrics are compiled in unless disabled with CMake option LANGUAGE_METRICS. */
+#ifndef LANGUAGE_METRICS_ENABLED
+#define LANGUAGE_METRICS_ENABLED 1
+#endif
+
+#define LANGUAGE_METRICS_CONCAT_IMPL(x, y) x##y
+#define LANGUAGE_METRICS_CONCAT(x, y) LANGUAGE_METRICS_CONCAT_IMPL(x, y)
+
+#if LANGUAGE_METRICS_ENABLED
+/**
+ * @brief Measure the time until the end of the enclosing scope.
+ *
+ * @param name Name of the timer, a string literal of lowercase letters and underscores.
+ * @param help Description of the timer, a string literal.
+ */
+#define LANGUAGE_METRICS_TIME(name, help) \
+    static const ::language::utils::metrics::Metric LANGUAGE_METRICS_CONCAT(languageMetric, __LINE__){ \
+        name, ::language::utils::metrics::MetricType::Timer, help}; \
+    const ::language::utils::metrics::ScopedTimer LANGUAGE_METRICS_CONCAT(languageTimer, __LINE__){ \
+        LANGUAGE_METRICS_CONCAT(languageMetric, __LINE__)}
+
+/**
+ * @brief Add a value to a counter.
+ *
+ * @param name Name of the counter, a string literal of lowercase letters and underscores.
+ * @param help Description of the counter, a string literal.
+ * @param value The value to add.
+ */
+#define LANGUAGE_METRICS_COUNT(name, help, value) \
+    do \
+    { \
+        static const ::language::utils::metrics::Metric languageMetric{ \
+            name, ::language::utils::metrics::MetricType::Counter, help}; \
+        ::language::utils::metrics::add(languageMetric, static_cast<std::uint64_t>(value)); \
+    } while (false)
+#else
+#define LANGUAGE_METRICS_TIME(name, help) static_cast<void>(0)
+#define LANGUAGE_METRICS_COUNT(name, help, value) static_cast<void>(sizeof(value))
+#endif
+
+namespace language
+{
+namespace utils
+{
+namespace metrics
+{
+/** The maximum number of metrics. */
+constexpr std::size_t kMaxMetricCount{64U};
+
+/**
+ * @brief Enumeration of metric types.
+ */
+enum class MetricType
+{
+    /** Accumulated durations in nanoseconds, with the number of measurements. */
+    Timer,
+
+    /** Accumulated count. */
+    Counter,
+};
+
+/**
+ * @brief Metric registered once and recorded from any thread.
+ *
+ *        Metrics are meant to be static objects, which are created by the macros above.
+ */
+class Metric final
+{
+public:
+    /**
+     * @brief Register metric.
+     *
+     *        Metrics beyond kMaxMetricCount aren't recorded.
+     *
+     * @param[in] name Name of the metric, must stay valid until exit.
+     * @param[in] type The metric type.
+     * @param[in] help Description of the metric, must stay valid until exit.
+     */
+    Metric(const char *name, MetricType type, const char *help) noexcept;
+
+    /**
+     * @brief Get the index of the metric.
+     *
+     * @return The index, kMaxMetricCount if the metric isn't recorded.
+     */
+    std::size_t index() const noexcept { return myIndex; }
+
+    /**
+     * @brief Get the name of the metric.
+     *
+     * @return The name.
+     */
+    const char *name() const noexcept { return myName; }
+
+    Metric(const Metric &)             = delete; // No copy constructor.
+    Metric(Metric &&)                  = delete; // No move constructor.
+    Metric & operator=(const Metric &) = delete; // No copy assignment.
+    Metric & operator=(Metric &&)      = delete; // No move assignment.
+
+private:
+    /** Name of the metric. */
+    const char *myName;
+
+    /** The index of the metric. */
+    std::size_t myIndex;
+};
+
+/**
+ * @brief Add a value to a metric.
+ *
+ *        Values are accumulated per thread without locking and summed up when exported.
+ *
+ * @param[in] metric The metric.
+ * @param[in] value The value to add, in nanoseconds for timers.
+ */
+void add(const Metric &metric, std::uint64_t value) noexcept;
+
+/**
+ * @brief Timer adding the time from its creation to its deletion to a metric.
+ *
+ *        While tracing is enabled, the same time is also recorded as a span of the timeline.
+ */
+class ScopedTimer final
+{
+public:
+    /**
+     * @brief Start timer.
+     *
+     * @param[in] metric The timer metric.
+     */
+    explicit ScopedTimer(const Metric &metric) noexcept
+        : myMetric{metric}
+        , myStart{std::chrono::steady_clock::now()}
+    {}
+
+    /**
+     * @brief Stop timer and record the elapsed time.
+     */
+    ~ScopedTimer() noexcept
+    {
+        const auto end{std::chrono::steady_clock::now()};
+        add(myMetric, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - myStart).count()));
+        if (trace::enabled()) { trace::record(myMetric.name(), myStart, end); }
+    }
+
+    ScopedTimer(const ScopedTimer &)             = delete; // No copy constructor.
+    ScopedTimer(ScopedTimer &&)                  = delete; // No move constructor.
+    ScopedTimer & operator=(const ScopedTimer &) = delete; // No copy assignment.
+    ScopedTimer & operator=(ScopedTimer &&)      = delete; // No move assignment.
+
+private:
+    /** The timer metric. */
+    const Metric &myMetric;
+
+    /** Start time. */
+    std::chrono::steady_clock::time_point myStart;
+};
+
+/**
+ * @brief Get all metrics as JSON.
+ *
+ * @return JSON object with the timers and counters by name.
+ */
+std::string toJson();
+
+/**
+ * @brief Get all metrics in Prometheus text exposition format.
+ *
+ *        Timers are exported as summaries in seconds with a gauge of the longest measurement,
+ *        counters as counters. All names are prefixed with "language_".
+ *
+ * @return The metrics as text.
+ */
+std::string toPrometheus();
+
+/**
+ * @brief Write all metrics to '<basePath>.json' and '<basePath>.prom'.
+ *
+ *        Each file is written next to its destination and renamed, so readers never see a
+ *        partially written file.
+ *
+ * @param[in] basePath Path of the files without extension.
+ *
+ * @return True if both files were written, else false.
+ */
+bool dump(const std::string &basePath);
+
+/**
+ * @brief Dump all metrics at exit and whenever the process receives SIGUSR1.
+ *
+ *        Call this at the start of main, before other threads are created: SIGUSR1 is blocked
+ *        in the calling thread and inherited by new threads, and a dedicated thread waits for
+ *        the signal.
+ *
+ * @param[in] basePath Path of the files without extension, "metrics" if empty.
+ */
+void dumpAtExit(const std::string &basePath);
+} // namespace metrics
+} // namespace utils
+} // namespace language
@@ -0,0 +1,147 @@
+/**
+ * @brief Buffered terminal output for language game.
+ */
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Buffered output formatting text into one reusable buffer.
+ *
+ *        Formatted text is kept in the buffer until flushed, at which point the whole buffer
+ *        is handed to the output stream in a single write. The buffer is flushed automatically
+ *        when its capacity is reached, and when the output object is deleted.
+ */
+class Output final
+{
+public:
+    /** Default buffer capacity in bytes. */
+    static constexpr std::size_t kDefaultCapacity{64U * 1024U};
+
+    /**
+     * @brief Create buffered output.
+     *
+     * @param[in] ostream Reference to the output stream to write to (default = stdout).
+     * @param[in] capacity Buffer capacity in bytes (default = 64 kB).
+     */
+    explicit Output(std::ostream& ostream = std::cout, std::size_t capacity = kDefaultCapacity);
+
+    /**
+     * @brief Flush remaining content and delete buffered output.
+     */
+    ~Output() noexcept;
+
+    /**
+     * @brief Append text to the buffer.
+     *
+     * @param[in] str The text to append.
+     *
+     * @return Reference to this output.
+     */
+    Output& operator<<(std::string_view str);
+
+    /**
+     * @brief Append text to the buffer.
+     *
+     * @param[in] str The null-terminated text to append.
+     *
+     * @return Reference to this output.
+     */
+    Output& operator<<(const char* str);
+
+    /**
+     * @brief Append text to the buffer.
+     *
+     * @param[in] str The text to append.
+     *
+     * @return Reference to this output.
+     */
+    Output& operator<<(const std::string& str);
+
+    /**
+     * @brief Append a character to the buffer.
+     *
+     * @param[in] c The character to append.
+     *
+     * @return Reference to this output.
+     */
+    Output& operator<<(char c);
+
+    /**
+     * @brief Append an integer to the buffer.
+     *
+     * @tparam T The integral type of the number.
+     * @param[in] number The number to append.
+     *
+     * @return Reference to this output.
+     */
+    template <typename T, typename = std::enable_if_t<std::is_integral<T>::value>>
+    Output& operator<<(const T number)
+    {
+        char digits[24U]{};
+        const auto result{std::to_chars(digits, digits + sizeof(digits), number)};
+        return *this << std::string_view{digits, static_cast<std::size_t>(result.ptr - digits)};
+    }
+
+    /**
+     * @brief Append a floating-point number with fixed precision to the buffer.
+     *
+     * @param[in] number The number to append.
+     * @param[in] precision The number of decimals to append.
+     *
+     * @return Reference to this output.
+     */
+    Output& fixed(double number, int precision);
+
+    /**
+     * @brief Write the buffered content to the output stream in one write and clear the buffer.
+     */
+    void flush();
+
+    /**
+     * @brief Discard the buffered content without writing it.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Get the number of buffered bytes.
+     *
+     * @return The number of bytes currently in the buffer.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * @brief Check if the buffer is empty.
+     *
+     * @return True if the buffer is empty, else false.
+     */
+    bool empty() const noexcept;
+
+    Output(const Output&)            = delete; // No copy constructor.
+    Output(Output&&)                 = delete; // No move constructor.
+    Output& operator=(const Output&) = delete; // No copy assignment.
+    Output& operator=(Output&&)      = delete; // No move assignment.
+
+private:
+    void flushIfFull();
+
+    /** Reference to the output stream to write to. */
+    std::ostream& myOstream;
+
+    /** Buffer holding formatted text. */
+    std::string myBuffer;
+
+    /** Buffer capacity in bytes. */
+    std::size_t myCapacity;
+};
+} // namespace utils
+} // namespace language
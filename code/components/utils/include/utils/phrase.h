@@ -3,6 +3,8 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <string>
 
 namespace language
@@ -30,4 +32,24 @@ struct Phrase
         return (other.primary == primary) && (other.target == target);
     }
 };
+
+/**
+ * @brief Hash function for phrases, combining the hashes of both languages.
+ */
+struct PhraseHash
+{
+    /**
+     * @brief Calculate hash of a phrase.
+     * 
+     * @param[in] phrase The phrase to hash.
+     * 
+     * @return The hash of the phrase.
+     */
+    std::size_t operator()(const Phrase &phrase) const noexcept
+    {
+        const auto primaryHash{std::hash<std::string>{}(phrase.primary)};
+        const auto targetHash{std::hash<std::string>{}(phrase.target)};
+        return primaryHash ^ (targetHash + 0x9e3779b97f4a7c15ULL + (primaryHash << 6U) + (primaryHash >> 2U));
+    }
+};
 } // namespace language
\ No newline at end of file
@@ -0,0 +1,118 @@
+/**
+ * @brief Streaming phrase reader for language game.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "phrase.h"
+#include "utf8.h"
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Reader parsing phrase pairs from a file while reading it.
+ *
+ *        The file is read in chunks into a bounded buffer, so memory usage is independent of
+ *        the file size. Lines are parsed the same way as in loadPhrasesFromFile: trailing
+ *        whitespaces are removed, empty lines are skipped and consecutive lines form pairs.
+ *        A UTF-8 byte order mark is skipped, lines with invalid UTF-8 are handled according to
+ *        the UTF-8 policy. If the file is rejected, reading stops at the first invalid line.
+ */
+class PhraseReader final
+{
+public:
+    /** Default read buffer size in bytes. */
+    static constexpr std::size_t kDefaultBufferSize{64U * 1024U};
+
+    /**
+     * @brief Create phrase reader.
+     *
+     * @param[in] filePath Path to the file to read phrases from.
+     * @param[in] bufferSize Read buffer size in bytes (default = 64 kB).
+     * @param[in] utf8Policy How to handle lines containing invalid UTF-8 (default = report).
+     */
+    explicit PhraseReader(const std::string& filePath, std::size_t bufferSize = kDefaultBufferSize,
+                          Utf8Policy utf8Policy = Utf8Policy::Report);
+
+    /**
+     * @brief Close the file and delete the phrase reader.
+     */
+    ~PhraseReader() noexcept = default;
+
+    /**
+     * @brief Check if the file was opened.
+     *
+     * @return True if the file is open, else false.
+     */
+    bool isOpen() const noexcept;
+
+    /**
+     * @brief Read the next phrase pair from the file.
+     *
+     * @param[out] phrase Reference to phrase storing the read pair.
+     *
+     * @return True if a complete pair was read, false at the end of the file.
+     */
+    bool next(Phrase& phrase);
+
+    /**
+     * @brief Get the number of phrase pairs read so far.
+     *
+     * @return The number of read phrase pairs.
+     */
+    std::size_t phraseCount() const noexcept;
+
+    /**
+     * @brief Get the numbers of the lines with invalid UTF-8 read so far.
+     *
+     * @return Reference to vector holding the line numbers, starting at 1.
+     */
+    const std::vector<std::size_t>& invalidLines() const noexcept;
+
+    PhraseReader()                               = delete; // No default constructor.
+    PhraseReader(const PhraseReader&)            = delete; // No copy constructor.
+    PhraseReader(PhraseReader&&)                 = delete; // No move constructor.
+    PhraseReader& operator=(const PhraseReader&) = delete; // No copy assignment.
+    PhraseReader& operator=(PhraseReader&&)      = delete; // No move assignment.
+
+private:
+    bool nextLine(std::string& line);
+    bool completeLine(std::string& line);
+    bool fillBuffer();
+
+    /** The file to read from. */
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> myFile;
+
+    /** Read buffer. */
+    std::vector<char> myBuffer;
+
+    /** Position of the next unparsed byte in the read buffer. */
+    std::size_t myPosition;
+
+    /** The number of valid bytes in the read buffer. */
+    std::size_t mySize;
+
+    /** The number of phrase pairs read so far. */
+    std::size_t myPhraseCount;
+
+    /** How to handle lines containing invalid UTF-8. */
+    Utf8Policy myUtf8Policy;
+
+    /** The numbers of the lines with invalid UTF-8. */
+    std::vector<std::size_t> myInvalidLines;
+
+    /** The number of lines read so far. */
+    std::size_t myLineNumber;
+
+    /** Indicate whether the file was rejected due to invalid UTF-8. */
+    bool myRejected;
+};
+} // namespace utils
+} // namespace language
@@ -0,0 +1,167 @@
+/**
+ * @brief Streaming reader for tabular phrase files (TSV, CSV and JSON Lines).
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utf8.h"
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Enumeration of phrase file formats.
+ */
+enum class RecordFormat
+{
+    /** Phrases on consecutive lines, pairs separated by blank lines. */
+    Lines,
+
+    /** Tab-separated values, one record per line. */
+    Tsv,
+
+    /** Comma-separated values with optional double quotes, as described in RFC 4180. */
+    Csv,
+
+    /** One JSON array or object of values per line. */
+    JsonLines,
+};
+
+/**
+ * @brief Detect the format of a phrase file from its extension.
+ *
+ *        The extensions ".tsv", ".tab", ".csv", ".jsonl" and ".ndjson" are recognized,
+ *        regardless of case. All other files are assumed to be in the line format.
+ *
+ * @param[in] filePath Path to the phrase file.
+ *
+ * @return The file format.
+ */
+RecordFormat recordFormat(const std::string& filePath);
+
+/**
+ * @brief Reader parsing records of fields from a tabular file while reading it.
+ *
+ *        The file is read in chunks into a buffer, which only grows if a single record doesn't
+ *        fit. Field separators, quotes and line breaks are located with vectorized scanning.
+ *        Trailing whitespaces and carriage returns are removed from each field.
+ *
+ *        - TSV: fields are separated by tabs and not quoted.
+ *        - CSV: fields are separated by commas. Quoted fields may contain commas, line breaks
+ *          and quotes written as two consecutive quotes.
+ *        - JSON Lines: each line holds an array of values or an object, whose values are used
+ *          in order of appearance. String escapes are decoded, other values are kept as written.
+ *          Lines that aren't valid records are returned without fields.
+ *
+ *        A UTF-8 byte order mark is skipped. Each record is validated as a whole, records with
+ *        invalid UTF-8 are handled according to the UTF-8 policy. If the file is rejected,
+ *        reading stops at the first invalid record.
+ */
+class RecordReader final
+{
+public:
+    /** Default read buffer size in bytes. */
+    static constexpr std::size_t kDefaultBufferSize{1024U * 1024U};
+
+    /**
+     * @brief Create record reader.
+     *
+     * @param[in] filePath Path to the file to read records from.
+     * @param[in] format The file format, must not be RecordFormat::Lines.
+     * @param[in] bufferSize Initial read buffer size in bytes (default = 1 MB).
+     * @param[in] utf8Policy How to handle records containing invalid UTF-8 (default = report).
+     */
+    RecordReader(const std::string& filePath, RecordFormat format,
+                 std::size_t bufferSize = kDefaultBufferSize, Utf8Policy utf8Policy = Utf8Policy::Report);
+
+    /**
+     * @brief Close the file and delete the record reader.
+     */
+    ~RecordReader() noexcept = default;
+
+    /**
+     * @brief Check if the file was opened.
+     *
+     * @return True if the file is open, else false.
+     */
+    bool isOpen() const noexcept;
+
+    /**
+     * @brief Read the next record from the file.
+     *
+     * @param[out] fields Reference to vector storing the fields of the record. The strings are
+     *                    reused between records to avoid allocations.
+     *
+     * @return True if a record was read, false at the end of the file.
+     */
+    bool next(std::vector<std::string>& fields);
+
+    /**
+     * @brief Get the number of records read so far.
+     *
+     * @return The number of read records.
+     */
+    std::size_t recordCount() const noexcept;
+
+    /**
+     * @brief Get the numbers of the records with invalid UTF-8 read so far.
+     *
+     * @return Reference to vector holding the record numbers, starting at 1.
+     */
+    const std::vector<std::size_t>& invalidRecords() const noexcept;
+
+    RecordReader()                               = delete; // No default constructor.
+    RecordReader(const RecordReader&)            = delete; // No copy constructor.
+    RecordReader(RecordReader&&)                 = delete; // No move constructor.
+    RecordReader& operator=(const RecordReader&) = delete; // No copy assignment.
+    RecordReader& operator=(RecordReader&&)      = delete; // No move assignment.
+
+private:
+    bool fillBuffer();
+    bool checkUtf8(const char* first, const char* last, std::vector<std::string>& fields, 
+                   std::size_t fieldCount);
+    const char* parseRecord(const char* first, const char* last, std::vector<std::string>& fields,
+                            std::size_t& fieldCount) const;
+    const char* parseDelimited(const char* first, const char* last, std::vector<std::string>& fields,
+                               std::size_t& fieldCount) const;
+    const char* parseJsonLine(const char* first, const char* last, std::vector<std::string>& fields,
+                              std::size_t& fieldCount) const;
+
+    /** The file to read from. */
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> myFile;
+
+    /** The file format. */
+    RecordFormat myFormat;
+
+    /** Read buffer. */
+    std::vector<char> myBuffer;
+
+    /** Position of the next unparsed byte in the read buffer. */
+    std::size_t myPosition;
+
+    /** The number of valid bytes in the read buffer. */
+    std::size_t mySize;
+
+    /** Indicate whether the end of the file has been reached. */
+    bool myEndOfFile;
+
+    /** The number of records read so far. */
+    std::size_t myRecordCount;
+
+    /** How to handle records containing invalid UTF-8. */
+    Utf8Policy myUtf8Policy;
+
+    /** The numbers of the records with invalid UTF-8. */
+    std::vector<std::size_t> myInvalidRecords;
+
+    /** Indicate whether the file was rejected due to invalid UTF-8. */
+    bool myRejected;
+};
+} // namespace utils
+} // namespace language
@@ -0,0 +1,82 @@
+/**
+ * @brief Fast character scanning for language game.
+ */
+#pragma once
+
+#include <string_view>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Enumeration of instruction sets used by the scanning functions.
+ */
+enum class SimdLevel
+{
+    /** One byte at a time. */
+    Scalar,
+
+    /** 16 bytes at a time. */
+    Sse2,
+
+    /** 32 bytes at a time. */
+    Avx2,
+};
+
+/**
+ * @brief Get the instruction set used by the scanning functions.
+ *
+ *        The best instruction set supported by the CPU is selected on first use.
+ *
+ * @return The instruction set in use.
+ */
+SimdLevel simdLevel() noexcept;
+
+/**
+ * @brief Select the instruction set used by the scanning functions, e.g. for benchmarking.
+ *
+ *        Instruction sets not supported by the CPU are replaced by the best supported one
+ *        below. Not thread-safe, should be called before scanning starts.
+ *
+ * @param[in] level The instruction set to use.
+ *
+ * @return The instruction set in use.
+ */
+SimdLevel setSimdLevel(SimdLevel level) noexcept;
+
+/**
+ * @brief Find the first occurrence of any of up to four characters.
+ *
+ * @param[in] first Pointer to the first byte to search.
+ * @param[in] last Pointer past the last byte to search.
+ * @param[in] characters The characters to search for, one to four characters.
+ *
+ * @return Pointer to the first matching byte, or last if none of the characters was found.
+ */
+const char* findFirstOf(const char* first, const char* last, std::string_view characters) noexcept;
+
+/**
+ * @brief Find the end of a text without trailing whitespaces.
+ *
+ *        Whitespaces are spaces, tabs, line feeds, vertical tabs, form feeds and carriage returns,
+ *        like std::isspace in the "C" locale.
+ *
+ * @param[in] first Pointer to the first byte of the text.
+ * @param[in] last Pointer past the last byte of the text.
+ *
+ * @return Pointer past the last byte that isn't a whitespace, or first if there is none.
+ */
+const char* trimTrailingWhitespaces(const char* first, const char* last) noexcept;
+
+/**
+ * @brief Check if a text only consists of whitespaces.
+ *
+ * @param[in] first Pointer to the first byte of the text.
+ * @param[in] last Pointer past the last byte of the text.
+ *
+ * @return True if the text is empty or only consists of whitespaces, else false.
+ */
+bool isBlank(const char* first, const char* last) noexcept;
+} // namespace utils
+} // namespace language
@@ -0,0 +1,98 @@
+/**
+ * @brief Timer-driven task scheduler for language game.
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Scheduler running a task periodically on a dedicated thread.
+ *
+ *        The task is run at absolute deadlines counted from the start time, so the cadence
+ *        doesn't drift with the execution time of the task. If the task falls behind by more
+ *        than one interval, the schedule is restarted from the current time instead of running
+ *        the missed executions in a burst.
+ */
+class Scheduler final
+{
+public:
+    /** Task to run, returns false when no more executions are needed. */
+    using Task = std::function<bool()>;
+
+    /**
+     * @brief Create scheduler.
+     *
+     * @param[in] interval Interval between consecutive executions of the task.
+     * @param[in] task The task to run.
+     */
+    Scheduler(std::chrono::milliseconds interval, Task task);
+
+    /**
+     * @brief Stop the scheduler and delete it.
+     */
+    ~Scheduler() noexcept;
+
+    /**
+     * @brief Start running the task, the first execution is done immediately.
+     *
+     *        Calling this function while the scheduler is running has no effect.
+     */
+    void start();
+
+    /**
+     * @brief Block until the task has finished.
+     */
+    void wait();
+
+    /**
+     * @brief Stop the scheduler, pending executions are cancelled.
+     */
+    void stop();
+
+    /**
+     * @brief Check if the scheduler is running.
+     *
+     * @return True if the task is still scheduled, else false.
+     */
+    bool running() const noexcept;
+
+    Scheduler()                            = delete; // No default constructor.
+    Scheduler(const Scheduler&)            = delete; // No copy constructor.
+    Scheduler(Scheduler&&)                 = delete; // No move constructor.
+    Scheduler& operator=(const Scheduler&) = delete; // No copy assignment.
+    Scheduler& operator=(Scheduler&&)      = delete; // No move assignment.
+
+private:
+    void run();
+
+    /** Interval between consecutive executions of the task. */
+    std::chrono::milliseconds myInterval;
+
+    /** The task to run. */
+    Task myTask;
+
+    /** Thread running the task. */
+    std::thread myThread;
+
+    /** Mutex protecting the stop and running flags. */
+    mutable std::mutex myMutex;
+
+    /** Condition used to wake up the scheduler thread when stopped. */
+    std::condition_variable myCondition;
+
+    /** Indicate whether the scheduler has been requested to stop. */
+    bool myStopRequested;
+
+    /** Indicate whether the task is still scheduled. */
+    bool myRunning;
+};
+} // namespace utils
+} // namespace language
@@ -0,0 +1,93 @@
+/**
+ * @brief Lock-free queue for one producer and one consumer thread.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Bounded lock-free queue for exactly one producer and one consumer thread.
+ *
+ *        The producer only writes the tail and the consumer only writes the head, so neither
+ *        side ever waits for the other. Both indexes are kept on separate cache lines.
+ *
+ * @tparam T Type of the queued values.
+ * @tparam Capacity The maximum number of queued values, a power of two.
+ */
+template <typename T, std::size_t Capacity>
+class SpscQueue final
+{
+    static_assert((0U < Capacity) && (0U == (Capacity & (Capacity - 1U))), "Capacity must be a power of two.");
+
+public:
+    /**
+     * @brief Create empty queue.
+     */
+    SpscQueue() = default;
+
+    /**
+     * @brief Append a value, only to be called by the producer thread.
+     *
+     * @param[in] value The value to append.
+     *
+     * @return True if the value was appended, false if the queue is full.
+     */
+    bool push(T value)
+    {
+        const auto tail{myTail.load(std::memory_order_relaxed)};
+        if (Capacity == tail - myHead.load(std::memory_order_acquire)) { return false; }
+        mySlots[tail & (Capacity - 1U)] = std::move(value);
+        myTail.store(tail + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest value, only to be called by the consumer thread.
+     *
+     * @param[out] value The removed value.
+     *
+     * @return True if a value was removed, false if the queue is empty.
+     */
+    bool pop(T &value)
+    {
+        const auto head{myHead.load(std::memory_order_relaxed)};
+        if (head == myTail.load(std::memory_order_acquire)) { return false; }
+        value = std::move(mySlots[head & (Capacity - 1U)]);
+        myHead.store(head + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Check if the queue is empty.
+     *
+     * @return True if no value is queued, else false.
+     */
+    bool empty() const noexcept
+    {
+        return myHead.load(std::memory_order_acquire) == myTail.load(std::memory_order_acquire);
+    }
+
+    SpscQueue(const SpscQueue &)             = delete; // No copy constructor.
+    SpscQueue(SpscQueue &&)                  = delete; // No move constructor.
+    SpscQueue & operator=(const SpscQueue &) = delete; // No copy assignment.
+    SpscQueue & operator=(SpscQueue &&)      = delete; // No move assignment.
+
+private:
+    /** Index of the next value to remove, written by the consumer. */
+    alignas(64) std::atomic<std::size_t> myHead{};
+
+    /** Index of the next value to append, written by the producer. */
+    alignas(64) std::atomic<std::size_t> myTail{};
+
+    /** Queued values. */
+    alignas(64) std::array<T, Capacity> mySlots{};
+};
+} // namespace utils
+} // namespace language
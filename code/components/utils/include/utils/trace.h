@@ -0,0 +1,75 @@
+/**
+ * @brief Timeline of spans in Chrome trace-event format for language game.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace language
+{
+namespace utils
+{
+namespace trace
+{
+/** The number of spans kept per thread, older spans are overwritten, a multiple of 1024. */
+constexpr std::size_t kSpansPerThread{1U << 16U};
+
+namespace detail
+{
+/** Indicate whether spans are recorded. */
+extern std::atomic<bool> enabled;
+} // namespace detail
+
+/**
+ * @brief Check if spans are recorded.
+ *
+ * @return True if tracing was started, else false.
+ */
+inline bool enabled() noexcept { return detail::enabled.load(std::memory_order_relaxed); }
+
+/**
+ * @brief Record a span on the calling thread.
+ *
+ *        Each thread writes to its own ring buffer without locking, only its first span takes
+ *        a lock to register the buffer. Spans are ignored unless tracing was started.
+ *
+ * @param[in] name Name of the span, must stay valid until exit.
+ * @param[in] start Start time of the span.
+ * @param[in] end End time of the span.
+ */
+void record(const char *name, std::chrono::steady_clock::time_point start,
+            std::chrono::steady_clock::time_point end) noexcept;
+
+/**
+ * @brief Name the calling thread in the timeline.
+ *
+ * @param[in] name Name of the thread, must stay valid until exit.
+ */
+void setThreadName(const char *name) noexcept;
+
+/**
+ * @brief Write all recorded spans as Chrome trace-event JSON, e.g. for chrome://tracing or
+ *        Perfetto.
+ *
+ *        Spans are only read consistently once the threads recording them have finished.
+ *
+ * @param[in] filePath Path to the trace file.
+ *
+ * @return True if the file was written, else false.
+ */
+bool write(const std::string &filePath);
+
+/**
+ * @brief Start recording spans and write them to a file at exit.
+ *
+ *        The calling thread is named "main" in the timeline.
+ *
+ * @param[in] filePath Path to the trace file, "trace.json" if empty.
+ */
+void writeAtExit(const std::string &filePath);
+} // namespace trace
+} // namespace utils
+} // namespace language
@@ -0,0 +1,85 @@
+/**
+ * @brief UTF-8 validation and repair for language game.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Enumeration of ways to handle invalid UTF-8 in phrase files.
+ */
+enum class Utf8Policy
+{
+    /** Keep invalid lines as they are, but report their line numbers. */
+    Report,
+
+    /** Refuse to load files containing invalid UTF-8. */
+    Reject,
+
+    /** Replace each invalid sequence with the replacement character U+FFFD. */
+    Repair,
+};
+
+/**
+ * @brief Parse a UTF-8 policy from its name ("report", "reject" or "repair").
+ *
+ * @param[in] name The policy name.
+ * @param[out] policy Reference to variable storing the parsed policy, unchanged on failure.
+ *
+ * @return True if the name is valid, else false.
+ */
+bool parseUtf8Policy(const std::string& name, Utf8Policy& policy) noexcept;
+
+/**
+ * @brief Get the size of the byte order mark at the beginning of a text.
+ *
+ * @param[in] first Pointer to the first byte of the text.
+ * @param[in] last Pointer past the last byte of the text.
+ *
+ * @return 3 if the text starts with a UTF-8 byte order mark, else 0.
+ */
+std::size_t byteOrderMarkSize(const char* first, const char* last) noexcept;
+
+/**
+ * @brief Check if a text is valid UTF-8.
+ *
+ *        Overlong encodings, surrogates, code points above U+10FFFF and truncated sequences
+ *        are invalid. With AVX2 the text is validated 32 bytes at a time without branches
+ *        (lookup algorithm by Keiser and Lemire), else blocks of ASCII are skipped and other
+ *        bytes are decoded one sequence at a time.
+ *
+ * @param[in] first Pointer to the first byte of the text.
+ * @param[in] last Pointer past the last byte of the text.
+ *
+ * @return True if the text is valid UTF-8, else false.
+ */
+bool isValidUtf8(const char* first, const char* last) noexcept;
+
+/**
+ * @brief Find the first invalid UTF-8 sequence in a text.
+ *
+ * @param[in] first Pointer to the first byte of the text.
+ * @param[in] last Pointer past the last byte of the text.
+ *
+ * @return Pointer to the first byte of the first invalid sequence, or last if the text is valid.
+ */
+const char* findInvalidUtf8(const char* first, const char* last) noexcept;
+
+/**
+ * @brief Replace invalid UTF-8 sequences in a string with the replacement character U+FFFD.
+ *
+ *        An invalid byte and the continuation bytes following it are replaced by one
+ *        replacement character.
+ *
+ * @param[in,out] str String to repair.
+ *
+ * @return The number of replaced sequences.
+ */
+std::size_t repairUtf8(std::string& str);
+} // namespace utils
+} // namespace language
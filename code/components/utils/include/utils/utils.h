@@ -14,6 +14,7 @@
 #include <type_traits>
 
 #include "phrase.h"
+#include "utf8.h"
 
 namespace language
 {
@@ -23,15 +24,26 @@ namespace
 {
 
 // ---------------------------------------------------------------------------
-void initRandomGenerator() noexcept
+bool& randomGeneratorInitialized() noexcept
 {
-    // Only initialize the random generator once.
     static bool isInitialized{false};
-    if (isInitialized) { return; }
+    return isInitialized;
+}
+
+// ---------------------------------------------------------------------------
+void initRandomGenerator(const unsigned seed) noexcept
+{
+    // Initialize the random generator with a given seed, e.g. to repeat a recorded session.
+    std::srand(seed);
+    randomGeneratorInitialized() = true;
+}
 
-    // Initialize the random generator.
-    std::srand(std::time(nullptr));
-    isInitialized = true;
+// ---------------------------------------------------------------------------
+void initRandomGenerator() noexcept
+{
+    // Only initialize the random generator once.
+    if (randomGeneratorInitialized()) { return; }
+    initRandomGenerator(static_cast<unsigned>(std::time(nullptr)));
 }
 
 /**
@@ -167,8 +179,9 @@ bool numberFoundInVector(T searchedNumber, const std::vector<T>& numbers) noexce
  * @param[out] str Reference to string storing the entered line as text.
  * @param[in] space Space to print after the input has been read (default = no space).
  *
+ * @return True if a line was read, false if the input has been closed.
  */
-void readLine(std::string& str, const char* space = "");
+bool readLine(std::string& str, const char* space = "");
 
 /**
  * @brief Check if file exists.
@@ -188,6 +201,18 @@ bool fileExists(const std::string& filePath);
  */
 std::size_t loadPhrasesFromFile(const std::string& filePath, std::list<Phrase>& phrases);
 
+/**
+ * @brief Load phrases in primary and target language from file, handling invalid UTF-8.
+ *
+ * @param[in] filePath Path to file containing phrase pairs to load the list with.
+ * @param[out] phrases Reference to list storing the loaded phrase pairs.
+ * @param[in] utf8Policy How to handle lines containing invalid UTF-8.
+ * @param[out] invalidLines Reference to vector storing the numbers of lines with invalid UTF-8.
+ * @return Number of loaded phrases, 0 if the file is rejected.
+ */
+std::size_t loadPhrasesFromFile(const std::string& filePath, std::list<Phrase>& phrases, 
+                                Utf8Policy utf8Policy, std::vector<std::size_t>& invalidLines);
+
 /**
  * @brief Load phrases in primary and target language from file and store them in given vector.
  *
@@ -215,6 +240,14 @@ bool writePhrasesToFile(const std::string& filePath, const std::list<Phrase>& ph
  */
 bool writePhrasesToFile(const std::string& filePath, const std::vector<Phrase>& phrases);
 
+/**
+ * @brief Remove duplicate phrases from a list, keeping the first occurrence of each phrase.
+ *
+ * @param[in,out] phrases List of phrases to remove duplicates from.
+ * @return True if at least one duplicate was removed, false otherwise.
+ */
+bool removeDuplicates(std::list<Phrase>& phrases);
+
 /**
  * @brief Retrieve non-empty lines from a file and store them in a vector.
  *
@@ -224,6 +257,22 @@ bool writePhrasesToFile(const std::string& filePath, const std::vector<Phrase>&
  */
 bool retrieveFromFile(const std::string& filePath, std::vector<std::string>& data);
 
+/**
+ * @brief Retrieve non-empty lines from a file, handling invalid UTF-8.
+ *
+ *        A UTF-8 byte order mark at the beginning of the file is skipped. The file is validated 
+ *        one chunk at a time, lines are only checked individually if a chunk is invalid.
+ *
+ * @param[in] filePath Path to the file to read from.
+ * @param[out] data Vector to store the non-empty lines read from the file.
+ * @param[in] utf8Policy How to handle lines containing invalid UTF-8.
+ * @param[out] invalidLines Reference to vector storing the numbers of lines with invalid UTF-8,
+ *                          starting at 1.
+ * @return True if at least one line was loaded, false otherwise or if the file is rejected.
+ */
+bool retrieveFromFile(const std::string& filePath, std::vector<std::string>& data, 
+                      Utf8Policy utf8Policy, std::vector<std::size_t>& invalidLines);
+
 /**
  * @brief Remove trailing whitespace characters from a string.
  *
@@ -0,0 +1,106 @@
+/**
+ * @brief Interned vocabulary mapping words to 32-bit token IDs.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Vocabulary storing each distinct word once and identifying it by a token ID.
+ *
+ *        Words are stored back-to-back in large blocks, which are never moved, so the views
+ *        returned for each token stay valid for the lifetime of the vocabulary. Token IDs 
+ *        are assigned in order of first appearance, starting from 0.
+ */
+class Vocabulary final
+{
+public:
+    /** Token ID type. */
+    using Token = std::uint32_t;
+
+    /** Token ID returned for words that aren't in the vocabulary. */
+    static constexpr Token kUnknownToken{UINT32_MAX};
+
+    /**
+     * @brief Create empty vocabulary.
+     */
+    Vocabulary() noexcept;
+
+    /**
+     * @brief Delete vocabulary.
+     */
+    ~Vocabulary() noexcept = default;
+
+    /**
+     * @brief Get the token ID of a word, adding the word to the vocabulary if needed.
+     *
+     * @param[in] word The word to intern.
+     *
+     * @return The token ID of the word.
+     */
+    Token intern(std::string_view word);
+
+    /**
+     * @brief Get the token ID of a word without adding it to the vocabulary.
+     *
+     * @param[in] word The word to search for.
+     *
+     * @return The token ID of the word, or kUnknownToken if the word isn't in the vocabulary.
+     */
+    Token find(std::string_view word) const noexcept;
+
+    /**
+     * @brief Get the word of a token ID.
+     *
+     * @param[in] token The token ID, must be smaller than the vocabulary size.
+     *
+     * @return View of the word, valid for the lifetime of the vocabulary.
+     */
+    std::string_view word(Token token) const noexcept;
+
+    /**
+     * @brief Get the number of distinct words in the vocabulary.
+     *
+     * @return The number of distinct words.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * @brief Get the approximate memory usage of the vocabulary.
+     *
+     * @return The approximate memory usage in bytes.
+     */
+    std::size_t memoryUsage() const noexcept;
+
+    Vocabulary(const Vocabulary&)            = delete; // No copy constructor.
+    Vocabulary(Vocabulary&&)                 = delete; // No move constructor.
+    Vocabulary& operator=(const Vocabulary&) = delete; // No copy assignment.
+    Vocabulary& operator=(Vocabulary&&)      = delete; // No move assignment.
+
+private:
+    /** Size of each block of word storage in bytes. */
+    static constexpr std::size_t kBlockSize{64U * 1024U};
+
+    /** Blocks of word storage. */
+    std::vector<std::unique_ptr<char[]>> myBlocks;
+
+    /** The number of used bytes in the last block. */
+    std::size_t myBlockUsage;
+
+    /** Words indexed by token ID. */
+    std::vector<std::string_view> myWords;
+
+    /** Token IDs indexed by word. */
+    std::unordered_map<std::string_view, Token> myTokens;
+};
+} // namespace utils
+} // namespace language
@@ -0,0 +1,109 @@
+/**
+ * @brief Word-level alignment of guesses and answers for language game.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Edit turning one token sequence into another.
+ */
+struct TokenEdit
+{
+    /**
+     * @brief Enumeration of edit types.
+     */
+    enum class Type
+    {
+        /** Token present in the source sequence only. */
+        Delete,
+
+        /** Token present in the destination sequence only. */
+        Insert,
+    };
+
+    /** The edit type. */
+    Type type;
+
+    /** Position in the source sequence, the deleted token or the token the insert precedes. */
+    std::size_t sourcePosition;
+
+    /** Position in the destination sequence, the inserted token or the token the delete precedes. */
+    std::size_t destinationPosition;
+};
+
+/**
+ * @brief Difference between a guessed word and an answer word.
+ */
+struct WordDifference
+{
+    /**
+     * @brief Enumeration of word difference types.
+     */
+    enum class Type
+    {
+        /** Answer word not present in the guess. */
+        Missing,
+
+        /** Guessed word not present in the answer. */
+        Extra,
+
+        /** Word present in both, but at another position in the guess. */
+        Swapped,
+
+        /** Guessed word similar to, but not equal to the answer word at the same position. */
+        Misspelled,
+    };
+
+    /** The difference type. */
+    Type type;
+
+    /** The answer word, empty for extra words. */
+    std::string_view answerWord;
+
+    /** The guessed word, empty for missing words. */
+    std::string_view guessWord;
+
+    /** Position of the word in the answer, or of the answer word the extra word precedes. */
+    std::size_t answerPosition;
+
+    /** Position of the word in the guess, or of the guessed word the missing word precedes. */
+    std::size_t guessPosition;
+};
+
+/**
+ * @brief Find the shortest sequence of edits turning one token sequence into another.
+ *
+ *        Uses Myers' difference algorithm after skipping the common prefix and suffix, so the
+ *        cost grows with the number of differences rather than with the sequence lengths.
+ *
+ * @param[in] source The source token sequence.
+ * @param[in] destination The destination token sequence.
+ *
+ * @return The edits in order of position.
+ */
+std::vector<TokenEdit> diffTokens(const std::vector<std::uint32_t>& source,
+                                  const std::vector<std::uint32_t>& destination);
+
+/**
+ * @brief Align the words of a guess with the words of the answer.
+ *
+ *        Words are separated by whitespace and compared as token IDs. Words appearing in both
+ *        texts at different positions are reported as swapped, and differing words at the same
+ *        position that are within a few characters of each other are reported as misspelled.
+ *
+ * @param[in] guess The guess.
+ * @param[in] answer The answer.
+ *
+ * @return The word differences in order of answer position. The views refer to the input texts.
+ */
+std::vector<WordDifference> alignWords(std::string_view guess, std::string_view answer);
+} // namespace utils
+} // namespace language
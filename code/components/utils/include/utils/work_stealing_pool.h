@@ -0,0 +1,115 @@
+/**
+ * @brief Thread pool balancing tasks between its threads by work stealing.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace language
+{
+namespace utils
+{
+/**
+ * @brief Thread pool with one task queue per thread.
+ *
+ *        Each thread runs the newest task of its own queue first, and steals the oldest task of
+ *        another queue when its own queue is empty, so that busy threads are relieved without a
+ *        shared queue. Tasks submitted from outside the pool are spread over the queues, tasks
+ *        submitted from a task are added to the queue of the running thread.
+ */
+class WorkStealingPool final
+{
+public:
+    /** Task to run, receives the index of the running thread, from 0 to threadCount() - 1. */
+    using Task = std::function<void(std::size_t)>;
+
+    /**
+     * @brief Create thread pool and start its threads.
+     *
+     * @param[in] threadCount The number of threads, 0 to use one thread per core (default = 0).
+     */
+    explicit WorkStealingPool(std::size_t threadCount = 0U);
+
+    /**
+     * @brief Wait for all submitted tasks, then stop the threads and delete the pool.
+     */
+    ~WorkStealingPool() noexcept;
+
+    /**
+     * @brief Submit a task to run on one of the threads.
+     *
+     * @param[in] task The task to run.
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Block until all submitted tasks have finished, must not be called from a task.
+     */
+    void wait();
+
+    /**
+     * @brief Get the number of threads.
+     *
+     * @return The number of threads.
+     */
+    std::size_t threadCount() const noexcept;
+
+    WorkStealingPool()                                   = delete; // No default constructor.
+    WorkStealingPool(const WorkStealingPool&)            = delete; // No copy constructor.
+    WorkStealingPool(WorkStealingPool&&)                 = delete; // No move constructor.
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete; // No copy assignment.
+    WorkStealingPool& operator=(WorkStealingPool&&)      = delete; // No move assignment.
+
+private:
+    /**
+     * @brief Task queue of one thread.
+     */
+    struct Queue
+    {
+        /** Mutex protecting the tasks, only contended when a task is stolen. */
+        std::mutex mutex;
+
+        /** Queued tasks, oldest first. */
+        std::deque<Task> tasks;
+    };
+
+    void run(std::size_t index);
+    bool take(std::size_t index, Task& task);
+
+    /** Task queues by thread index. */
+    std::vector<std::unique_ptr<Queue>> myQueues;
+
+    /** Threads running the tasks. */
+    std::vector<std::thread> myThreads;
+
+    /** Mutex protecting the task counts and the stop flag. */
+    std::mutex myMutex;
+
+    /** Condition used to wake up threads when tasks were submitted or the pool is stopped. */
+    std::condition_variable myTaskCondition;
+
+    /** Condition used to wake up waiting threads when all tasks have finished. */
+    std::condition_variable myIdleCondition;
+
+    /** The number of queued tasks not yet taken by a thread. */
+    std::size_t myQueuedCount;
+
+    /** The number of submitted tasks not yet finished. */
+    std::size_t myPendingCount;
+
+    /** Indicate whether the threads have been requested to stop. */
+    bool myStopRequested;
+
+    /** Index of the queue for the next task submitted from outside the pool. */
+    std::atomic<std::size_t> myNextQueue;
+};
+} // namespace utils
+} // namespace language
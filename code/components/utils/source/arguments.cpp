@@ -0,0 +1,68 @@
+/**
+ * @brief Implementation details of class language::utils::Arguments.
+ */
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "utils/arguments.h"
+
+namespace language
+{
+namespace utils
+{
+namespace
+{
+// ---------------------------------------------------------------------------
+bool isOption(const std::string& arg) { return (2U < arg.size()) && (0U == arg.rfind("--", 0U)); }
+} // namespace
+
+// ---------------------------------------------------------------------------
+Arguments::Arguments(const int argc, const char** argv)
+    : myPositional{}
+    , myOptions{}
+{
+    for (int i{}; i < argc; ++i)
+    {
+        const std::string arg{argv[i]};
+
+        if ((0 < i) && isOption(arg))
+        {
+            const auto separator{arg.find('=')};
+            const auto name{arg.substr(2U, separator - 2U)};
+            myOptions[name] = (std::string::npos != separator) ? arg.substr(separator + 1U) : "";
+        }
+        else { myPositional.push_back(arg); }
+    }
+}
+
+// ---------------------------------------------------------------------------
+const std::vector<std::string>& Arguments::positional() const noexcept { return myPositional; }
+
+// ---------------------------------------------------------------------------
+std::size_t Arguments::positionalCount() const noexcept { return myPositional.size(); }
+
+// ---------------------------------------------------------------------------
+bool Arguments::hasOption(const std::string& name) const
+{
+    return myOptions.find(name) != myOptions.end();
+}
+
+// ---------------------------------------------------------------------------
+std::string Arguments::option(const std::string& name, const std::string& defaultValue) const
+{
+    const auto option{myOptions.find(name)};
+    return option != myOptions.end() ? option->second : defaultValue;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t Arguments::numericOption(const std::string& name, const std::size_t defaultValue) const
+{
+    const auto value{option(name)};
+    if (value.empty()) { return defaultValue; }
+    char* end{nullptr};
+    const auto number{std::strtoull(value.c_str(), &end, 10)};
+    return ('\0' == *end) ? static_cast<std::size_t>(number) : defaultValue;
+}
+} // namespace utils
+} // namespace language
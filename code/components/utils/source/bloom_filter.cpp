@@ -0,0 +1,78 @@
+/**
+ * @brief Implementation details of class language::utils::BloomFilter.
+ */
+#include <cstdint>
+
+#include "utils/bloom_filter.h"
+
+namespace language
+{
+namespace utils
+{
+namespace
+{
+/** The number of bits per word. */
+constexpr std::uint64_t kWordBits{64U};
+
+// ---------------------------------------------------------------------------
+std::uint64_t mix(std::uint64_t x) noexcept
+{
+    // Finalizer of SplitMix64, used to derive a second independent hash.
+    x ^= x >> 30U;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27U;
+    x *= 0x94d049bb133111ebULL;
+    return x ^ (x >> 31U);
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+BloomFilter::BloomFilter(const std::size_t sizeInBytes, const std::size_t hashCount)
+    : myBits((sizeInBytes * 8U + kWordBits - 1U) / kWordBits + 1U)
+    , myBitCount{myBits.size() * kWordBits}
+    , myHashCount{0U < hashCount ? hashCount : 1U}
+{}
+
+// ---------------------------------------------------------------------------
+bool BloomFilter::insert(const std::uint64_t hash) noexcept
+{
+    bool present{true};
+
+    for (std::size_t i{}; i < myHashCount; ++i)
+    {
+        const auto bit{position(hash, i)};
+        auto& word{myBits[bit / kWordBits]};
+        const auto mask{std::uint64_t{1U} << (bit % kWordBits)};
+        if (0U == (word & mask)) { present = false; }
+        word |= mask;
+    }
+    return present;
+}
+
+// ---------------------------------------------------------------------------
+bool BloomFilter::contains(const std::uint64_t hash) const noexcept
+{
+    for (std::size_t i{}; i < myHashCount; ++i)
+    {
+        const auto bit{position(hash, i)};
+        if (0U == (myBits[bit / kWordBits] & (std::uint64_t{1U} << (bit % kWordBits)))) 
+        { 
+            return false; 
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t BloomFilter::sizeInBytes() const noexcept { return myBits.size() * sizeof(std::uint64_t); }
+
+// ---------------------------------------------------------------------------
+std::uint64_t BloomFilter::position(const std::uint64_t hash, const std::size_t i) const noexcept
+{
+    // Double hashing: h(i) = h1 + i * h2, with an odd h2 to visit distinct positions.
+    const auto h1{mix(hash)};
+    const auto h2{mix(hash ^ 0x9e3779b97f4a7c15ULL) | 1U};
+    return (h1 + i * h2) % myBitCount;
+}
+} // namespace utils
+} // namespace language
@@ -0,0 +1,81 @@
+/**
+ * @brief Implementation details of class language::utils::InputReader.
+ */
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "utils/input_reader.h"
+
+namespace language
+{
+namespace utils
+{
+namespace
+{
+/** Time to wait for the waiting thread to catch up when too many lines were entered ahead. */
+constexpr std::chrono::milliseconds kFullQueueDelay{1};
+} // namespace
+
+// ---------------------------------------------------------------------------
+InputReader &InputReader::instance()
+{
+    // Never deleted, the detached reader thread may still use it at exit.
+    static auto *reader{new InputReader{}};
+    return *reader;
+}
+
+// ---------------------------------------------------------------------------
+InputReader::InputReader()
+    : myLines{}
+    , myMutex{}
+    , myCondition{}
+    , myClosed{false}
+{
+    std::thread{&InputReader::run, this}.detach();
+}
+
+// ---------------------------------------------------------------------------
+bool InputReader::readLine(std::string &str, const std::chrono::steady_clock::time_point deadline,
+                           const char *space)
+{
+    auto available = [this]() { return !myLines.empty() || myClosed.load(std::memory_order_acquire); };
+    if (!available())
+    {
+        std::unique_lock<std::mutex> lock{myMutex};
+        if (std::chrono::steady_clock::time_point::max() == deadline) { myCondition.wait(lock, available); }
+        else if (!myCondition.wait_until(lock, deadline, available)) { return false; }
+    }
+    if (!myLines.pop(str)) { str.clear(); }
+
+    // Add space if specified, leave flushing to the next write.
+    if (space) { std::cout << space << '\n'; }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+bool InputReader::closed() const noexcept
+{
+    return myClosed.load(std::memory_order_acquire) && myLines.empty();
+}
+
+// ---------------------------------------------------------------------------
+void InputReader::run()
+{
+    std::string line{};
+    while (std::getline(std::cin, line))
+    {
+        while (!myLines.push(line)) { std::this_thread::sleep_for(kFullQueueDelay); }
+
+        // Lock briefly so that the line isn't missed between checking the queue and waiting.
+        { std::lock_guard<std::mutex> lock{myMutex}; }
+        myCondition.notify_one();
+    }
+    myClosed.store(true, std::memory_order_release);
+    { std::lock_guard<std::mutex> lock{myMutex}; }
+    myCondition.notify_one();
+}
+} // namespace utils
+} // namespace language
@@ -0,0 +1,100 @@
+/**
+ * @brief Implementation details of class language::utils::LatencyHistogram.
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "utils/latency_histogram.h"
+
+namespace language
+{
+namespace utils
+{
+// ---------------------------------------------------------------------------
+void LatencyHistogram::record(std::uint64_t value) noexcept
+{
+    value = std::min(value, kMaxValue);
+    ++myCounts[index(value)];
+    ++myCount;
+    myMax = std::max(myMax, value);
+}
+
+// ---------------------------------------------------------------------------
+void LatencyHistogram::add(const LatencyHistogram &other) noexcept
+{
+    for (std::size_t i{}; i < kBucketCount; ++i) { myCounts[i] += other.myCounts[i]; }
+    myCount += other.myCount;
+    myMax = std::max(myMax, other.myMax);
+}
+
+// ---------------------------------------------------------------------------
+std::uint64_t LatencyHistogram::percentile(const double percentile) const noexcept
+{
+    if (0U == myCount) { return 0U; }
+
+    // Find the bucket holding the value at the requested rank, counting from one.
+    const auto rank{std::max<std::uint64_t>(static_cast<std::uint64_t>(
+        std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(myCount))), 1U)};
+    std::uint64_t total{};
+
+    for (std::size_t i{}; i < kBucketCount; ++i)
+    {
+        total += myCounts[i];
+        if (rank <= total) { return std::min(highestEquivalentValue(i), myMax); }
+    }
+    return myMax;
+}
+
+// ---------------------------------------------------------------------------
+void LatencyHistogram::clear() noexcept
+{
+    myCounts.fill(0U);
+    myCount = 0U;
+    myMax   = 0U;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t LatencyHistogram::index(const std::uint64_t value) noexcept
+{
+    if (kSubBucketCount > value) { return static_cast<std::size_t>(value); }
+
+    // Keep the highest kSubBucketBits bits, whose first bit is always set.
+    const auto msb{static_cast<std::uint32_t>(63 - __builtin_clzll(value))};
+    const auto shift{msb - kSubBucketBits + 1U};
+    const auto top{static_cast<std::size_t>(value >> shift)};
+    return kSubBucketCount + (shift - 1U) * kHalfSubBucketCount + (top - kHalfSubBucketCount);
+}
+
+// ---------------------------------------------------------------------------
+std::uint64_t LatencyHistogram::highestEquivalentValue(const std::size_t index) noexcept
+{
+    if (kSubBucketCount > index) { return index; }
+    const auto shift{(index - kSubBucketCount) / kHalfSubBucketCount + 1U};
+    const auto top{(index - kSubBucketCount) % kHalfSubBucketCount + kHalfSubBucketCount};
+    return ((static_cast<std::uint64_t>(top) + 1U) << shift) - 1U;
+}
+
+// ---------------------------------------------------------------------------
+std::string formatLatency(const std::uint64_t microseconds)
+{
+    std::ostringstream text{};
+    text.setf(std::ios::fixed);
+
+    if (1000U > microseconds) { text << microseconds << " us"; }
+    else if (1000000U > microseconds)
+    {
+        text.precision(1);
+        text << static_cast<double>(microseconds) / 1e3 << " ms";
+    }
+    else
+    {
+        text.precision(2);
+        text << static_cast<double>(microseconds) / 1e6 << " s";
+    }
+    return text.str();
+}
+} // namespace utils
+} // namespace language
@@ -0,0 +1,305 @@
+/**
+ * @brief Implementation details of the metrics of language game.
+ */
+#include <array>
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+
+#include "utils/metrics.h"
+
+namespace language
+{
+namespace utils
+{
+namespace metrics
+{
+namespace
+{
+/** Nanoseconds per second. */
+constexpr double kNanosecondsPerSecond{1e9};
+
+/**
+ * @brief Values of all metrics accumulated by one thread.
+ *
+ *        Only the owning thread writes the values, other threads read them when exporting.
+ */
+struct ThreadValues
+{
+    /** Accumulated values by metric index. */
+    std::array<std::atomic<std::uint64_t>, kMaxMetricCount> totals{};
+
+    /** The number of recorded values by metric index. */
+    std::array<std::atomic<std::uint64_t>, kMaxMetricCount> counts{};
+
+    /** The biggest recorded value by metric index. */
+    std::array<std::atomic<std::uint64_t>, kMaxMetricCount> maxima{};
+};
+
+/**
+ * @brief Metric values summed up over all threads.
+ */
+struct Snapshot
+{
+    /** Name of the metric. */
+    const char *name;
+
+    /** The metric type. */
+    MetricType type;
+
+    /** Description of the metric. */
+    const char *help;
+
+    /** Accumulated value. */
+    std::uint64_t total;
+
+    /** The number of recorded values. */
+    std::uint64_t count;
+
+    /** The biggest recorded value. */
+    std::uint64_t maximum;
+};
+
+/**
+ * @brief Registry of all metrics and the values of all threads.
+ *
+ *        The values of a thread are kept after the thread exits, so that nothing is lost.
+ */
+class Registry final
+{
+public:
+    /**
+     * @brief Get the registry.
+     *
+     * @return Reference to the registry.
+     */
+    static Registry &instance()
+    {
+        static Registry registry{};
+        return registry;
+    }
+
+    /**
+     * @brief Register a metric, metrics with the same name share the same index.
+     *
+     * @return The index of the metric, kMaxMetricCount if all indexes are taken.
+     */
+    std::size_t add(const char *name, const MetricType type, const char *help)
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        for (std::size_t i{}; i < myMetricCount; ++i)
+        {
+            if (0 == std::strcmp(myMetrics[i].name, name)) { return i; }
+        }
+        if (kMaxMetricCount == myMetricCount) { return kMaxMetricCount; }
+        myMetrics[myMetricCount] = Snapshot{name, type, help, 0U, 0U, 0U};
+        return myMetricCount++;
+    }
+
+    /**
+     * @brief Get the values of the calling thread, created on first use.
+     *
+     * @return Reference to the values.
+     */
+    ThreadValues &threadValues()
+    {
+        thread_local ThreadValues *values{nullptr};
+        if (!values)
+        {
+            std::lock_guard<std::mutex> lock{myMutex};
+            myThreadValues.push_back(std::make_unique<ThreadValues>());
+            values = myThreadValues.back().get();
+        }
+        return *values;
+    }
+
+    /**
+     * @brief Sum up the values of all threads.
+     *
+     * @return The metrics in order of registration.
+     */
+    std::vector<Snapshot> snapshot()
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        std::vector<Snapshot> metrics{myMetrics.begin(), myMetrics.begin() + myMetricCount};
+
+        for (const auto &values : myThreadValues)
+        {
+            for (std::size_t i{}; i < metrics.size(); ++i)
+            {
+                metrics[i].total += values->totals[i].load(std::memory_order_relaxed);
+                metrics[i].count += values->counts[i].load(std::memory_order_relaxed);
+                const auto maximum{values->maxima[i].load(std::memory_order_relaxed)};
+                if (metrics[i].maximum < maximum) { metrics[i].maximum = maximum; }
+            }
+        }
+        return metrics;
+    }
+
+private:
+    Registry() = default;
+
+    /** Mutex protecting registration and snapshots. */
+    std::mutex myMutex;
+
+    /** Registered metrics. */
+    std::array<Snapshot, kMaxMetricCount> myMetrics{};
+
+    /** The number of registered metrics. */
+    std::size_t myMetricCount{};
+
+    /** Values of all threads which recorded metrics. */
+    std::vector<std::unique_ptr<ThreadValues>> myThreadValues;
+};
+
+// ---------------------------------------------------------------------------
+void increase(std::atomic<std::uint64_t> &value, const std::uint64_t amount) noexcept
+{
+    // Only the owning thread writes, so no read-modify-write instruction is needed.
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+// ---------------------------------------------------------------------------
+double seconds(const std::uint64_t nanoseconds) noexcept
+{
+    return static_cast<double>(nanoseconds) / kNanosecondsPerSecond;
+}
+
+// ---------------------------------------------------------------------------
+bool writeFile(const std::string &filePath, const std::string &content)
+{
+    // Write next to the destination and rename, which replaces the file atomically.
+    const auto tempPath{filePath + ".tmp"};
+    {
+        std::ofstream ostream{tempPath, std::ios::binary};
+        if (!(ostream << content)) { return false; }
+    }
+    return 0 == std::rename(tempPath.c_str(), filePath.c_str());
+}
+
+// ---------------------------------------------------------------------------
+std::string &exportPath()
+{
+    static std::string path{};
+    return path;
+}
+
+// ---------------------------------------------------------------------------
+void dumpToExportPath() { dump(exportPath()); }
+} // namespace
+
+// ---------------------------------------------------------------------------
+Metric::Metric(const char *name, const MetricType type, const char *help) noexcept
+    : myName{name}
+    , myIndex{Registry::instance().add(name, type, help)}
+{}
+
+// ---------------------------------------------------------------------------
+void add(const Metric &metric, const std::uint64_t value) noexcept
+{
+    const auto i{metric.index()};
+    if (kMaxMetricCount <= i) { return; }
+    auto &values{Registry::instance().threadValues()};
+
+    increase(values.totals[i], value);
+    increase(values.counts[i], 1U);
+    if (values.maxima[i].load(std::memory_order_relaxed) < value)
+    {
+        values.maxima[i].store(value, std::memory_order_relaxed);
+    }
+}
+
+// ---------------------------------------------------------------------------
+std::string toJson()
+{
+    std::ostringstream timers{}, counters{};
+    timers.precision(9);
+
+    for (const auto &metric : Registry::instance().snapshot())
+    {
+        if (MetricType::Timer == metric.type)
+        {
+            timers << (timers.tellp() ? ",\n" : "") << "    \"" << metric.name << "\": {\"count\": "
+                   << metric.count << ", \"total_seconds\": " << seconds(metric.total)
+                   << ", \"max_seconds\": " << seconds(metric.maximum) << "}";
+        }
+        else { counters << (counters.tellp() ? ",\n" : "") << "    \"" << metric.name << "\": " << metric.total; }
+    }
+    return "{\n  \"timers\": {\n" + timers.str() + "\n  },\n  \"counters\": {\n" + counters.str() + "\n  }\n}\n";
+}
+
+// ---------------------------------------------------------------------------
+std::string toPrometheus()
+{
+    std::ostringstream text{};
+    text.precision(9);
+
+    for (const auto &metric : Registry::instance().snapshot())
+    {
+        const std::string name{std::string{"language_"} + metric.name};
+        if (MetricType::Timer == metric.type)
+        {
+            text << "# HELP " << name << "_seconds " << metric.help << "\n"
+                 << "# TYPE " << name << "_seconds summary\n"
+                 << name << "_seconds_sum " << seconds(metric.total) << "\n"
+                 << name << "_seconds_count " << metric.count << "\n"
+                 << "# HELP " << name << "_seconds_max " << metric.help << " (longest)\n"
+                 << "# TYPE " << name << "_seconds_max gauge\n"
+                 << name << "_seconds_max " << seconds(metric.maximum) << "\n";
+        }
+        else
+        {
+            text << "# HELP " << name << "_total " << metric.help << "\n"
+                 << "# TYPE " << name << "_total counter\n"
+                 << name << "_total " << metric.total << "\n";
+        }
+    }
+    return text.str();
+}
+
+// ---------------------------------------------------------------------------
+bool dump(const std::string &basePath)
+{
+    // Dumps at exit and on a signal may overlap, they share the temporary files.
+    static std::mutex mutex{};
+    std::lock_guard<std::mutex> lock{mutex};
+    const auto jsonWritten{writeFile(basePath + ".json", toJson())};
+    return writeFile(basePath + ".prom", toPrometheus()) && jsonWritten;
+}
+
+// ---------------------------------------------------------------------------
+void dumpAtExit(const std::string &basePath)
+{
+    static std::once_flag flag{};
+    std::call_once(flag, [&basePath]()
+    {
+        // Create the registry first, so that it's only destroyed after the dump at exit.
+        Registry::instance();
+        exportPath() = basePath.empty() ? "metrics" : basePath;
+        std::atexit(dumpToExportPath);
+
+        sigset_t signals{};
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGUSR1);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+        std::thread{[signals]()
+        {
+            int signal{};
+            while (0 == sigwait(&signals, &signal)) { dumpToExportPath(); }
+        }}.detach();
+    });
+}
+} // namespace metrics
+} // namespace utils
+} // namespace language
@@ -0,0 +1,90 @@
+/**
+ * @brief Implementation details of class language::utils::Output.
+ */
+#include <charconv>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "utils/output.h"
+
+namespace language
+{
+namespace utils
+{
+// ---------------------------------------------------------------------------
+Output::Output(std::ostream& ostream, const std::size_t capacity)
+    : myOstream{ostream}
+    , myBuffer{}
+    , myCapacity{capacity}
+{
+    myBuffer.reserve(capacity);
+}
+
+// ---------------------------------------------------------------------------
+Output::~Output() noexcept
+{
+    try { flush(); }
+    catch (...) {}
+}
+
+// ---------------------------------------------------------------------------
+Output& Output::operator<<(const std::string_view str)
+{
+    myBuffer.append(str.data(), str.size());
+    flushIfFull();
+    return *this;
+}
+
+// ---------------------------------------------------------------------------
+Output& Output::operator<<(const char* str)
+{
+    return str ? *this << std::string_view{str} : *this;
+}
+
+// ---------------------------------------------------------------------------
+Output& Output::operator<<(const std::string& str) { return *this << std::string_view{str}; }
+
+// ---------------------------------------------------------------------------
+Output& Output::operator<<(const char c)
+{
+    myBuffer.push_back(c);
+    flushIfFull();
+    return *this;
+}
+
+// ---------------------------------------------------------------------------
+Output& Output::fixed(const double number, const int precision)
+{
+    char digits[64U]{};
+    const auto length{std::snprintf(digits, sizeof(digits), "%.*f", precision, number)};
+    if (0 < length) { *this << std::string_view{digits, static_cast<std::size_t>(length)}; }
+    return *this;
+}
+
+// ---------------------------------------------------------------------------
+void Output::flush()
+{
+    if (myBuffer.empty()) { return; }
+    myOstream.write(myBuffer.data(), static_cast<std::streamsize>(myBuffer.size()));
+    myOstream.flush();
+    myBuffer.clear();
+}
+
+// ---------------------------------------------------------------------------
+void Output::clear() noexcept { myBuffer.clear(); }
+
+// ---------------------------------------------------------------------------
+std::size_t Output::size() const noexcept { return myBuffer.size(); }
+
+// ---------------------------------------------------------------------------
+bool Output::empty() const noexcept { return myBuffer.empty(); }
+
+// ---------------------------------------------------------------------------
+void Output::flushIfFull()
+{
+    if (myBuffer.size() >= myCapacity) { flush(); }
+}
+} // namespace utils
+} // namespace language
@@ -0,0 +1,117 @@
+/**
+ * @brief Implementation details of class language::utils::PhraseReader.
+ */
+#include <cstdio>
+#include <string>
+
+#include "utils/phrase_reader.h"
+#include "utils/scan.h"
+#include "utils/utf8.h"
+#include "utils/utils.h"
+
+namespace language
+{
+namespace utils
+{
+namespace
+{
+// ---------------------------------------------------------------------------
+bool lineEmpty(const std::string& line) noexcept
+{
+    return isBlank(line.data(), line.data() + line.size());
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+PhraseReader::PhraseReader(const std::string& filePath, const std::size_t bufferSize, 
+                           const Utf8Policy utf8Policy)
+    : myFile{std::fopen(filePath.c_str(), "rb"), &std::fclose}
+    , myBuffer(0U < bufferSize ? bufferSize : kDefaultBufferSize)
+    , myPosition{}
+    , mySize{}
+    , myPhraseCount{}
+    , myUtf8Policy{utf8Policy}
+    , myInvalidLines{}
+    , myLineNumber{}
+    , myRejected{false}
+{
+    // Skip the byte order mark.
+    if (fillBuffer()) { myPosition = byteOrderMarkSize(myBuffer.data(), myBuffer.data() + mySize); }
+}
+
+// ---------------------------------------------------------------------------
+bool PhraseReader::isOpen() const noexcept { return nullptr != myFile; }
+
+// ---------------------------------------------------------------------------
+bool PhraseReader::next(Phrase& phrase)
+{
+    // Read the next two non-empty lines as a pair.
+    if (!nextLine(phrase.primary) || !nextLine(phrase.target)) { return false; }
+    ++myPhraseCount;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t PhraseReader::phraseCount() const noexcept { return myPhraseCount; }
+
+// ---------------------------------------------------------------------------
+const std::vector<std::size_t>& PhraseReader::invalidLines() const noexcept { return myInvalidLines; }
+
+// ---------------------------------------------------------------------------
+bool PhraseReader::nextLine(std::string& line)
+{
+    line.clear();
+    bool lineFound{false};
+
+    while (!myRejected && (mySize > myPosition || fillBuffer()))
+    {
+        // Append bytes up to the next newline, the line may span several buffers.
+        const char* start{myBuffer.data() + myPosition};
+        const auto last{myBuffer.data() + mySize};
+        const auto end{findFirstOf(start, last, "\n")};
+        line.append(start, end);
+        myPosition += static_cast<std::size_t>(end - start);
+        lineFound = true;
+        if (last == end) { continue; }
+        ++myPosition;
+
+        // Return non-empty lines, skip empty ones.
+        if (completeLine(line)) { return true; }
+        line.clear();
+        lineFound = false;
+    }
+    // Handle the last line if the file doesn't end with a newline.
+    return lineFound && completeLine(line);
+}
+
+// ---------------------------------------------------------------------------
+bool PhraseReader::completeLine(std::string& line)
+{
+    // Handle invalid UTF-8, stop reading at the first invalid line if the file is rejected.
+    ++myLineNumber;
+    if (!isValidUtf8(line.data(), line.data() + line.size()))
+    {
+        myInvalidLines.push_back(myLineNumber);
+        if (Utf8Policy::Reject == myUtf8Policy) 
+        { 
+            myRejected = true;
+            return false;
+        }
+        if (Utf8Policy::Repair == myUtf8Policy) { repairUtf8(line); }
+    }
+
+    // Return true if the line isn't empty after removing trailing whitespaces.
+    removeTrailingWhitespaces(line);
+    return !lineEmpty(line);
+}
+
+// ---------------------------------------------------------------------------
+bool PhraseReader::fillBuffer()
+{
+    if (!myFile) { return false; }
+    myPosition = 0U;
+    mySize     = std::fread(myBuffer.data(), 1U, myBuffer.size(), myFile.get());
+    return 0U < mySize;
+}
+} // namespace utils
+} // namespace language
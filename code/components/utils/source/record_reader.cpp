@@ -0,0 +1,363 @@
+/**
+ * @brief Implementation details of class language::utils::RecordReader.
+ */
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/record_reader.h"
+#include "utils/scan.h"
+#include "utils/utf8.h"
+#include "utils/utils.h"
+
+namespace language
+{
+namespace utils
+{
+namespace
+{
+std::string& nextField(std::vector<std::string>& fields, std::size_t& fieldCount);
+const char* skipWhitespaces(const char* first, const char* last) noexcept;
+const char* parseJsonString(const char* first, const char* last, std::string* value);
+void appendUtf8(std::string& str, std::uint32_t codePoint);
+} // namespace
+
+// ---------------------------------------------------------------------------
+RecordFormat recordFormat(const std::string& filePath)
+{
+    const auto dot{filePath.rfind('.')};
+    if (std::string::npos == dot) { return RecordFormat::Lines; }
+    auto extension{filePath.substr(dot + 1U)};
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    if (("tsv" == extension) || ("tab" == extension)) { return RecordFormat::Tsv; }
+    if ("csv" == extension) { return RecordFormat::Csv; }
+    if (("jsonl" == extension) || ("ndjson" == extension)) { return RecordFormat::JsonLines; }
+    return RecordFormat::Lines;
+}
+
+// ---------------------------------------------------------------------------
+RecordReader::RecordReader(const std::string& filePath, const RecordFormat format,
+                           const std::size_t bufferSize, const Utf8Policy utf8Policy)
+    : myFile{std::fopen(filePath.c_str(), "rb"), &std::fclose}
+    , myFormat{format}
+    , myBuffer(0U < bufferSize ? bufferSize : kDefaultBufferSize)
+    , myPosition{}
+    , mySize{}
+    , myEndOfFile{false}
+    , myRecordCount{}
+    , myUtf8Policy{utf8Policy}
+    , myInvalidRecords{}
+    , myRejected{false}
+{
+    // Skip the byte order mark.
+    if (myFile && fillBuffer()) { myPosition = byteOrderMarkSize(myBuffer.data(), myBuffer.data() + mySize); }
+}
+
+// ---------------------------------------------------------------------------
+bool RecordReader::isOpen() const noexcept { return nullptr != myFile; }
+
+// ---------------------------------------------------------------------------
+bool RecordReader::next(std::vector<std::string>& fields)
+{
+    while (true)
+    {
+        if (myRejected) { return false; }
+        if (mySize == myPosition)
+        {
+            if (myEndOfFile || !myFile) { return false; }
+            fillBuffer();
+            continue;
+        }
+
+        // Parse the next record, read more data if the record continues past the buffer.
+        std::size_t fieldCount{};
+        const auto first{myBuffer.data() + myPosition};
+        const auto end{parseRecord(first, myBuffer.data() + mySize, fields, fieldCount)};
+        if (end)
+        {
+            myPosition += static_cast<std::size_t>(end - first);
+            if (!checkUtf8(first, end, fields, fieldCount)) { return false; }
+            fields.resize(fieldCount);
+            ++myRecordCount;
+            return true;
+        }
+        fillBuffer();
+    }
+}
+
+// ---------------------------------------------------------------------------
+std::size_t RecordReader::recordCount() const noexcept { return myRecordCount; }
+
+// ---------------------------------------------------------------------------
+const std::vector<std::size_t>& RecordReader::invalidRecords() const noexcept { return myInvalidRecords; }
+
+// ---------------------------------------------------------------------------
+bool RecordReader::fillBuffer()
+{
+    // Keep the unparsed bytes, grow the buffer if they already fill it.
+    const auto remaining{mySize - myPosition};
+    if (0U < remaining) { std::memmove(myBuffer.data(), myBuffer.data() + myPosition, remaining); }
+    if (myBuffer.size() == remaining) { myBuffer.resize(2U * myBuffer.size()); }
+    myPosition = 0U;
+    mySize     = remaining;
+
+    const auto readSize{std::fread(myBuffer.data() + mySize, 1U, myBuffer.size() - mySize, myFile.get())};
+    mySize += readSize;
+    if (0U == readSize) { myEndOfFile = true; }
+    return 0U < readSize;
+}
+
+// ---------------------------------------------------------------------------
+bool RecordReader::checkUtf8(const char* first, const char* last, std::vector<std::string>& fields, 
+                             const std::size_t fieldCount)
+{
+    // Validate the raw record, only check the fields if it contains invalid UTF-8.
+    if (isValidUtf8(first, last)) { return true; }
+    bool valid{true};
+    for (std::size_t i{}; i < fieldCount; ++i) 
+    { 
+        const auto& field{fields[i]};
+        valid = valid && (field.data() + field.size() == findInvalidUtf8(field.data(), field.data() + field.size()));
+    }
+    if (valid) { return true; }
+
+    // Return false if the file is rejected, repair the fields if requested.
+    myInvalidRecords.push_back(myRecordCount + 1U);
+    if (Utf8Policy::Reject == myUtf8Policy) 
+    { 
+        myRejected = true;
+        return false;
+    }
+    if (Utf8Policy::Repair == myUtf8Policy)
+    {
+        for (std::size_t i{}; i < fieldCount; ++i) { repairUtf8(fields[i]); }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+const char* RecordReader::parseRecord(const char* first, const char* last,
+                                      std::vector<std::string>& fields, std::size_t& fieldCount) const
+{
+    return (RecordFormat::JsonLines == myFormat) ? parseJsonLine(first, last, fields, fieldCount)
+                                                 : parseDelimited(first, last, fields, fieldCount);
+}
+
+// ---------------------------------------------------------------------------
+const char* RecordReader::parseDelimited(const char* first, const char* last,
+                                         std::vector<std::string>& fields, std::size_t& fieldCount) const
+{
+    // Return nullptr if the record may continue after the buffered data.
+    const auto csv{RecordFormat::Csv == myFormat};
+    const std::string_view delimiters{csv ? ",\n" : "\t\n"};
+
+    while (true)
+    {
+        auto& field{nextField(fields, fieldCount)};
+
+        // Append quoted text up to the closing quote, two quotes in a row are one literal quote.
+        if (csv && (last != first) && ('"' == *first))
+        {
+            ++first;
+            while (true)
+            {
+                const auto quote{findFirstOf(first, last, "\"")};
+                field.append(first, quote);
+                if ((last == quote) || ((last == quote + 1) && !myEndOfFile))
+                {
+                    if (!myEndOfFile) { return nullptr; }
+                    first = last;
+                    break;
+                }
+                first = quote + 1;
+                if ((last == first) || ('"' != *first)) { break; }
+                field.push_back('"');
+                ++first;
+            }
+        }
+
+        // Append the remaining text up to the next delimiter.
+        const auto delimiter{findFirstOf(first, last, delimiters)};
+        field.append(first, delimiter);
+        removeTrailingWhitespaces(field);
+
+        if (last == delimiter) { return myEndOfFile ? last : nullptr; }
+        if ('\n' == *delimiter) { return delimiter + 1; }
+        first = delimiter + 1;
+    }
+}
+
+// ---------------------------------------------------------------------------
+const char* RecordReader::parseJsonLine(const char* first, const char* last,
+                                        std::vector<std::string>& fields, std::size_t& fieldCount) const
+{
+    const auto lineEnd{findFirstOf(first, last, "\n")};
+    if ((last == lineEnd) && !myEndOfFile) { return nullptr; }
+    const auto next{(last == lineEnd) ? last : lineEnd + 1};
+
+    // Lines that aren't arrays or objects of values don't have any fields.
+    auto invalid = [&fieldCount, next]()
+    {
+        fieldCount = 0U;
+        return next;
+    };
+    auto p{skipWhitespaces(first, lineEnd)};
+    if ((lineEnd == p) || (('[' != *p) && ('{' != *p))) { return invalid(); }
+    const auto object{'{' == *p};
+    const auto close{object ? '}' : ']'};
+    p = skipWhitespaces(p + 1, lineEnd);
+    if ((lineEnd != p) && (close == *p)) { return next; }
+
+    while (lineEnd != p)
+    {
+        // Skip the key of each object member.
+        if (object)
+        {
+            if ('"' != *p) { return invalid(); }
+            p = parseJsonString(p, lineEnd, nullptr);
+            if (!p) { return invalid(); }
+            p = skipWhitespaces(p, lineEnd);
+            if ((lineEnd == p) || (':' != *p)) { return invalid(); }
+            p = skipWhitespaces(p + 1, lineEnd);
+            if (lineEnd == p) { return invalid(); }
+        }
+
+        // Decode strings, keep all other values as written, but don't accept nested values.
+        auto& field{nextField(fields, fieldCount)};
+        if ('"' == *p)
+        {
+            p = parseJsonString(p, lineEnd, &field);
+            if (!p) { return invalid(); }
+        }
+        else if (('[' == *p) || ('{' == *p)) { return invalid(); }
+        else
+        {
+            const char delimiters[]{',', close, '\0'};
+            const auto end{findFirstOf(p, lineEnd, delimiters)};
+            field.assign(p, end);
+            p = end;
+        }
+        removeTrailingWhitespaces(field);
+
+        p = skipWhitespaces(p, lineEnd);
+        if (lineEnd == p) { return invalid(); }
+        if (close == *p) { return next; }
+        if (',' != *p) { return invalid(); }
+        p = skipWhitespaces(p + 1, lineEnd);
+    }
+    return invalid();
+}
+
+namespace
+{
+// ---------------------------------------------------------------------------
+std::string& nextField(std::vector<std::string>& fields, std::size_t& fieldCount)
+{
+    if (fields.size() == fieldCount) { fields.emplace_back(); }
+    auto& field{fields[fieldCount++]};
+    field.clear();
+    return field;
+}
+
+// ---------------------------------------------------------------------------
+const char* skipWhitespaces(const char* first, const char* last) noexcept
+{
+    while ((last != first) && std::isspace(static_cast<unsigned char>(*first))) { ++first; }
+    return first;
+}
+
+// ---------------------------------------------------------------------------
+const char* parseJsonString(const char* first, const char* last, std::string* value)
+{
+    // Return pointer past the closing quote, or nullptr if the string is invalid.
+    auto hexDigits = [last](const char* p, std::uint32_t& codeUnit)
+    {
+        if (last - p < 4) { return false; }
+        codeUnit = 0U;
+        for (std::size_t i{}; i < 4U; ++i)
+        {
+            const auto c{static_cast<unsigned char>(p[i])};
+            if (!std::isxdigit(c)) { return false; }
+            codeUnit = (codeUnit << 4U) | static_cast<std::uint32_t>(std::isdigit(c) ? c - '0' : std::tolower(c) - 'a' + 10);
+        }
+        return true;
+    };
+    ++first;
+
+    while (true)
+    {
+        const auto special{findFirstOf(first, last, "\"\\")};
+        if (value) { value->append(first, special); }
+        if (last == special) { return nullptr; }
+        if ('"' == *special) { return special + 1; }
+        if (last == special + 1) { return nullptr; }
+        first = special + 2;
+
+        char c{special[1]};
+        switch (c)
+        {
+            case 'b': c = '\b'; break;
+            case 'f': c = '\f'; break;
+            case 'n': c = '\n'; break;
+            case 'r': c = '\r'; break;
+            case 't': c = '\t'; break;
+            case 'u':
+            {
+                std::uint32_t codePoint{};
+                if (!hexDigits(first, codePoint)) { return nullptr; }
+                first += 4;
+
+                // Combine surrogate pairs into one code point.
+                std::uint32_t low{};
+                if ((0xD800U <= codePoint) && (0xDBFFU >= codePoint) && (last - first >= 6) &&
+                    ('\\' == first[0]) && ('u' == first[1]) && hexDigits(first + 2, low) &&
+                    (0xDC00U <= low) && (0xDFFFU >= low))
+                {
+                    codePoint = 0x10000U + ((codePoint - 0xD800U) << 10U) + (low - 0xDC00U);
+                    first += 6;
+                }
+
+                // Replace unpaired surrogates, they can't be encoded in UTF-8.
+                if ((0xD800U <= codePoint) && (0xDFFFU >= codePoint)) { codePoint = 0xFFFDU; }
+                if (value) { appendUtf8(*value, codePoint); }
+                continue;
+            }
+            default: break;
+        }
+        if (value) { value->push_back(c); }
+    }
+}
+
+// ---------------------------------------------------------------------------
+void appendUtf8(std::string& str, const std::uint32_t codePoint)
+{
+    if (0x80U > codePoint) { str.push_back(static_cast<char>(codePoint)); }
+    else if (0x800U > codePoint)
+    {
+        str.push_back(static_cast<char>(0xC0U | (codePoint >> 6U)));
+        str.push_back(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+    }
+    else if (0x10000U > codePoint)
+    {
+        str.push_back(static_cast<char>(0xE0U | (codePoint >> 12U)));
+        str.push_back(static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU)));
+        str.push_back(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+    }
+    else
+    {
+        str.push_back(static_cast<char>(0xF0U | (codePoint >> 18U)));
+        str.push_back(static_cast<char>(0x80U | ((codePoint >> 12U) & 0x3FU)));
+        str.push_back(static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU)));
+        str.push_back(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+    }
+}
+} // namespace
+} // namespace utils
+} // namespace language
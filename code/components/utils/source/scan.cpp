@@ -0,0 +1,290 @@
+/**
+ * @brief Implementation details of fast character scanning.
+ */
+#include <cstdint>
+#include <string_view>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define LANGUAGE_X86_SIMD 1
+#endif
+
+#include "utils/scan.h"
+
+namespace language
+{
+namespace utils
+{
+namespace
+{
+/**
+ * @brief Scanning functions of one instruction set.
+ */
+struct Kernels
+{
+    /** The instruction set of the functions. */
+    SimdLevel level;
+
+    /** Find the first occurrence of a character. */
+    const char* (*findCharacter)(const char*, const char*, char) noexcept;
+
+    /** Find the first occurrence of any of four characters. */
+    const char* (*findFirstOf)(const char*, const char*, const char*) noexcept;
+
+    /** Find the end of a text without trailing whitespaces. */
+    const char* (*trimTrailingWhitespaces)(const char*, const char*) noexcept;
+
+    /** Find the first byte that isn't a whitespace. */
+    const char* (*findNonWhitespace)(const char*, const char*) noexcept;
+};
+
+// ---------------------------------------------------------------------------
+constexpr bool isWhitespace(const char c) noexcept
+{
+    // Spaces and the control characters from tab (9) to carriage return (13).
+    return (' ' == c) || (4U >= static_cast<unsigned char>(c - '\t'));
+}
+
+// ---------------------------------------------------------------------------
+const char* findCharacterScalar(const char* first, const char* last, const char c) noexcept
+{
+    while ((first != last) && (c != *first)) { ++first; }
+    return first;
+}
+
+// ---------------------------------------------------------------------------
+const char* findFirstOfScalar(const char* first, const char* last, const char* c) noexcept
+{
+    for (; first != last; ++first)
+    {
+        if ((c[0U] == *first) || (c[1U] == *first) || (c[2U] == *first) || (c[3U] == *first))
+        {
+            return first;
+        }
+    }
+    return last;
+}
+
+// ---------------------------------------------------------------------------
+const char* trimTrailingWhitespacesScalar(const char* first, const char* last) noexcept
+{
+    while ((first != last) && isWhitespace(last[-1])) { --last; }
+    return last;
+}
+
+// ---------------------------------------------------------------------------
+const char* findNonWhitespaceScalar(const char* first, const char* last) noexcept
+{
+    while ((first != last) && isWhitespace(*first)) { ++first; }
+    return first;
+}
+
+#if defined(LANGUAGE_X86_SIMD)
+// ---------------------------------------------------------------------------
+__attribute__((target("sse2")))
+inline std::uint32_t whitespaceMask(const __m128i block) noexcept
+{
+    // Bytes from tab to carriage return are at most 4 after subtracting the tab.
+    const auto control{_mm_sub_epi8(block, _mm_set1_epi8('\t'))};
+    const auto isControl{_mm_cmpeq_epi8(_mm_min_epu8(control, _mm_set1_epi8(4)), control)};
+    const auto isSpace{_mm_cmpeq_epi8(block, _mm_set1_epi8(' '))};
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(isControl, isSpace)));
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("sse2")))
+const char* findCharacterSse2(const char* first, const char* last, const char c) noexcept
+{
+    const auto c0{_mm_set1_epi8(c)};
+
+    for (; 16 <= last - first; first += 16)
+    {
+        const auto block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(first))};
+        const auto mask{static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, c0)))};
+        if (0U != mask) { return first + __builtin_ctz(mask); }
+    }
+    return findCharacterScalar(first, last, c);
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("sse2")))
+const char* findFirstOfSse2(const char* first, const char* last, const char* c) noexcept
+{
+    const auto c0{_mm_set1_epi8(c[0U])}, c1{_mm_set1_epi8(c[1U])};
+    const auto c2{_mm_set1_epi8(c[2U])}, c3{_mm_set1_epi8(c[3U])};
+
+    for (; 16 <= last - first; first += 16)
+    {
+        const auto block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(first))};
+        const auto matches{_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(block, c0), _mm_cmpeq_epi8(block, c1)),
+            _mm_or_si128(_mm_cmpeq_epi8(block, c2), _mm_cmpeq_epi8(block, c3)))};
+        const auto mask{static_cast<std::uint32_t>(_mm_movemask_epi8(matches))};
+        if (0U != mask) { return first + __builtin_ctz(mask); }
+    }
+    return findFirstOfScalar(first, last, c);
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("sse2")))
+const char* trimTrailingWhitespacesSse2(const char* first, const char* last) noexcept
+{
+    for (; 16 <= last - first; last -= 16)
+    {
+        const auto block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(last - 16))};
+        const auto mask{~whitespaceMask(block) & 0xFFFFU};
+        if (0U != mask) { return last - 16 + (32 - __builtin_clz(mask)); }
+    }
+    return trimTrailingWhitespacesScalar(first, last);
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("sse2")))
+const char* findNonWhitespaceSse2(const char* first, const char* last) noexcept
+{
+    for (; 16 <= last - first; first += 16)
+    {
+        const auto block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(first))};
+        const auto mask{~whitespaceMask(block) & 0xFFFFU};
+        if (0U != mask) { return first + __builtin_ctz(mask); }
+    }
+    return findNonWhitespaceScalar(first, last);
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("avx2")))
+inline std::uint32_t whitespaceMask(const __m256i block) noexcept
+{
+    const auto control{_mm256_sub_epi8(block, _mm256_set1_epi8('\t'))};
+    const auto isControl{_mm256_cmpeq_epi8(_mm256_min_epu8(control, _mm256_set1_epi8(4)), control)};
+    const auto isSpace{_mm256_cmpeq_epi8(block, _mm256_set1_epi8(' '))};
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(isControl, isSpace)));
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("avx2")))
+const char* findCharacterAvx2(const char* first, const char* last, const char c) noexcept
+{
+    const auto c0{_mm256_set1_epi8(c)};
+
+    for (; 32 <= last - first; first += 32)
+    {
+        const auto block{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first))};
+        const auto mask{static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, c0)))};
+        if (0U != mask) { return first + __builtin_ctz(mask); }
+    }
+    return findCharacterSse2(first, last, c);
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("avx2")))
+const char* findFirstOfAvx2(const char* first, const char* last, const char* c) noexcept
+{
+    const auto c0{_mm256_set1_epi8(c[0U])}, c1{_mm256_set1_epi8(c[1U])};
+    const auto c2{_mm256_set1_epi8(c[2U])}, c3{_mm256_set1_epi8(c[3U])};
+
+    for (; 32 <= last - first; first += 32)
+    {
+        const auto block{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first))};
+        const auto matches{_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(block, c0), _mm256_cmpeq_epi8(block, c1)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(block, c2), _mm256_cmpeq_epi8(block, c3)))};
+        const auto mask{static_cast<std::uint32_t>(_mm256_movemask_epi8(matches))};
+        if (0U != mask) { return first + __builtin_ctz(mask); }
+    }
+    return findFirstOfSse2(first, last, c);
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("avx2")))
+const char* trimTrailingWhitespacesAvx2(const char* first, const char* last) noexcept
+{
+    for (; 32 <= last - first; last -= 32)
+    {
+        const auto block{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(last - 32))};
+        const auto mask{~whitespaceMask(block)};
+        if (0U != mask) { return last - 32 + (32 - __builtin_clz(mask)); }
+    }
+    return trimTrailingWhitespacesSse2(first, last);
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("avx2")))
+const char* findNonWhitespaceAvx2(const char* first, const char* last) noexcept
+{
+    for (; 32 <= last - first; first += 32)
+    {
+        const auto block{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first))};
+        const auto mask{~whitespaceMask(block)};
+        if (0U != mask) { return first + __builtin_ctz(mask); }
+    }
+    return findNonWhitespaceSse2(first, last);
+}
+#endif
+
+/** Scanning functions of each instruction set. */
+constexpr Kernels kScalarKernels{SimdLevel::Scalar, &findCharacterScalar, &findFirstOfScalar,
+                                 &trimTrailingWhitespacesScalar, &findNonWhitespaceScalar};
+#if defined(LANGUAGE_X86_SIMD)
+constexpr Kernels kSse2Kernels{SimdLevel::Sse2, &findCharacterSse2, &findFirstOfSse2,
+                               &trimTrailingWhitespacesSse2, &findNonWhitespaceSse2};
+constexpr Kernels kAvx2Kernels{SimdLevel::Avx2, &findCharacterAvx2, &findFirstOfAvx2,
+                               &trimTrailingWhitespacesAvx2, &findNonWhitespaceAvx2};
+#endif
+
+// ---------------------------------------------------------------------------
+const Kernels* supportedKernels(const SimdLevel level) noexcept
+{
+#if defined(LANGUAGE_X86_SIMD)
+    __builtin_cpu_init();
+    if ((SimdLevel::Avx2 == level) && __builtin_cpu_supports("avx2")) { return &kAvx2Kernels; }
+    if ((SimdLevel::Scalar != level) && __builtin_cpu_supports("sse2")) { return &kSse2Kernels; }
+#endif
+    static_cast<void>(level);
+    return &kScalarKernels;
+}
+
+// ---------------------------------------------------------------------------
+const Kernels*& kernels() noexcept
+{
+    // Select the best supported instruction set on first use.
+    static const Kernels* kernels{supportedKernels(SimdLevel::Avx2)};
+    return kernels;
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+SimdLevel simdLevel() noexcept { return kernels()->level; }
+
+// ---------------------------------------------------------------------------
+SimdLevel setSimdLevel(const SimdLevel level) noexcept
+{
+    kernels() = supportedKernels(level);
+    return simdLevel();
+}
+
+// ---------------------------------------------------------------------------
+const char* findFirstOf(const char* first, const char* last, const std::string_view characters) noexcept
+{
+    if (characters.empty()) { return last; }
+    if (1U == characters.size()) { return kernels()->findCharacter(first, last, characters.front()); }
+
+    // Repeat the last character if less than four characters are searched for.
+    char c[4U]{};
+    for (std::size_t i{}; i < 4U; ++i) { c[i] = characters[i < characters.size() ? i : characters.size() - 1U]; }
+    return kernels()->findFirstOf(first, last, c);
+}
+
+// ---------------------------------------------------------------------------
+const char* trimTrailingWhitespaces(const char* first, const char* last) noexcept
+{
+    return kernels()->trimTrailingWhitespaces(first, last);
+}
+
+// ---------------------------------------------------------------------------
+bool isBlank(const char* first, const char* last) noexcept
+{
+    return last == kernels()->findNonWhitespace(first, last);
+}
+} // namespace utils
+} // namespace language
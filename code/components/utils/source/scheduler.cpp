@@ -0,0 +1,85 @@
+/**
+ * @brief Implementation details of class language::utils::Scheduler.
+ */
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "utils/scheduler.h"
+
+namespace language
+{
+namespace utils
+{
+// ---------------------------------------------------------------------------
+Scheduler::Scheduler(const std::chrono::milliseconds interval, Task task)
+    : myInterval{interval}
+    , myTask{std::move(task)}
+    , myThread{}
+    , myMutex{}
+    , myCondition{}
+    , myStopRequested{false}
+    , myRunning{false}
+{}
+
+// ---------------------------------------------------------------------------
+Scheduler::~Scheduler() noexcept
+{
+    stop();
+}
+
+// ---------------------------------------------------------------------------
+void Scheduler::start()
+{
+    std::lock_guard<std::mutex> lock{myMutex};
+    if (myRunning || myThread.joinable()) { return; }
+    myStopRequested = false;
+    myRunning       = true;
+    myThread        = std::thread{&Scheduler::run, this};
+}
+
+// ---------------------------------------------------------------------------
+void Scheduler::wait()
+{
+    if (myThread.joinable()) { myThread.join(); }
+}
+
+// ---------------------------------------------------------------------------
+void Scheduler::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        myStopRequested = true;
+    }
+    myCondition.notify_all();
+    wait();
+}
+
+// ---------------------------------------------------------------------------
+bool Scheduler::running() const noexcept
+{
+    std::lock_guard<std::mutex> lock{myMutex};
+    return myRunning;
+}
+
+// ---------------------------------------------------------------------------
+void Scheduler::run()
+{
+    auto deadline{std::chrono::steady_clock::now()};
+
+    while (myTask())
+    {
+        // Schedule the next execution relative to the previous deadline to avoid drift.
+        deadline += myInterval;
+        const auto now{std::chrono::steady_clock::now()};
+        if (now > deadline + myInterval) { deadline = now; }
+
+        std::unique_lock<std::mutex> lock{myMutex};
+        if (myCondition.wait_until(lock, deadline, [this] { return myStopRequested; })) { break; }
+    }
+    std::lock_guard<std::mutex> lock{myMutex};
+    myRunning = false;
+}
+} // namespace utils
+} // namespace language
@@ -0,0 +1,202 @@
+/**
+ * @brief Implementation details of the trace timeline of language game.
+ */
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "utils/trace.h"
+
+namespace language
+{
+namespace utils
+{
+namespace trace
+{
+namespace detail
+{
+std::atomic<bool> enabled{false};
+} // namespace detail
+
+namespace
+{
+/** The number of spans per chunk of a ring buffer. */
+constexpr std::size_t kChunkSize{1024U};
+
+/** The number of chunks per ring buffer. */
+constexpr std::size_t kChunkCount{kSpansPerThread / kChunkSize};
+
+/**
+ * @brief Span recorded by a thread.
+ */
+struct Span
+{
+    /** Name of the span. */
+    const char *name;
+
+    /** Start time in nanoseconds since tracing was started. */
+    std::int64_t start;
+
+    /** Duration in nanoseconds. */
+    std::int64_t duration;
+};
+
+/** Chunk of spans. */
+using Chunk = std::array<Span, kChunkSize>;
+
+/**
+ * @brief Ring buffer of the spans recorded by one thread.
+ *
+ *        Only the owning thread writes spans, the number of written spans is published with
+ *        release semantics so that the spans are visible once it's read. Chunks are allocated
+ *        when first written, so that short-lived threads only take a few kilobytes.
+ */
+struct Ring
+{
+    /** Chunks of recorded spans, the oldest spans are overwritten when full. */
+    std::array<std::unique_ptr<Chunk>, kChunkCount> chunks{};
+
+    /** The number of spans recorded so far. */
+    std::atomic<std::uint64_t> count{};
+
+    /** Thread ID shown in the timeline. */
+    std::size_t threadId{};
+
+    /** Name of the thread, nullptr if not named. */
+    std::atomic<const char *> threadName{nullptr};
+};
+
+/**
+ * @brief Ring buffers of all threads and the trace settings.
+ */
+struct Tracer
+{
+    /** Mutex protecting the ring buffers. */
+    std::mutex mutex;
+
+    /** Ring buffers of all threads which recorded spans. */
+    std::vector<std::unique_ptr<Ring>> rings;
+
+    /** Start time of the trace. */
+    std::chrono::steady_clock::time_point epoch;
+
+    /** Path to write the trace to at exit. */
+    std::string filePath;
+};
+
+// ---------------------------------------------------------------------------
+Tracer &tracer()
+{
+    static Tracer tracer{};
+    return tracer;
+}
+
+// ---------------------------------------------------------------------------
+Ring &threadRing()
+{
+    thread_local Ring *ring{nullptr};
+    if (!ring)
+    {
+        auto &instance{tracer()};
+        std::lock_guard<std::mutex> lock{instance.mutex};
+        instance.rings.push_back(std::make_unique<Ring>());
+        ring = instance.rings.back().get();
+        ring->threadId = instance.rings.size();
+    }
+    return *ring;
+}
+
+// ---------------------------------------------------------------------------
+void writeAtExitHandler() { write(tracer().filePath); }
+} // namespace
+
+// ---------------------------------------------------------------------------
+void record(const char *name, const std::chrono::steady_clock::time_point start,
+            const std::chrono::steady_clock::time_point end) noexcept
+{
+    if (!enabled()) { return; }
+    auto &ring{threadRing()};
+    const auto count{ring.count.load(std::memory_order_relaxed)};
+    const auto epoch{tracer().epoch};
+
+    auto &chunk{ring.chunks[count % kSpansPerThread / kChunkSize]};
+    if (!chunk) { chunk.reset(new (std::nothrow) Chunk{}); }
+    if (!chunk) { return; }
+    (*chunk)[count % kChunkSize] = Span{name,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(start - epoch).count(),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()};
+    ring.count.store(count + 1U, std::memory_order_release);
+}
+
+// ---------------------------------------------------------------------------
+void setThreadName(const char *name) noexcept
+{
+    if (enabled()) { threadRing().threadName.store(name, std::memory_order_relaxed); }
+}
+
+// ---------------------------------------------------------------------------
+bool write(const std::string &filePath)
+{
+    std::ofstream ostream{filePath};
+    if (!ostream) { return false; }
+
+    // Times are written in microseconds, with nanosecond precision.
+    auto &instance{tracer()};
+    std::lock_guard<std::mutex> lock{instance.mutex};
+    const auto pid{static_cast<long>(getpid())};
+    const char *separator{"\n"};
+    ostream << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    ostream.setf(std::ios::fixed);
+    ostream.precision(3);
+
+    for (const auto &ring : instance.rings)
+    {
+        const auto *threadName{ring->threadName.load(std::memory_order_relaxed)};
+        ostream << separator << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid
+                << ", \"tid\": " << ring->threadId << ", \"args\": {\"name\": \"";
+        if (threadName) { ostream << threadName; }
+        else { ostream << "thread " << ring->threadId; }
+        ostream << "\"}}";
+        separator = ",\n";
+
+        const auto count{ring->count.load(std::memory_order_acquire)};
+        for (auto i{(kSpansPerThread < count) ? count - kSpansPerThread : 0U}; i < count; ++i)
+        {
+            const auto &span{(*ring->chunks[i % kSpansPerThread / kChunkSize])[i % kChunkSize]};
+            ostream << ",\n{\"name\": \"" << span.name << "\", \"cat\": \"language\", \"ph\": \"X\", \"ts\": "
+                    << static_cast<double>(span.start) / 1000.0 << ", \"dur\": "
+                    << static_cast<double>(span.duration) / 1000.0 << ", \"pid\": " << pid
+                    << ", \"tid\": " << ring->threadId << "}";
+        }
+    }
+    ostream << "\n]}\n";
+    return static_cast<bool>(ostream);
+}
+
+// ---------------------------------------------------------------------------
+void writeAtExit(const std::string &filePath)
+{
+    static std::once_flag flag{};
+    std::call_once(flag, [&filePath]()
+    {
+        auto &instance{tracer()};
+        instance.filePath = filePath.empty() ? "trace.json" : filePath;
+        instance.epoch    = std::chrono::steady_clock::now();
+        detail::enabled.store(true, std::memory_order_relaxed);
+        setThreadName("main");
+        std::atexit(writeAtExitHandler);
+    });
+}
+} // namespace trace
+} // namespace utils
+} // namespace language
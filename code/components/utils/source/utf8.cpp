@@ -0,0 +1,289 @@
+/**
+ * @brief Implementation details of UTF-8 validation and repair.
+ */
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define LANGUAGE_X86_SIMD 1
+#endif
+
+#include "utils/scan.h"
+#include "utils/utf8.h"
+
+namespace language
+{
+namespace utils
+{
+namespace
+{
+/** The replacement character U+FFFD. */
+constexpr char kReplacementCharacter[]{"\xEF\xBF\xBD"};
+
+// ---------------------------------------------------------------------------
+constexpr bool isContinuation(const unsigned char c) noexcept { return 0x80U == (c & 0xC0U); }
+
+// ---------------------------------------------------------------------------
+const char* nextSequence(const char* first, const char* last) noexcept
+{
+    // Return pointer past the sequence starting at first, or nullptr if the sequence is invalid.
+    const auto lead{static_cast<unsigned char>(*first)};
+    std::ptrdiff_t size{};
+    std::uint32_t codePoint{}, minCodePoint{};
+    if (0xC0U == (lead & 0xE0U)) { size = 2; codePoint = lead & 0x1FU; minCodePoint = 0x80U; }
+    else if (0xE0U == (lead & 0xF0U)) { size = 3; codePoint = lead & 0x0FU; minCodePoint = 0x800U; }
+    else if (0xF0U == (lead & 0xF8U)) { size = 4; codePoint = lead & 0x07U; minCodePoint = 0x10000U; }
+    else { return nullptr; }
+    if (last - first < size) { return nullptr; }
+
+    for (std::ptrdiff_t i{1}; i < size; ++i)
+    {
+        const auto c{static_cast<unsigned char>(first[i])};
+        if (!isContinuation(c)) { return nullptr; }
+        codePoint = (codePoint << 6U) | (c & 0x3FU);
+    }
+    const auto surrogate{(0xD800U <= codePoint) && (0xDFFFU >= codePoint)};
+    if ((minCodePoint > codePoint) || (0x10FFFFU < codePoint) || surrogate) { return nullptr; }
+    return first + size;
+}
+
+// ---------------------------------------------------------------------------
+const char* findInvalidUtf8Scalar(const char* first, const char* last) noexcept
+{
+    while (first != last)
+    {
+        if (0x80U > static_cast<unsigned char>(*first)) { ++first; continue; }
+        const auto next{nextSequence(first, last)};
+        if (!next) { return first; }
+        first = next;
+    }
+    return last;
+}
+
+#if defined(LANGUAGE_X86_SIMD)
+// ---------------------------------------------------------------------------
+__attribute__((target("sse2")))
+const char* findInvalidUtf8Sse2(const char* first, const char* last) noexcept
+{
+    // Skip blocks of ASCII, decode the sequences of other blocks one by one.
+    while (16 <= last - first)
+    {
+        const auto block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(first))};
+        if (0 == _mm_movemask_epi8(block)) { first += 16; continue; }
+
+        const auto blockEnd{first + 16};
+        while (first < blockEnd)
+        {
+            if (0x80U > static_cast<unsigned char>(*first)) { ++first; continue; }
+            const auto next{nextSequence(first, last)};
+            if (!next) { return first; }
+            first = next;
+        }
+    }
+    return findInvalidUtf8Scalar(first, last);
+}
+
+/** Error flags of the lookup algorithm, combinations of two bytes that can't occur. */
+constexpr std::uint8_t kTooShort{1U << 0U};      // Lead byte followed by a lead byte or ASCII.
+constexpr std::uint8_t kTooLong{1U << 1U};       // ASCII followed by a continuation byte.
+constexpr std::uint8_t kOverlong3{1U << 2U};     // E0 followed by 80..9F.
+constexpr std::uint8_t kTooLarge{1U << 3U};      // F4 followed by 90..BF, or F5..FF.
+constexpr std::uint8_t kSurrogate{1U << 4U};     // ED followed by A0..BF.
+constexpr std::uint8_t kOverlong2{1U << 5U};     // C0 or C1.
+constexpr std::uint8_t kTooLarge1000{1U << 6U};  // F5..FF followed by 80..8F.
+constexpr std::uint8_t kOverlong4{1U << 6U};     // F0 followed by 80..8F.
+constexpr std::uint8_t kTwoContinuations{1U << 7U};
+constexpr std::uint8_t kCarry{kTooShort | kTooLong | kTwoContinuations};
+
+// ---------------------------------------------------------------------------
+template <int N>
+__attribute__((target("avx2")))
+inline __m256i previousBytes(const __m256i input, const __m256i previous) noexcept
+{
+    // Shift the input right by N bytes, filling in the last bytes of the previous input.
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("avx2")))
+inline __m256i lookup(const std::uint8_t (&table)[16U], const __m256i nibbles) noexcept
+{
+    const auto lane{_mm_loadu_si128(reinterpret_cast<const __m128i*>(table))};
+    return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(lane), nibbles);
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("avx2")))
+inline __m256i checkUtf8Block(const __m256i input, const __m256i previous) noexcept
+{
+    // Lookup tables indexed by the high and low nibble of the previous byte and the high nibble
+    // of the current byte, a combination is invalid if the same flag is set in all three.
+    static constexpr std::uint8_t kByte1High[16U]{
+        kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+        kTwoContinuations, kTwoContinuations, kTwoContinuations, kTwoContinuations,
+        kTooShort | kOverlong2, kTooShort, kTooShort | kOverlong3 | kSurrogate,
+        kTooShort | kTooLarge | kTooLarge1000 | kOverlong4};
+    static constexpr std::uint8_t kByte1Low[16U]{
+        kCarry | kOverlong3 | kOverlong2 | kOverlong4, kCarry | kOverlong2, kCarry, kCarry,
+        kCarry | kTooLarge, kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000 | kSurrogate, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000};
+    static constexpr std::uint8_t kByte2High[16U]{
+        kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+        kTooLong | kOverlong2 | kTwoContinuations | kOverlong3 | kTooLarge1000 | kOverlong4,
+        kTooLong | kOverlong2 | kTwoContinuations | kOverlong3 | kTooLarge,
+        kTooLong | kOverlong2 | kTwoContinuations | kSurrogate | kTooLarge,
+        kTooLong | kOverlong2 | kTwoContinuations | kSurrogate | kTooLarge,
+        kTooShort, kTooShort, kTooShort, kTooShort};
+
+    const auto lowNibbles{_mm256_set1_epi8(0x0F)};
+    const auto previous1{previousBytes<1>(input, previous)};
+    const auto specialCases{_mm256_and_si256(
+        _mm256_and_si256(lookup(kByte1High, _mm256_and_si256(_mm256_srli_epi16(previous1, 4), lowNibbles)),
+                         lookup(kByte1Low, _mm256_and_si256(previous1, lowNibbles))),
+        lookup(kByte2High, _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibbles)))};
+
+    // Two continuation bytes in a row are only valid as third or fourth byte of a sequence.
+    const auto third{_mm256_subs_epu8(previousBytes<2>(input, previous), _mm256_set1_epi8(0xE0 - 0x80))};
+    const auto fourth{_mm256_subs_epu8(previousBytes<3>(input, previous), _mm256_set1_epi8(0xF0 - 0x80))};
+    const auto mustBeContinuation{_mm256_and_si256(_mm256_or_si256(third, fourth),
+                                                   _mm256_set1_epi8(static_cast<char>(0x80)))};
+    return _mm256_xor_si256(mustBeContinuation, specialCases);
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("avx2")))
+inline __m256i incompleteSequence(const __m256i input) noexcept
+{
+    // Non-zero if one of the last three bytes starts a sequence that doesn't fit in the block.
+    const auto maxValues{_mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(0xF0 - 1),
+        static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1))};
+    return _mm256_subs_epu8(input, maxValues);
+}
+
+/**
+ * @brief State of the lookup algorithm between blocks.
+ */
+struct Utf8State
+{
+    /** Accumulated error flags. */
+    __m256i error;
+
+    /** The previous block. */
+    __m256i previous;
+
+    /** Non-zero if the previous block ends with an incomplete sequence. */
+    __m256i previousIncomplete;
+};
+
+// ---------------------------------------------------------------------------
+__attribute__((target("avx2")))
+inline void checkUtf8(Utf8State& state, const __m256i input) noexcept
+{
+    // Blocks of ASCII are only invalid if the previous block ends with an incomplete sequence.
+    if (0 == _mm256_movemask_epi8(input)) { state.error = _mm256_or_si256(state.error, state.previousIncomplete); }
+    else
+    {
+        state.error              = _mm256_or_si256(state.error, checkUtf8Block(input, state.previous));
+        state.previousIncomplete = incompleteSequence(input);
+    }
+    state.previous = input;
+}
+
+// ---------------------------------------------------------------------------
+__attribute__((target("avx2")))
+bool isValidUtf8Avx2(const char* first, const char* last) noexcept
+{
+    Utf8State state{_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()};
+
+    for (; 32 <= last - first; first += 32)
+    {
+        checkUtf8(state, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)));
+    }
+    if (first != last)
+    {
+        // Pad the remaining bytes with zeros, which are ASCII.
+        char block[32U]{};
+        std::memcpy(block, first, static_cast<std::size_t>(last - first));
+        checkUtf8(state, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block)));
+    }
+    const auto error{_mm256_or_si256(state.error, state.previousIncomplete)};
+    return 0 != _mm256_testz_si256(error, error);
+}
+#endif
+} // namespace
+
+// ---------------------------------------------------------------------------
+bool parseUtf8Policy(const std::string& name, Utf8Policy& policy) noexcept
+{
+    if ("report" == name) { policy = Utf8Policy::Report; }
+    else if ("reject" == name) { policy = Utf8Policy::Reject; }
+    else if ("repair" == name) { policy = Utf8Policy::Repair; }
+    else { return false; }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+std::size_t byteOrderMarkSize(const char* first, const char* last) noexcept
+{
+    return ((3 <= last - first) && (0 == std::memcmp(first, "\xEF\xBB\xBF", 3U))) ? 3U : 0U;
+}
+
+// ---------------------------------------------------------------------------
+bool isValidUtf8(const char* first, const char* last) noexcept
+{
+#if defined(LANGUAGE_X86_SIMD)
+    switch (simdLevel())
+    {
+        case SimdLevel::Avx2: return isValidUtf8Avx2(first, last);
+        case SimdLevel::Sse2: return last == findInvalidUtf8Sse2(first, last);
+        default: break;
+    }
+#endif
+    return last == findInvalidUtf8Scalar(first, last);
+}
+
+// ---------------------------------------------------------------------------
+const char* findInvalidUtf8(const char* first, const char* last) noexcept
+{
+#if defined(LANGUAGE_X86_SIMD)
+    if (SimdLevel::Scalar != simdLevel()) { return findInvalidUtf8Sse2(first, last); }
+#endif
+    return findInvalidUtf8Scalar(first, last);
+}
+
+// ---------------------------------------------------------------------------
+std::size_t repairUtf8(std::string& str)
+{
+    auto invalid{findInvalidUtf8(str.data(), str.data() + str.size())};
+    if (str.data() + str.size() == invalid) { return 0U; }
+
+    // Copy valid sequences, replace each invalid byte and its trailing continuation bytes.
+    std::string repaired{};
+    repaired.reserve(str.size() + 8U);
+    const char* first{str.data()};
+    const char* const last{str.data() + str.size()};
+    std::size_t replacementCount{};
+
+    while (last != invalid)
+    {
+        repaired.append(first, invalid);
+        repaired.append(kReplacementCharacter);
+        ++replacementCount;
+        first = invalid + 1;
+        while ((last != first) && isContinuation(static_cast<unsigned char>(*first))) { ++first; }
+        invalid = findInvalidUtf8(first, last);
+    }
+    repaired.append(first, last);
+    str = std::move(repaired);
+    return replacementCount;
+}
+} // namespace utils
+} // namespace language
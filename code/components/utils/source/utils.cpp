@@ -1,13 +1,19 @@
 /**
  * @brief Implementation details of utility functions.
  */
-#include <algorithm>
-#include <cctype>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <memory>
+#include <string_view>
+#include <unordered_set>
 
+#include "utils/metrics.h"
 #include "utils/phrase.h"
+#include "utils/scan.h"
+#include "utils/utf8.h"
 #include "utils/utils.h"
 
 namespace language
@@ -16,31 +22,45 @@ namespace utils
 {
 namespace
 {
+/** Size of the chunks read from phrase files. */
+constexpr std::size_t kReadBufferSize{1024U * 1024U};
+
+// ---------------------------------------------------------------------------
+bool lineEmpty(const char* first, const char* last) noexcept { return isBlank(first, last); }
+
 // ---------------------------------------------------------------------------
-bool blankLine(const std::string& line) 
+void addLine(std::vector<std::string>& data, const char* first, const char* last)
 {
-    for (const auto& c : line) 
-    {
-        if (' ' != c) { return false; }
-    }
-    return true;
+    // Store each non-empty line without trailing whitespaces.
+    if (!lineEmpty(first, last)) { data.emplace_back(first, trimTrailingWhitespaces(first, last)); }
 }
 
 // ---------------------------------------------------------------------------
-bool lineEmpty(const std::string& line) { return line.empty() || blankLine(line); }
-
+void addInvalidLine(std::vector<std::string>& data, const char* first, const char* last, 
+                    const Utf8Policy utf8Policy)
+{
+    // Store invalid lines as they are or repaired, skip them if the file is rejected anyway.
+    if (Utf8Policy::Report == utf8Policy) { addLine(data, first, last); }
+    else if (Utf8Policy::Repair == utf8Policy)
+    {
+        std::string line{first, last};
+        repairUtf8(line);
+        addLine(data, line.data(), line.data() + line.size());
+    }
+}
 }
 // ---------------------------------------------------------------------------
-void readLine(std::string& str, const char* space)
+bool readLine(std::string& str, const char* space)
 {
     // Read input from the terminal.
-    std::getline(std::cin, str);
+    const bool read{static_cast<bool>(std::getline(std::cin, str))};
 
-    // Add space if specified.
-    if (space) { std::cout << space << std::endl; }
+    // Add space if specified, leave flushing to the next write.
+    if (space) { std::cout << space << '\n'; }
 
     // Clear the input buffer.
     std::cin.clear();
+    return read;
 }
 
 // ---------------------------------------------------------------------------
@@ -52,11 +72,19 @@ bool fileExists(const std::string& filePath)
 
 // ---------------------------------------------------------------------------
 std::size_t loadPhrasesFromFile(const std::string& filePath, std::list<Phrase>& phrases)
+{
+    std::vector<std::size_t> invalidLines{};
+    return loadPhrasesFromFile(filePath, phrases, Utf8Policy::Report, invalidLines);
+}
+
+// ---------------------------------------------------------------------------
+std::size_t loadPhrasesFromFile(const std::string& filePath, std::list<Phrase>& phrases, 
+                                const Utf8Policy utf8Policy, std::vector<std::size_t>& invalidLines)
 {
     std::vector<std::string> data{};
 
     // If data was loaded from the file, store consecutive strings as phrase pairs.
-    if (retrieveFromFile(filePath, data) && !data.empty()) 
+    if (retrieveFromFile(filePath, data, utf8Policy, invalidLines) && !data.empty()) 
     {
         for (std::size_t i{}; i < data.size(); i += 2U) 
         {
@@ -102,24 +130,98 @@ bool writePhrasesToFile(const std::string& filePath, const std::vector<Phrase>&
     return writePhrasesToFile(filePath, phraseList);
 }
 
+// ---------------------------------------------------------------------------
+bool removeDuplicates(std::list<Phrase>& phrases)
+{
+    LANGUAGE_METRICS_TIME("dedupe", "Time spent removing duplicate phrases.");
+    const auto phraseCount{phrases.size()};
+
+    // List nodes are never moved, so the set can refer to the phrases stored in the list.
+    auto hash  = [](const Phrase* phrase) { return PhraseHash{}(*phrase); };
+    auto equal = [](const Phrase* x, const Phrase* y) { return *x == *y; };
+    std::unordered_set<const Phrase*, decltype(hash), decltype(equal)> 
+        uniquePhrases{phrases.size(), hash, equal};
+    bool duplicateFound{false};
+
+    for (auto i{phrases.begin()}; i != phrases.end(); )
+    {
+        // Keep the first occurrence of each phrase, erase all later occurrences.
+        if (uniquePhrases.insert(&*i).second) { ++i; }
+        else
+        {
+            i = phrases.erase(i);
+            duplicateFound = true;
+        }
+    }
+    LANGUAGE_METRICS_COUNT("duplicates_removed", "Duplicate phrases removed.", phraseCount - phrases.size());
+    return duplicateFound;
+}
+
 // ---------------------------------------------------------------------------
 bool retrieveFromFile(const std::string& filePath, std::vector<std::string>& data)
+{
+    std::vector<std::size_t> invalidLines{};
+    return retrieveFromFile(filePath, data, Utf8Policy::Report, invalidLines);
+}
+
+// ---------------------------------------------------------------------------
+bool retrieveFromFile(const std::string& filePath, std::vector<std::string>& data, 
+                      const Utf8Policy utf8Policy, std::vector<std::size_t>& invalidLines)
 {
     // Open the file for reading.
-    std::ifstream ifstream{filePath};
+    const std::unique_ptr<std::FILE, int (*)(std::FILE*)> file{std::fopen(filePath.c_str(), "rb"), &std::fclose};
 
     // If the file couldn't be opened return false.
-    if (!ifstream) { return false; }
+    if (!file) { return false; }
 
-    std::string line{};
+    std::vector<char> buffer(kReadBufferSize);
+    std::size_t size{}, lineNumber{};
+    bool startOfFile{true}, endOfFile{false};
 
-    // Read the file line by line.
-    while (std::getline(ifstream, line)) 
+    // Read the file in chunks and split them into lines, keep the incomplete last line of each 
+    // chunk for the next one.
+    while (!endOfFile)
     {
-        // Store each non-empty line.
-        removeTrailingWhitespaces(line);
-        if (!lineEmpty(line)) { data.push_back(line); }
+        // Grow the buffer if a single line doesn't fit.
+        if (buffer.size() == size) { buffer.resize(2U * buffer.size()); }
+        const auto readSize{std::fread(buffer.data() + size, 1U, buffer.size() - size, file.get())};
+        size += readSize;
+        endOfFile = (0U == readSize);
+
+        const char* first{buffer.data()};
+        const char* const last{first + size};
+        if (startOfFile) { first += byteOrderMarkSize(first, last); }
+        startOfFile = false;
+
+        // Process complete lines only, and the last line at the end of the file.
+        const char* end{last};
+        if (!endOfFile)
+        {
+            const auto newline{std::string_view{first, static_cast<std::size_t>(last - first)}.rfind('\n')};
+            end = (std::string_view::npos == newline) ? first : first + newline + 1;
+        }
+
+        // Validate all lines at once, only check line by line if invalid UTF-8 was found.
+        const auto valid{isValidUtf8(first, end)};
+        while (end != first)
+        {
+            const auto lineEnd{findFirstOf(first, end, "\n")};
+            ++lineNumber;
+            if (valid || (lineEnd == findInvalidUtf8(first, lineEnd))) { addLine(data, first, lineEnd); }
+            else
+            {
+                invalidLines.push_back(lineNumber);
+                addInvalidLine(data, first, lineEnd, utf8Policy);
+            }
+            first = (end == lineEnd) ? end : lineEnd + 1;
+        }
+        size = static_cast<std::size_t>(last - end);
+        std::memmove(buffer.data(), end, size);
     }
+
+    // Don't load any lines if the file contains invalid UTF-8 and is rejected.
+    if ((Utf8Policy::Reject == utf8Policy) && !invalidLines.empty()) { data.clear(); }
+
     // Return true if at least one line was loaded.
     return !data.empty();
 }
@@ -127,8 +229,7 @@ bool retrieveFromFile(const std::string& filePath, std::vector<std::string>& dat
 // ---------------------------------------------------------------------------
 void removeTrailingWhitespaces(std::string& str)
 {
-    str.erase(std::find_if(str.rbegin(), str.rend(), [](unsigned char ch)
-        { return !std::isspace(ch); }).base(), str.end());
+    str.erase(static_cast<std::size_t>(trimTrailingWhitespaces(str.data(), str.data() + str.size()) - str.data()));
 }
 } // namespace utils
 } // namespace language
\ No newline at end of file
@@ -0,0 +1,68 @@
+/**
+ * @brief Implementation details of class language::utils::Vocabulary.
+ */
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+#include "utils/vocabulary.h"
+
+namespace language
+{
+namespace utils
+{
+// ---------------------------------------------------------------------------
+Vocabulary::Vocabulary() noexcept
+    : myBlocks{}
+    , myBlockUsage{kBlockSize}
+    , myWords{}
+    , myTokens{}
+{}
+
+// ---------------------------------------------------------------------------
+Vocabulary::Token Vocabulary::intern(const std::string_view word)
+{
+    const auto token{myTokens.find(word)};
+    if (myTokens.end() != token) { return token->second; }
+
+    // Store the word in the last block, words bigger than a block get a block of their own.
+    // The first word always gets a block, even if it's empty and takes no storage.
+    if (myBlocks.empty() || (kBlockSize < myBlockUsage + word.size()))
+    {
+        myBlocks.push_back(std::make_unique<char[]>(word.size() > kBlockSize ? word.size() : kBlockSize));
+        myBlockUsage = 0U;
+    }
+    auto *storage{myBlocks.back().get() + myBlockUsage};
+    if (!word.empty()) { std::memcpy(storage, word.data(), word.size()); }
+    myBlockUsage += word.size();
+
+    const std::string_view storedWord{storage, word.size()};
+    const auto newToken{static_cast<Token>(myWords.size())};
+    myWords.push_back(storedWord);
+    myTokens.emplace(storedWord, newToken);
+    return newToken;
+}
+
+// ---------------------------------------------------------------------------
+Vocabulary::Token Vocabulary::find(const std::string_view word) const noexcept
+{
+    const auto token{myTokens.find(word)};
+    return myTokens.end() != token ? token->second : kUnknownToken;
+}
+
+// ---------------------------------------------------------------------------
+std::string_view Vocabulary::word(const Token token) const noexcept { return myWords[token]; }
+
+// ---------------------------------------------------------------------------
+std::size_t Vocabulary::size() const noexcept { return myWords.size(); }
+
+// ---------------------------------------------------------------------------
+std::size_t Vocabulary::memoryUsage() const noexcept
+{
+    // Blocks, word views and hash table nodes with key, value and next pointer.
+    return myBlocks.size() * kBlockSize + myWords.capacity() * sizeof(std::string_view) +
+           myTokens.size() * (sizeof(std::string_view) + sizeof(Token) + 2U * sizeof(void *)) +
+           myTokens.bucket_count() * sizeof(void *);
+}
+} // namespace utils
+} // namespace language
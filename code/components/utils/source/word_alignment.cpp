@@ -0,0 +1,260 @@
+/**
+ * @brief Implementation details of word-level alignment.
+ */
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/word_alignment.h"
+
+namespace language
+{
+namespace utils
+{
+namespace
+{
+std::vector<std::string_view> splitWords(std::string_view text);
+bool similarWords(std::string_view x, std::string_view y);
+bool sameHunk(const TokenEdit& previous, const TokenEdit& next) noexcept;
+} // namespace
+
+// ---------------------------------------------------------------------------
+std::vector<TokenEdit> diffTokens(const std::vector<std::uint32_t>& source,
+                                  const std::vector<std::uint32_t>& destination)
+{
+    // Skip the common prefix and suffix, only the differing middle part needs to be searched.
+    std::size_t prefix{};
+    while ((prefix < source.size()) && (prefix < destination.size()) &&
+           (source[prefix] == destination[prefix])) { ++prefix; }
+    std::size_t suffix{};
+    while ((prefix + suffix < source.size()) && (prefix + suffix < destination.size()) &&
+           (source[source.size() - suffix - 1U] == destination[destination.size() - suffix - 1U]))
+    {
+        ++suffix;
+    }
+    const auto *a{source.data() + prefix};
+    const auto *b{destination.data() + prefix};
+    const auto n{static_cast<std::ptrdiff_t>(source.size() - prefix - suffix)};
+    const auto m{static_cast<std::ptrdiff_t>(destination.size() - prefix - suffix)};
+    auto position = [prefix](const std::ptrdiff_t i) { return prefix + static_cast<std::size_t>(i); };
+    std::vector<TokenEdit> edits{};
+
+    if ((0 == n) || (0 == m))
+    {
+        for (std::ptrdiff_t i{}; i < n; ++i) { edits.push_back({TokenEdit::Type::Delete, position(i), prefix}); }
+        for (std::ptrdiff_t j{}; j < m; ++j) { edits.push_back({TokenEdit::Type::Insert, prefix, position(j)}); }
+        return edits;
+    }
+
+    // Search the furthest reaching path on each diagonal k = x - y for an increasing number of
+    // edits d, keeping the diagonals of each round for backtracking.
+    const auto offset{n + m + 1};
+    std::vector<std::ptrdiff_t> v(static_cast<std::size_t>(2 * offset + 1), 0);
+    std::vector<std::vector<std::ptrdiff_t>> trace{};
+    std::ptrdiff_t editCount{-1};
+
+    for (std::ptrdiff_t d{}; (0 > editCount) && (d <= n + m); ++d)
+    {
+        for (std::ptrdiff_t k{-d}; k <= d; k += 2)
+        {
+            const auto down{(-d == k) || ((d != k) && (v[offset + k - 1] < v[offset + k + 1]))};
+            auto x{down ? v[offset + k + 1] : v[offset + k - 1] + 1};
+            auto y{x - k};
+            while ((x < n) && (y < m) && (a[x] == b[y])) { ++x, ++y; }
+            v[offset + k] = x;
+
+            if ((x >= n) && (y >= m))
+            {
+                editCount = d;
+                break;
+            }
+        }
+        if (0 > editCount) { trace.emplace_back(v.begin() + offset - d, v.begin() + offset + d + 1); }
+    }
+
+    // Walk the path backwards, each round contributed one edit.
+    auto x{n}, y{m};
+    for (auto d{editCount}; 0 < d; --d)
+    {
+        const auto &previous{trace[static_cast<std::size_t>(d - 1)]};
+        auto previousX = [&previous, d](const std::ptrdiff_t k) { return previous[k + d - 1]; };
+        const auto k{x - y};
+        const auto down{(-d == k) || ((d != k) && (previousX(k - 1) < previousX(k + 1)))};
+        const auto previousK{down ? k + 1 : k - 1};
+        x = previousX(previousK);
+        y = x - previousK;
+
+        const auto type{down ? TokenEdit::Type::Insert : TokenEdit::Type::Delete};
+        edits.push_back({type, position(x), position(y)});
+    }
+    std::reverse(edits.begin(), edits.end());
+    return edits;
+}
+
+// ---------------------------------------------------------------------------
+std::vector<WordDifference> alignWords(const std::string_view guess, const std::string_view answer)
+{
+    const auto guessWords{splitWords(guess)};
+    const auto answerWords{splitWords(answer)};
+
+    // Compare the words as token IDs.
+    std::unordered_map<std::string_view, std::uint32_t> tokenIds{};
+    auto tokenize = [&tokenIds](const std::vector<std::string_view>& words)
+    {
+        std::vector<std::uint32_t> tokens{};
+        tokens.reserve(words.size());
+        for (const auto& word : words)
+        {
+            tokens.push_back(tokenIds.emplace(word, static_cast<std::uint32_t>(tokenIds.size())).first->second);
+        }
+        return tokens;
+    };
+    const auto answerTokens{tokenize(answerWords)};
+    const auto guessTokens{tokenize(guessWords)};
+    const auto edits{diffTokens(answerTokens, guessTokens)};
+
+    std::vector<WordDifference> differences{};
+    std::vector<bool> used(edits.size(), false);
+    auto addDifference = [&](const WordDifference::Type type, const std::size_t deleted,
+                             const std::size_t inserted)
+    {
+        const auto answerPosition{edits[deleted].sourcePosition};
+        const auto guessPosition{edits[inserted].destinationPosition};
+        differences.push_back({type, answerWords[answerPosition], guessWords[guessPosition],
+                               answerPosition, guessPosition});
+        used[deleted] = used[inserted] = true;
+    };
+
+    // Words both missing and extra have been moved.
+    std::unordered_multimap<std::uint32_t, std::size_t> insertedTokens{};
+    for (std::size_t i{}; i < edits.size(); ++i)
+    {
+        if (TokenEdit::Type::Insert == edits[i].type)
+        {
+            insertedTokens.emplace(guessTokens[edits[i].destinationPosition], i);
+        }
+    }
+    for (std::size_t i{}; (i < edits.size()) && !insertedTokens.empty(); ++i)
+    {
+        if (TokenEdit::Type::Delete != edits[i].type) { continue; }
+        const auto inserted{insertedTokens.find(answerTokens[edits[i].sourcePosition])};
+        if (insertedTokens.end() == inserted) { continue; }
+        addDifference(WordDifference::Type::Swapped, i, inserted->second);
+        insertedTokens.erase(inserted);
+    }
+
+    // Within each run of adjacent edits, pair missing and extra words in order if they're similar.
+    for (std::size_t first{}; first < edits.size(); )
+    {
+        auto last{first + 1U};
+        while ((last < edits.size()) && sameHunk(edits[last - 1U], edits[last])) { ++last; }
+        std::vector<std::size_t> deleted{}, inserted{};
+
+        for (auto i{first}; i < last; ++i)
+        {
+            if (used[i]) { continue; }
+            (TokenEdit::Type::Delete == edits[i].type ? deleted : inserted).push_back(i);
+        }
+        for (std::size_t i{}; (i < deleted.size()) && (i < inserted.size()); ++i)
+        {
+            const auto &answerWord{answerWords[edits[deleted[i]].sourcePosition]};
+            const auto &guessWord{guessWords[edits[inserted[i]].destinationPosition]};
+            if (similarWords(answerWord, guessWord))
+            {
+                addDifference(WordDifference::Type::Misspelled, deleted[i], inserted[i]);
+            }
+        }
+        first = last;
+    }
+
+    // All remaining edits are missing or extra words.
+    for (std::size_t i{}; i < edits.size(); ++i)
+    {
+        if (used[i]) { continue; }
+        const auto &edit{edits[i]};
+        if (TokenEdit::Type::Delete == edit.type)
+        {
+            differences.push_back({WordDifference::Type::Missing, answerWords[edit.sourcePosition], {},
+                                   edit.sourcePosition, edit.destinationPosition});
+        }
+        else
+        {
+            differences.push_back({WordDifference::Type::Extra, {}, guessWords[edit.destinationPosition],
+                                   edit.sourcePosition, edit.destinationPosition});
+        }
+    }
+    std::stable_sort(differences.begin(), differences.end(),
+        [](const WordDifference& x, const WordDifference& y)
+        {
+            return (x.answerPosition != y.answerPosition) ? x.answerPosition < y.answerPosition
+                                                          : x.guessPosition < y.guessPosition;
+        });
+    return differences;
+}
+
+namespace
+{
+// ---------------------------------------------------------------------------
+std::vector<std::string_view> splitWords(const std::string_view text)
+{
+    std::vector<std::string_view> words{};
+    std::size_t start{};
+
+    for (std::size_t i{}; i <= text.size(); ++i)
+    {
+        if ((text.size() == i) || std::isspace(static_cast<unsigned char>(text[i])))
+        {
+            if (start < i) { words.push_back(text.substr(start, i - start)); }
+            start = i + 1U;
+        }
+    }
+    return words;
+}
+
+// ---------------------------------------------------------------------------
+bool similarWords(const std::string_view x, const std::string_view y)
+{
+    // Allow one edit per three characters, but at least one edit. The distance must also stay below
+    // the length of the shorter word, otherwise any two short words would be misspellings of each other.
+    if (x.empty() || y.empty()) { return false; }
+    const auto maxDistance{std::min(std::max<std::size_t>(1U, std::max(x.size(), y.size()) / 3U),
+                                    std::min(x.size(), y.size()) - 1U)};
+    if (maxDistance < (x.size() > y.size() ? x.size() - y.size() : y.size() - x.size())) { return false; }
+
+    // Calculate the edit distance row by row, counting swapped adjacent characters as one edit.
+    std::vector<std::size_t> beforePrevious(y.size() + 1U), previous(y.size() + 1U), row(y.size() + 1U);
+    for (std::size_t j{}; j <= y.size(); ++j) { row[j] = j; }
+
+    for (std::size_t i{1U}; i <= x.size(); ++i)
+    {
+        beforePrevious.swap(previous);
+        previous.swap(row);
+        row[0U] = i;
+        for (std::size_t j{1U}; j <= y.size(); ++j)
+        {
+            row[j] = std::min({previous[j] + 1U, row[j - 1U] + 1U, 
+                               previous[j - 1U] + (x[i - 1U] != y[j - 1U])});
+            if ((1U < i) && (1U < j) && (x[i - 1U] == y[j - 2U]) && (x[i - 2U] == y[j - 1U]))
+            {
+                row[j] = std::min(row[j], beforePrevious[j - 2U] + 1U);
+            }
+        }
+    }
+    return row[y.size()] <= maxDistance;
+}
+
+// ---------------------------------------------------------------------------
+bool sameHunk(const TokenEdit& previous, const TokenEdit& next) noexcept
+{
+    // Adjacent edits follow each other without any matching word in between.
+    const auto deleted{TokenEdit::Type::Delete == previous.type};
+    return (next.sourcePosition == previous.sourcePosition + (deleted ? 1U : 0U)) &&
+           (next.destinationPosition == previous.destinationPosition + (deleted ? 0U : 1U));
+}
+} // namespace
+} // namespace utils
+} // namespace language
@@ -0,0 +1,138 @@
+/**
+ * @brief Implementation details of class language::utils::WorkStealingPool.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "utils/work_stealing_pool.h"
+
+namespace language
+{
+namespace utils
+{
+namespace
+{
+/** Pool of the calling thread, nullptr outside of pools. */
+thread_local const WorkStealingPool* currentPool{nullptr};
+
+/** Index of the calling thread in its pool. */
+thread_local std::size_t currentIndex{};
+} // namespace
+
+// ---------------------------------------------------------------------------
+WorkStealingPool::WorkStealingPool(const std::size_t threadCount)
+    : myQueues{}
+    , myThreads{}
+    , myMutex{}
+    , myTaskCondition{}
+    , myIdleCondition{}
+    , myQueuedCount{}
+    , myPendingCount{}
+    , myStopRequested{false}
+    , myNextQueue{}
+{
+    const auto threads{std::max<std::size_t>(
+        0U != threadCount ? threadCount : std::thread::hardware_concurrency(), 1U)};
+    for (std::size_t i{}; i < threads; ++i) { myQueues.push_back(std::make_unique<Queue>()); }
+    for (std::size_t i{}; i < threads; ++i) { myThreads.emplace_back(&WorkStealingPool::run, this, i); }
+}
+
+// ---------------------------------------------------------------------------
+WorkStealingPool::~WorkStealingPool() noexcept
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        myStopRequested = true;
+    }
+    myTaskCondition.notify_all();
+    for (auto& thread : myThreads) { thread.join(); }
+}
+
+// ---------------------------------------------------------------------------
+void WorkStealingPool::submit(Task task)
+{
+    const auto index{(this == currentPool) ? currentIndex : myNextQueue++ % myQueues.size()};
+    {
+        std::lock_guard<std::mutex> lock{myQueues[index]->mutex};
+        myQueues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        ++myQueuedCount;
+        ++myPendingCount;
+    }
+    myTaskCondition.notify_one();
+}
+
+// ---------------------------------------------------------------------------
+void WorkStealingPool::wait()
+{
+    std::unique_lock<std::mutex> lock{myMutex};
+    myIdleCondition.wait(lock, [this]() { return 0U == myPendingCount; });
+}
+
+// ---------------------------------------------------------------------------
+std::size_t WorkStealingPool::threadCount() const noexcept
+{
+    return myThreads.size();
+}
+
+// ---------------------------------------------------------------------------
+void WorkStealingPool::run(const std::size_t index)
+{
+    currentPool  = this;
+    currentIndex = index;
+
+    for (Task task{}; ; task = nullptr)
+    {
+        // Claim one of the queued tasks, which leaves at least one task in the queues for it.
+        {
+            std::unique_lock<std::mutex> lock{myMutex};
+            myTaskCondition.wait(lock, [this]() { return myStopRequested || (0U < myQueuedCount); });
+            if (0U == myQueuedCount) { return; }
+            --myQueuedCount;
+        }
+        while (!take(index, task)) { std::this_thread::yield(); }
+        task(index);
+
+        std::lock_guard<std::mutex> lock{myMutex};
+        if (0U == --myPendingCount) { myIdleCondition.notify_all(); }
+    }
+}
+
+// ---------------------------------------------------------------------------
+bool WorkStealingPool::take(const std::size_t index, Task& task)
+{
+    // Run the newest own task first, its data is most likely still cached.
+    {
+        auto& queue{*myQueues[index]};
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (!queue.tasks.empty())
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Steal the oldest task of the next thread with queued tasks.
+    for (std::size_t i{1U}; i < myQueues.size(); ++i)
+    {
+        auto& queue{*myQueues[(index + i) % myQueues.size()]};
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (!queue.tasks.empty())
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace utils
+} // namespace language
@@ -0,0 +1,73 @@
+/**
+ * @brief Unit test for class language::utils::Arguments.
+ */
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/arguments.h"
+
+namespace
+{
+using namespace language;
+
+// -----------------------------------------------------------------------------
+utils::Arguments parse(const std::vector<const char *> &args)
+{
+    return utils::Arguments{static_cast<int>(args.size()), const_cast<const char **>(args.data())};
+}
+
+/**
+ * @brief Verify that options are parsed anywhere on the command line, as flags and with values,
+ *        and that all other arguments keep their order.
+ */
+TEST(ArgumentsTest, OptionTest)
+{
+    const auto arguments{parse({"./runGame", "phrases.txt", "--choices=4", "--tokenize", "5", "--pair=3,2",
+                                "--filter=a=b", "--empty=", "-x", "--", "--columns=3", "--columns=4"})};
+
+    // Expect the program name first, and single dashes and a lone double dash to be positional.
+    EXPECT_EQ(arguments.positional(), (std::vector<std::string>{"./runGame", "phrases.txt", "5", "-x", "--"}));
+    EXPECT_EQ(arguments.positionalCount(), 5U);
+
+    // Expect flags to be entered without value, and values to extend up to the end.
+    EXPECT_TRUE(arguments.hasOption("tokenize"));
+    EXPECT_EQ(arguments.option("tokenize", "default"), "");
+    EXPECT_TRUE(arguments.hasOption("empty"));
+    EXPECT_EQ(arguments.option("pair"), "3,2");
+    EXPECT_EQ(arguments.option("filter"), "a=b");
+    EXPECT_EQ(arguments.option("columns"), "4");
+
+    // Expect missing options to yield the default.
+    EXPECT_FALSE(arguments.hasOption("reverse"));
+    EXPECT_FALSE(arguments.hasOption("choices=4"));
+    EXPECT_EQ(arguments.option("reverse", "default"), "default");
+}
+
+/**
+ * @brief Verify that numeric options fall back to the default if missing, empty or not a number.
+ */
+TEST(ArgumentsTest, NumericOptionTest)
+{
+    const auto arguments{parse({"./runGame", "--choices=4", "--tokenize", "--pair=3,2", "--limit=12x"})};
+    EXPECT_EQ(arguments.numericOption("choices"), 4U);
+    EXPECT_EQ(arguments.numericOption("tokenize", 9U), 9U);
+    EXPECT_EQ(arguments.numericOption("pair", 7U), 7U);
+    EXPECT_EQ(arguments.numericOption("limit", 7U), 7U);
+    EXPECT_EQ(arguments.numericOption("missing", 3U), 3U);
+    EXPECT_EQ(arguments.numericOption("missing"), 0U);
+}
+
+/**
+ * @brief Verify that the program name is positional, even if it looks like an option.
+ */
+TEST(ArgumentsTest, ProgramNameTest)
+{
+    const auto arguments{parse({"--game", "--reverse"})};
+    EXPECT_EQ(arguments.positional(), std::vector<std::string>{"--game"});
+    EXPECT_TRUE(arguments.hasOption("reverse"));
+    EXPECT_FALSE(arguments.hasOption("game"));
+    EXPECT_EQ(parse({}).positionalCount(), 0U);
+}
+} // namespace
@@ -0,0 +1,49 @@
+/**
+ * @brief Unit test for class language::utils::Fingerprint.
+ */
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "utils/fingerprint.h"
+#include "utils/phrase.h"
+
+namespace 
+{
+using namespace language;
+
+/**
+ * @brief Verify the fingerprint values, which checkpoints, session logs and saved indexes 
+ *        written before rely on.
+ */
+TEST(FingerprintTest, ValueTest) 
+{
+    utils::Fingerprint fingerprint{};
+    EXPECT_EQ(fingerprint.value(), 0xcbf29ce484222325ULL);
+
+    fingerprint.add(Phrase{"Good luck!", "Viel Glück!"});
+    EXPECT_EQ(fingerprint.value(), 0xabec64e4d1df6339ULL);
+
+    utils::Fingerprint session{};
+    session.add(std::string{"3"});
+    session.add(Phrase{"Good luck!", "Viel Glück!"});
+    EXPECT_EQ(session.value(), 0xd1a0231e4beae61bULL);
+
+    // Expect the separator to be hashed after an empty text as well.
+    utils::Fingerprint empty{};
+    empty.add(std::string{});
+    EXPECT_EQ(empty.value(), 0xaf64724c8602eb6eULL);
+}
+
+/**
+ * @brief Verify that moving characters between the texts of a phrase changes the fingerprint.
+ */
+TEST(FingerprintTest, SeparatorTest) 
+{
+    utils::Fingerprint x{}, y{};
+    x.add(Phrase{"ab", "c"});
+    y.add(Phrase{"a", "bc"});
+    EXPECT_NE(x.value(), y.value());
+}
+} // namespace
@@ -0,0 +1,99 @@
+/**
+ * @brief Unit test for class language::utils::InputReader.
+ */
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <streambuf>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "utils/input_reader.h"
+
+namespace 
+{
+using namespace language;
+
+/**
+ * @brief Stream buffer blocking the reader until text is fed or the buffer is closed, like a terminal.
+ */
+class TerminalBuffer final : public std::streambuf
+{
+public:
+    /** @brief Make text available to the reader. */
+    void feed(const std::string &text)
+    {
+        {
+            std::lock_guard<std::mutex> lock{myMutex};
+            myPending += text;
+        }
+        myCondition.notify_one();
+    }
+
+    /** @brief End the input once the fed text has been read. */
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock{myMutex};
+            myClosed = true;
+        }
+        myCondition.notify_one();
+    }
+
+protected:
+    int_type underflow() override
+    {
+        std::unique_lock<std::mutex> lock{myMutex};
+        myCondition.wait(lock, [this]() { return !myPending.empty() || myClosed; });
+        if (myPending.empty()) { return traits_type::eof(); }
+
+        myCurrent.swap(myPending);
+        myPending.clear();
+        setg(myCurrent.data(), myCurrent.data(), myCurrent.data() + myCurrent.size());
+        return traits_type::to_int_type(myCurrent.front());
+    }
+
+private:
+    std::mutex myMutex;
+    std::condition_variable myCondition;
+    std::string myPending;
+    std::string myCurrent;
+    bool myClosed{false};
+};
+
+/**
+ * @brief Verify that reading times out without input, returns lines in order and reports the end
+ *        of the input.
+ */
+TEST(InputReaderTest, ReadTest) 
+{
+    // The reader is a single instance reading std::cin, so the whole sequence is one test.
+    TerminalBuffer buffer{};
+    auto *const previousBuffer{std::cin.rdbuf(&buffer)};
+    auto &reader{utils::InputReader::instance()};
+    std::string line{};
+
+    const auto start{std::chrono::steady_clock::now()};
+    EXPECT_FALSE(reader.readLine(line, start + std::chrono::milliseconds{50}, nullptr));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds{50});
+    EXPECT_FALSE(reader.closed());
+
+    buffer.feed("first\nsecond\n");
+    const auto deadline{std::chrono::steady_clock::now() + std::chrono::seconds{5}};
+    ASSERT_TRUE(reader.readLine(line, deadline, nullptr));
+    EXPECT_EQ(line, "first");
+    ASSERT_TRUE(reader.readLine(line, deadline, nullptr));
+    EXPECT_EQ(line, "second");
+
+    // Expect an empty line without waiting at the end of the input.
+    buffer.close();
+    ASSERT_TRUE(reader.readLine(line, std::chrono::steady_clock::time_point::max(), nullptr));
+    EXPECT_TRUE(line.empty());
+    EXPECT_TRUE(reader.closed());
+    ASSERT_TRUE(reader.readLine(line, std::chrono::steady_clock::time_point::max(), nullptr));
+    EXPECT_TRUE(line.empty());
+    std::cin.rdbuf(previousBuffer);
+}
+} // namespace
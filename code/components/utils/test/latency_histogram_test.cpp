@@ -0,0 +1,86 @@
+/**
+ * @brief Unit test for class language::utils::LatencyHistogram.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "utils/latency_histogram.h"
+
+namespace 
+{
+using namespace language;
+
+/**
+ * @brief Verify that percentiles are exact for small values and within the bucket precision of
+ *        1/128 for larger values.
+ */
+TEST(LatencyHistogramTest, PercentileTest) 
+{
+    utils::LatencyHistogram histogram{};
+    EXPECT_EQ(histogram.percentile(50.0), 0U);
+
+    for (std::uint64_t value{1U}; value <= 200U; ++value) { histogram.record(value); }
+    EXPECT_EQ(histogram.percentile(0.0), 1U);
+    EXPECT_EQ(histogram.percentile(50.0), 100U);
+    EXPECT_EQ(histogram.percentile(99.0), 198U);
+
+    histogram.clear();
+    EXPECT_EQ(histogram.count(), 0U);
+    for (std::uint64_t value{1U}; value <= 100000U; ++value) { histogram.record(value); }
+    EXPECT_EQ(histogram.count(), 100000U);
+    for (const auto percentile : {50.0, 90.0, 99.0, 99.9})
+    {
+        const auto exact{static_cast<std::uint64_t>(percentile * 1000.0)};
+        EXPECT_GE(histogram.percentile(percentile), exact);
+        EXPECT_LE(histogram.percentile(percentile), exact + exact / 128U);
+    }
+
+    // Expect the highest percentile to be the maximum, not the end of its bucket.
+    EXPECT_EQ(histogram.percentile(100.0), 100000U);
+    EXPECT_EQ(histogram.max(), 100000U);
+}
+
+/**
+ * @brief Verify that values above the maximum are clamped.
+ */
+TEST(LatencyHistogramTest, ClampTest) 
+{
+    utils::LatencyHistogram histogram{};
+    histogram.record(utils::LatencyHistogram::kMaxValue + 1000U);
+    histogram.record(UINT64_MAX);
+    EXPECT_EQ(histogram.count(), 2U);
+    EXPECT_EQ(histogram.max(), utils::LatencyHistogram::kMaxValue);
+    EXPECT_EQ(histogram.percentile(50.0), utils::LatencyHistogram::kMaxValue);
+}
+
+/**
+ * @brief Verify that merged histograms equal a histogram recording all values.
+ */
+TEST(LatencyHistogramTest, MergeTest) 
+{
+    utils::LatencyHistogram first{}, second{}, all{};
+    for (std::uint64_t value{1U}; value <= 5000U; ++value)
+    {
+        ((0U == value % 3U) ? first : second).record(value * 7U);
+        all.record(value * 7U);
+    }
+    first.add(second);
+    EXPECT_EQ(first.count(), all.count());
+    EXPECT_EQ(first.max(), all.max());
+    for (const auto percentile : {1.0, 25.0, 50.0, 75.0, 99.0, 100.0})
+    {
+        EXPECT_EQ(first.percentile(percentile), all.percentile(percentile));
+    }
+}
+
+/**
+ * @brief Verify that latencies are formatted in the largest fitting unit.
+ */
+TEST(LatencyHistogramTest, FormatTest) 
+{
+    EXPECT_EQ(utils::formatLatency(999U), "999 us");
+    EXPECT_EQ(utils::formatLatency(1500U), "1.5 ms");
+    EXPECT_EQ(utils::formatLatency(2500000U), "2.50 s");
+}
+} // namespace
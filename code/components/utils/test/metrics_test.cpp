@@ -0,0 +1,460 @@
+/**
+ * @brief Unit test for the metrics in namespace language::utils::metrics, and for the trace
+ *        timeline their timers record in namespace language::utils::trace.
+ */
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/metrics.h"
+#include "utils/trace.h"
+
+namespace
+{
+using namespace language;
+
+/** Counter recorded by several threads. */
+const utils::metrics::Metric kCounter{"metrics_test_counter", utils::metrics::MetricType::Counter,
+                                      "Counter of the metrics test."};
+
+/** Timer recorded by several threads. */
+const utils::metrics::Metric kTimer{"metrics_test_timer", utils::metrics::MetricType::Timer,
+                                    "Timer of the metrics test."};
+
+/** Timer of the outer spans of the trace. */
+const utils::metrics::Metric kOuterTimer{"trace_test_outer", utils::metrics::MetricType::Timer,
+                                         "Outer span of the trace test."};
+
+/** Timer of the spans nested in the outer spans of the trace. */
+const utils::metrics::Metric kInnerTimer{"trace_test_inner", utils::metrics::MetricType::Timer,
+                                         "Inner span of the trace test."};
+
+/** The number of nested spans recorded by each thread of the trace test. */
+constexpr std::size_t kSpanCount{3U};
+
+/**
+ * @brief JSON value, with the members of objects in order of appearance.
+ */
+struct Json
+{
+    /** Enumeration of JSON types. */
+    enum class Type { Null, Boolean, Number, String, Array, Object };
+
+    /** @brief Get the member with the given name, nullptr if there is none. */
+    const Json *member(const std::string &name) const
+    {
+        for (std::size_t i{}; i < names.size(); ++i)
+        {
+            if (name == names[i]) { return &values[i]; }
+        }
+        return nullptr;
+    }
+
+    /** The type of the value. */
+    Type type{Type::Null};
+
+    /** The value of numbers. */
+    double number{};
+
+    /** The value of strings, with escaped characters kept as they are. */
+    std::string text{};
+
+    /** The names of the members of objects. */
+    std::vector<std::string> names{};
+
+    /** The elements of arrays and the values of the members of objects. */
+    std::vector<Json> values{};
+};
+
+/**
+ * @brief Strict parser of JSON text, following RFC 8259.
+ */
+class JsonParser final
+{
+public:
+    /** @brief Create parser of the given text. */
+    explicit JsonParser(const std::string &text) noexcept
+        : myText{text}
+        , myPosition{}
+    {}
+
+    /** @brief Parse the whole text as one value, return false if it isn't valid JSON. */
+    bool parse(Json &value)
+    {
+        if (!parseValue(value)) { return false; }
+        skipWhitespaces();
+        return myText.size() == myPosition;
+    }
+
+private:
+    void skipWhitespaces() noexcept
+    {
+        while ((myText.size() > myPosition) && (std::string{" \t\r\n"}.find(myText[myPosition]) != std::string::npos))
+        {
+            ++myPosition;
+        }
+    }
+
+    bool consume(const std::string &token) noexcept
+    {
+        if (0 != myText.compare(myPosition, token.size(), token)) { return false; }
+        myPosition += token.size();
+        return true;
+    }
+
+    bool digits() noexcept
+    {
+        const auto first{myPosition};
+        while ((myText.size() > myPosition) && std::isdigit(static_cast<unsigned char>(myText[myPosition])))
+        {
+            ++myPosition;
+        }
+        return first != myPosition;
+    }
+
+    bool parseValue(Json &value)
+    {
+        skipWhitespaces();
+        if (myText.size() == myPosition) { return false; }
+        const auto c{myText[myPosition]};
+        if ('{' == c) { return parseObject(value); }
+        if ('[' == c) { return parseArray(value); }
+        if ('"' == c)
+        {
+            value.type = Json::Type::String;
+            return parseString(value.text);
+        }
+        if (consume("true") || consume("false"))
+        {
+            value.type = Json::Type::Boolean;
+            return true;
+        }
+        return consume("null") || parseNumber(value);
+    }
+
+    bool parseObject(Json &value)
+    {
+        value.type = Json::Type::Object;
+        ++myPosition;
+        skipWhitespaces();
+        if (consume("}")) { return true; }
+        do
+        {
+            skipWhitespaces();
+            value.names.emplace_back();
+            value.values.emplace_back();
+            if (!parseString(value.names.back())) { return false; }
+            skipWhitespaces();
+            if (!consume(":") || !parseValue(value.values.back())) { return false; }
+            skipWhitespaces();
+        } while (consume(","));
+        return consume("}");
+    }
+
+    bool parseArray(Json &value)
+    {
+        value.type = Json::Type::Array;
+        ++myPosition;
+        skipWhitespaces();
+        if (consume("]")) { return true; }
+        do
+        {
+            value.values.emplace_back();
+            if (!parseValue(value.values.back())) { return false; }
+            skipWhitespaces();
+        } while (consume(","));
+        return consume("]");
+    }
+
+    bool parseString(std::string &text)
+    {
+        if (!consume("\"")) { return false; }
+        for (; myText.size() > myPosition; ++myPosition)
+        {
+            const auto c{static_cast<unsigned char>(myText[myPosition])};
+            if ('"' == c)
+            {
+                ++myPosition;
+                return true;
+            }
+            if (0x20U > c) { return false; }
+            text.push_back(static_cast<char>(c));
+            if ('\\' != c) { continue; }
+
+            // Escapes are kept, but need to be valid.
+            if (myText.size() == ++myPosition) { return false; }
+            const auto escaped{myText[myPosition]};
+            text.push_back(escaped);
+            if ('u' == escaped)
+            {
+                for (std::size_t i{}; i < 4U; ++i)
+                {
+                    if ((myText.size() == ++myPosition) ||
+                        !std::isxdigit(static_cast<unsigned char>(myText[myPosition])))
+                    {
+                        return false;
+                    }
+                    text.push_back(myText[myPosition]);
+                }
+            }
+            else if (std::string{"\"\\/bfnrt"}.find(escaped) == std::string::npos) { return false; }
+        }
+        return false;
+    }
+
+    bool parseNumber(Json &value)
+    {
+        // Optional minus, no leading zeros, optional fraction and exponent.
+        const auto first{myPosition};
+        consume("-");
+        if (!consume("0") && ((myText.size() == myPosition) || ('0' == myText[myPosition]) || !digits()))
+        {
+            return false;
+        }
+        if (consume(".") && !digits()) { return false; }
+        if (consume("e") || consume("E"))
+        {
+            if (!consume("+")) { consume("-"); }
+            if (!digits()) { return false; }
+        }
+        value.type   = Json::Type::Number;
+        value.number = std::strtod(myText.substr(first, myPosition - first).c_str(), nullptr);
+        return true;
+    }
+
+    /** The text to parse. */
+    const std::string &myText;
+
+    /** Position of the next character to parse. */
+    std::size_t myPosition;
+};
+
+// -----------------------------------------------------------------------------
+Json exportedJson()
+{
+    Json json{};
+    const auto text{utils::metrics::toJson()};
+    EXPECT_TRUE(JsonParser{text}.parse(json)) << text;
+    return json;
+}
+
+// -----------------------------------------------------------------------------
+double exportedValue(const Json &json, const std::string &group, const std::string &name,
+                     const std::string &field = "")
+{
+    // Get a counter, or a field of a timer, 0 if it wasn't exported.
+    const auto *metrics{json.member(group)};
+    const auto *metric{metrics ? metrics->member(name) : nullptr};
+    if (metric && !field.empty()) { metric = metric->member(field); }
+    return (metric && (Json::Type::Number == metric->type)) ? metric->number : 0.0;
+}
+
+// -----------------------------------------------------------------------------
+std::uint64_t exportedPrometheusValue(const std::string &name)
+{
+    // Get the value of the sample with the given name, 0 if it wasn't exported.
+    const auto text{utils::metrics::toPrometheus()};
+    const auto position{text.find("\n" + name + " ")};
+    return (std::string::npos == position) ? 0U : std::strtoull(text.c_str() + position + name.size() + 2U, nullptr, 10);
+}
+
+// -----------------------------------------------------------------------------
+void recordNestedSpans(const char *threadName)
+{
+    utils::trace::setThreadName(threadName);
+    for (std::size_t i{}; i < kSpanCount; ++i)
+    {
+        // The inner timer stops first, so its span is recorded before the outer one.
+        const utils::metrics::ScopedTimer outer{kOuterTimer};
+        const utils::metrics::ScopedTimer inner{kInnerTimer};
+        std::this_thread::sleep_for(std::chrono::microseconds{100});
+    }
+}
+
+// -----------------------------------------------------------------------------
+std::string text(const Json *json)
+{
+    return (json && (Json::Type::String == json->type)) ? json->text : std::string{};
+}
+
+// -----------------------------------------------------------------------------
+double number(const Json *json)
+{
+    EXPECT_TRUE(json && (Json::Type::Number == json->type));
+    return (json && (Json::Type::Number == json->type)) ? json->number : -1.0;
+}
+
+/**
+ * @brief Verify the parser the exports are checked with.
+ */
+TEST(MetricsTest, JsonParserTest)
+{
+    Json json{};
+    EXPECT_TRUE(JsonParser{"{\"a\": [1, -2.5e3, \"x\\n\\u00fc\", true, null], \"b\": {}}"}.parse(json));
+    EXPECT_EQ(json.names, (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(json.member("a")->values[1U].number, -2500.0);
+    for (const char *invalid : {"", "{", "[1,]", "{\"a\" 1}", "01", "1.", "\"\\x\"", "\"a", "[1] 2", "{a: 1}"})
+    {
+        EXPECT_FALSE(JsonParser{invalid}.parse(json)) << invalid;
+    }
+}
+
+/**
+ * @brief Verify that the values added by several threads are summed up in both exports, also
+ *        once the threads have exited.
+ */
+TEST(MetricsTest, ThreadTest)
+{
+    const auto before{exportedJson()};
+    const auto counterBefore{exportedPrometheusValue("language_metrics_test_counter_total")};
+    constexpr std::size_t kThreadCount{8U};
+    constexpr std::size_t kAddCount{1000U};
+
+    std::vector<std::thread> threads{};
+    for (std::size_t t{}; t < kThreadCount; ++t)
+    {
+        threads.emplace_back([t]()
+        {
+            for (std::size_t i{}; i < kAddCount; ++i)
+            {
+                utils::metrics::add(kCounter, t + 1U);
+                utils::metrics::add(kTimer, 1000U * (t + 1U));
+            }
+        });
+    }
+    for (auto &thread : threads) { thread.join(); }
+
+    // Each thread adds its number, timers in microseconds.
+    const auto after{exportedJson()};
+    constexpr auto kTotal{kAddCount * kThreadCount * (kThreadCount + 1U) / 2U};
+    EXPECT_EQ(exportedValue(after, "counters", kCounter.name()) - exportedValue(before, "counters", kCounter.name()),
+              static_cast<double>(kTotal));
+    EXPECT_EQ(exportedPrometheusValue("language_metrics_test_counter_total") - counterBefore, kTotal);
+    EXPECT_EQ(exportedValue(after, "timers", kTimer.name(), "count") -
+              exportedValue(before, "timers", kTimer.name(), "count"), static_cast<double>(kAddCount * kThreadCount));
+    EXPECT_NEAR(exportedValue(after, "timers", kTimer.name(), "total_seconds") -
+                exportedValue(before, "timers", kTimer.name(), "total_seconds"), kTotal * 1e-6, 1e-9);
+    EXPECT_NEAR(exportedValue(after, "timers", kTimer.name(), "max_seconds"), kThreadCount * 1e-6, 1e-12);
+}
+
+/**
+ * @brief Verify that metrics beyond the maximum number aren't recorded, while the registered
+ *        ones still are, also when registered again by name.
+ */
+TEST(MetricsTest, OverflowTest)
+{
+    // Names need to stay valid until exit.
+    static std::deque<std::string> names{};
+    std::vector<std::size_t> indexes{};
+    for (std::size_t i{}; i <= utils::metrics::kMaxMetricCount; ++i)
+    {
+        names.push_back("metrics_test_overflow_" + std::to_string(names.size()));
+        const utils::metrics::Metric metric{names.back().c_str(), utils::metrics::MetricType::Counter,
+                                            "Counter beyond the maximum number of metrics."};
+        indexes.push_back(metric.index());
+        utils::metrics::add(metric, 1U);
+    }
+
+    // Expect new metrics to be registered in order until the registry is full.
+    EXPECT_EQ(indexes.back(), utils::metrics::kMaxMetricCount);
+    for (std::size_t i{1U}; i < indexes.size(); ++i)
+    {
+        EXPECT_TRUE((indexes[i - 1U] < indexes[i]) || (utils::metrics::kMaxMetricCount == indexes[i])) << i;
+    }
+
+    // Expect only the registered metrics to be exported.
+    const auto text{utils::metrics::toJson()};
+    for (std::size_t i{}; i < indexes.size(); ++i)
+    {
+        const auto exported{std::string::npos != text.find("\"" + names[names.size() - indexes.size() + i] + "\"")};
+        EXPECT_EQ(exported, utils::metrics::kMaxMetricCount != indexes[i]) << i;
+    }
+
+    // Expect a registered metric to keep its index and to be recorded.
+    const utils::metrics::Metric counter{kCounter.name(), utils::metrics::MetricType::Counter, "Same counter."};
+    EXPECT_EQ(counter.index(), kCounter.index());
+    const auto before{exportedPrometheusValue("language_metrics_test_counter_total")};
+    utils::metrics::add(counter, 5U);
+    EXPECT_EQ(exportedPrometheusValue("language_metrics_test_counter_total") - before, 5U);
+}
+/**
+ * @brief Verify that the trace is valid JSON holding the named threads, with each span nested in
+ *        the span enclosing it on the same thread.
+ *
+ *        Spans are complete events ("ph": "X"), which begin at "ts" and end after "dur".
+ */
+TEST(TraceTest, WriteTest)
+{
+    constexpr const char *filePath{"trace_test.json"};
+
+    // Record spans without writing the trace at exit, as writeAtExit() would.
+    utils::trace::detail::enabled.store(true);
+    recordNestedSpans("trace_test_main");
+    std::vector<std::thread> threads{};
+    for (std::size_t t{}; t < 4U; ++t) { threads.emplace_back(&recordNestedSpans, "trace_test_worker"); }
+    for (auto &thread : threads) { thread.join(); }
+    utils::trace::detail::enabled.store(false);
+
+    ASSERT_TRUE(utils::trace::write(filePath));
+    std::ostringstream content{};
+    content << std::ifstream{filePath}.rdbuf();
+    std::remove(filePath);
+    Json json{};
+    ASSERT_TRUE(JsonParser{content.str()}.parse(json)) << content.str();
+    const auto *events{json.member("traceEvents")};
+    ASSERT_TRUE(events && (Json::Type::Array == events->type));
+
+    // Collect the thread names and the spans of the test by thread.
+    std::map<double, std::string> threadNames{};
+    std::map<double, std::vector<const Json *>> outerSpans{}, innerSpans{};
+    for (const auto &event : events->values)
+    {
+        const auto phase{text(event.member("ph"))};
+        const auto tid{number(event.member("tid"))};
+        number(event.member("pid"));
+        if ("M" == phase)
+        {
+            const auto *args{event.member("args")};
+            threadNames[tid] = text(args ? args->member("name") : nullptr);
+            continue;
+        }
+        ASSERT_EQ(phase, "X");
+        EXPECT_GE(number(event.member("dur")), 0.0);
+        if (kOuterTimer.name() == text(event.member("name"))) { outerSpans[tid].push_back(&event); }
+        if (kInnerTimer.name() == text(event.member("name"))) { innerSpans[tid].push_back(&event); }
+    }
+
+    // Expect each inner span to begin and end within the outer span recorded after it.
+    std::size_t workerCount{};
+    for (const auto &[tid, spans] : innerSpans)
+    {
+        EXPECT_EQ(threadNames.count(tid), 1U);
+        workerCount += ("trace_test_worker" == threadNames[tid]) ? 1U : 0U;
+        ASSERT_EQ(spans.size(), outerSpans[tid].size());
+        EXPECT_EQ(spans.size() % kSpanCount, 0U);
+        for (std::size_t i{}; i < spans.size(); ++i)
+        {
+            const auto &inner{*spans[i]}, &outer{*outerSpans[tid][i]};
+            const auto innerStart{number(inner.member("ts"))}, outerStart{number(outer.member("ts"))};
+            EXPECT_GE(innerStart, outerStart);
+            EXPECT_LE(innerStart + number(inner.member("dur")), outerStart + number(outer.member("dur")) + 0.001);
+        }
+    }
+    EXPECT_GE(workerCount, 4U);
+    EXPECT_EQ(std::count_if(threadNames.begin(), threadNames.end(),
+                            [](const auto &threadName) { return "trace_test_main" == threadName.second; }), 1);
+}
+} // namespace
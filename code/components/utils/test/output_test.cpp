@@ -0,0 +1,109 @@
+/**
+ * @brief Unit test for class language::utils::Output.
+ */
+#include <cstddef>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/output.h"
+
+namespace
+{
+using namespace language;
+
+/**
+ * @brief Stream buffer recording each write separately.
+ */
+class RecordingBuffer final : public std::streambuf
+{
+public:
+    /** @brief Get the text of each write, in order. */
+    const std::vector<std::string> &writes() const noexcept { return myWrites; }
+
+protected:
+    std::streamsize xsputn(const char *text, const std::streamsize size) override
+    {
+        myWrites.emplace_back(text, static_cast<std::size_t>(size));
+        return size;
+    }
+
+    int_type overflow(const int_type c) override
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            myWrites.emplace_back(1U, traits_type::to_char_type(c));
+        }
+        return traits_type::not_eof(c);
+    }
+
+private:
+    std::vector<std::string> myWrites;
+};
+
+/**
+ * @brief Verify that formatted text is kept in the buffer until the output is deleted, and then
+ *        written in one write.
+ */
+TEST(OutputTest, FlushOnDestructionTest)
+{
+    RecordingBuffer buffer{};
+    std::ostream ostream{&buffer};
+    {
+        utils::Output output{ostream, 1024U};
+        output << "Guesses: " << 42 << ' ' << std::string{"errors: "} << -3 << std::string_view{", "};
+        output.fixed(66.666, 1) << static_cast<const char *>(nullptr) << "%\n";
+        EXPECT_TRUE(buffer.writes().empty());
+        EXPECT_EQ(output.size(), 30U);
+    }
+    EXPECT_EQ(buffer.writes(), std::vector<std::string>{"Guesses: 42 errors: -3, 66.7%\n"});
+
+    // Expect discarded and empty buffers not to be written.
+    {
+        utils::Output output{ostream, 1024U};
+        output << "discarded";
+        output.clear();
+        EXPECT_TRUE(output.empty());
+        output.flush();
+    }
+    EXPECT_EQ(buffer.writes().size(), 1U);
+}
+
+/**
+ * @brief Verify that the buffer is written as a whole once its capacity is reached, also if one
+ *        text exceeds the capacity.
+ */
+TEST(OutputTest, OverflowTest)
+{
+    RecordingBuffer buffer{};
+    std::ostream ostream{&buffer};
+    utils::Output output{ostream, 8U};
+
+    output << "1234" << '5' << 67;
+    EXPECT_TRUE(buffer.writes().empty());
+    EXPECT_EQ(output.size(), 7U);
+
+    // The capacity is reached with the eighth byte.
+    output << '8';
+    EXPECT_EQ(buffer.writes(), std::vector<std::string>{"12345678"});
+    EXPECT_TRUE(output.empty());
+
+    // A longer text is appended first, and written together with the buffered text.
+    output << "ab";
+    const std::string longText(100U, 'x');
+    output << longText;
+    ASSERT_EQ(buffer.writes().size(), 2U);
+    EXPECT_EQ(buffer.writes().back(), "ab" + longText);
+    EXPECT_TRUE(output.empty());
+
+    // Expect an explicit flush to write the remaining text.
+    output << "c";
+    output.flush();
+    EXPECT_EQ(buffer.writes().back(), "c");
+    EXPECT_EQ(buffer.writes().size(), 3U);
+}
+} // namespace
@@ -0,0 +1,170 @@
+/**
+ * @brief Unit test for the character scanning functions in namespace language::utils, comparing
+ *        the kernels of each supported instruction set with a scalar reference.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "utils/scan.h"
+
+namespace
+{
+using namespace language;
+
+/** The maximum size of the scanned texts, several blocks of each instruction set and a tail. */
+constexpr std::size_t kMaxSize{100U};
+
+/** The number of start alignments, all positions within a block of the widest instruction set. */
+constexpr std::size_t kAlignmentCount{32U};
+
+/** Whitespaces, like std::isspace in the "C" locale. */
+constexpr std::string_view kWhitespaces{" \t\n\v\f\r"};
+
+/** Bytes that aren't whitespaces, including the neighbours of the whitespace ranges. */
+constexpr std::string_view kNonWhitespaces{"\x08\x0E\x1F!a\x7F\x80\xA0\xFF"};
+
+/**
+ * @brief Buffer holding a text at a given alignment, surrounded by guard bytes.
+ */
+struct Buffer
+{
+    /** @brief Fill the whole buffer with a guard byte and get the text at the given alignment. */
+    char* text(const std::size_t alignment, const char guard) noexcept
+    {
+        std::memset(bytes, guard, sizeof(bytes));
+        return bytes + kAlignmentCount + alignment;
+    }
+
+    /** Guard bytes, the text and guard bytes, aligned like the widest block. */
+    alignas(32) char bytes[kAlignmentCount + kAlignmentCount + kMaxSize + kAlignmentCount];
+};
+
+// -----------------------------------------------------------------------------
+bool isWhitespace(const char c) noexcept
+{
+    return std::string_view::npos != kWhitespaces.find(c);
+}
+
+// -----------------------------------------------------------------------------
+void forEachLevel(const std::function<void(utils::SimdLevel)> &test)
+{
+    // Test each supported instruction set, and restore the one in use.
+    const auto level{utils::simdLevel()};
+    for (const auto tested : {utils::SimdLevel::Scalar, utils::SimdLevel::Sse2, utils::SimdLevel::Avx2})
+    {
+        if (tested == utils::setSimdLevel(tested)) { test(tested); }
+    }
+    utils::setSimdLevel(level);
+}
+
+/**
+ * @brief Verify that the first of up to four characters is found at every position, with every
+ *        size and start alignment, and that no byte outside the text is read as a match.
+ */
+TEST(ScanTest, FindFirstOfTest)
+{
+    forEachLevel([](const utils::SimdLevel level)
+    {
+        Buffer buffer{};
+        for (const std::string_view characters : {"\n", "\r\n", "\t\r\n", "\t;\r\n"})
+        {
+            for (std::size_t alignment{}; alignment < kAlignmentCount; ++alignment)
+            {
+                for (std::size_t size{}; size <= kMaxSize; ++size)
+                {
+                    // Match at each position, at the last byte and nowhere, followed by a match at the end.
+                    for (std::size_t position{}; position <= size; ++position)
+                    {
+                        auto *text{buffer.text(alignment, characters.front())};
+                        for (std::size_t i{}; i < size; ++i) { text[i] = kNonWhitespaces[i % kNonWhitespaces.size()]; }
+                        if (position < size)
+                        {
+                            text[position] = characters[position % characters.size()];
+                            text[size - 1U] = characters.back();
+                        }
+                        const auto expected{std::find_first_of(text, text + size, characters.begin(),
+                                                               characters.end())};
+                        ASSERT_EQ(utils::findFirstOf(text, text + size, characters), expected)
+                            << "Level " << static_cast<int>(level) << ", characters " << characters.size()
+                            << ", alignment " << alignment << ", size " << size << ", position " << position;
+                    }
+                }
+            }
+        }
+
+        // Expect no match without characters to search for.
+        auto *text{buffer.text(0U, '\n')};
+        EXPECT_EQ(utils::findFirstOf(text, text + kMaxSize, ""), text + kMaxSize);
+    });
+}
+
+/**
+ * @brief Verify that trailing whitespaces are trimmed after the last other byte at every position,
+ *        with every size and start alignment, and that no byte before the text is read.
+ */
+TEST(ScanTest, TrimTrailingWhitespacesTest)
+{
+    forEachLevel([](const utils::SimdLevel level)
+    {
+        Buffer buffer{};
+        for (std::size_t alignment{}; alignment < kAlignmentCount; ++alignment)
+        {
+            for (std::size_t size{}; size <= kMaxSize; ++size)
+            {
+                // The last byte that isn't a whitespace at each position, at the last byte and nowhere.
+                for (std::size_t position{}; position <= size; ++position)
+                {
+                    auto *text{buffer.text(alignment, 'x')};
+                    for (std::size_t i{}; i < size; ++i)
+                    {
+                        text[i] = ((i < position) && (0U == i % 3U)) ? kNonWhitespaces[i % kNonWhitespaces.size()]
+                                                                      : kWhitespaces[i % kWhitespaces.size()];
+                    }
+                    if (position < size) { text[position] = kNonWhitespaces[position % kNonWhitespaces.size()]; }
+
+                    auto expected{text + size};
+                    while ((text != expected) && isWhitespace(expected[-1])) { --expected; }
+                    ASSERT_EQ(utils::trimTrailingWhitespaces(text, text + size), expected)
+                        << "Level " << static_cast<int>(level) << ", alignment " << alignment << ", size " << size
+                        << ", position " << position;
+                }
+            }
+        }
+    });
+}
+
+/**
+ * @brief Verify that a byte other than a whitespace is found at every position, with every size
+ *        and start alignment, and that no byte after the text is read.
+ */
+TEST(ScanTest, IsBlankTest)
+{
+    forEachLevel([](const utils::SimdLevel level)
+    {
+        Buffer buffer{};
+        for (std::size_t alignment{}; alignment < kAlignmentCount; ++alignment)
+        {
+            for (std::size_t size{}; size <= kMaxSize; ++size)
+            {
+                // The first byte that isn't a whitespace at each position, at the last byte and nowhere.
+                for (std::size_t position{}; position <= size; ++position)
+                {
+                    auto *text{buffer.text(alignment, 'x')};
+                    for (std::size_t i{}; i < size; ++i) { text[i] = kWhitespaces[i % kWhitespaces.size()]; }
+                    if (position < size) { text[position] = kNonWhitespaces[position % kNonWhitespaces.size()]; }
+
+                    const auto expected{std::all_of(text, text + size, &isWhitespace)};
+                    ASSERT_EQ(utils::isBlank(text, text + size), expected)
+                        << "Level " << static_cast<int>(level) << ", alignment " << alignment << ", size " << size
+                        << ", position " << position;
+                }
+            }
+        }
+    });
+}
+} // namespace
@@ -0,0 +1,101 @@
+/**
+ * @brief Unit test for class language::utils::Scheduler.
+ */
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/scheduler.h"
+
+namespace
+{
+using namespace language;
+using namespace std::chrono_literals;
+
+/** Interval of the scheduled tasks. */
+constexpr std::chrono::milliseconds kInterval{100};
+
+/** Tolerated lateness of an execution, e.g. on a loaded machine. */
+constexpr std::chrono::milliseconds kTolerance{40};
+
+// -----------------------------------------------------------------------------
+std::vector<std::chrono::milliseconds> runTimes(const std::size_t executionCount, const std::size_t slowExecution,
+                                                const std::chrono::milliseconds slowDuration)
+{
+    // Run the task the given number of times, one execution taking longer, and return the start
+    // time of each execution relative to the first one.
+    std::vector<std::chrono::steady_clock::time_point> startTimes{};
+    utils::Scheduler scheduler{kInterval, [&]()
+    {
+        startTimes.push_back(std::chrono::steady_clock::now());
+        if (slowExecution + 1U == startTimes.size()) { std::this_thread::sleep_for(slowDuration); }
+        return executionCount > startTimes.size();
+    }};
+    scheduler.start();
+    scheduler.wait();
+    EXPECT_FALSE(scheduler.running());
+
+    std::vector<std::chrono::milliseconds> times{};
+    for (const auto time : startTimes)
+    {
+        times.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(time - startTimes.front()));
+    }
+    return times;
+}
+
+// -----------------------------------------------------------------------------
+void expectTime(const std::chrono::milliseconds time, const std::chrono::milliseconds expected)
+{
+    EXPECT_GE(time.count(), expected.count());
+    EXPECT_LT(time.count(), (expected + kTolerance).count());
+}
+
+/**
+ * @brief Verify that an execution taking longer than an interval, but not two, delays only the
+ *        next execution, the ones after it keep their absolute deadlines.
+ */
+TEST(SchedulerTest, DeadlineTest)
+{
+    const auto times{runTimes(5U, 1U, 150ms)};
+    ASSERT_EQ(times.size(), 5U);
+    expectTime(times[1U], 100ms);
+    expectTime(times[2U], 250ms);
+    expectTime(times[3U], 300ms);
+    expectTime(times[4U], 400ms);
+}
+
+/**
+ * @brief Verify that the schedule restarts from the end of an execution falling behind by more
+ *        than an interval, without running the missed executions in a burst.
+ */
+TEST(SchedulerTest, RestartTest)
+{
+    const auto times{runTimes(4U, 1U, 250ms)};
+    ASSERT_EQ(times.size(), 4U);
+    expectTime(times[1U], 100ms);
+    expectTime(times[2U], 350ms);
+    expectTime(times[3U], 450ms);
+}
+
+/**
+ * @brief Verify that stopping cancels the pending executions.
+ */
+TEST(SchedulerTest, StopTest)
+{
+    std::size_t executionCount{};
+    utils::Scheduler scheduler{1h, [&executionCount]() { return 0U != ++executionCount; }};
+    EXPECT_FALSE(scheduler.running());
+    scheduler.start();
+    std::this_thread::sleep_for(10ms);
+    EXPECT_TRUE(scheduler.running());
+
+    const auto start{std::chrono::steady_clock::now()};
+    scheduler.stop();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+    EXPECT_FALSE(scheduler.running());
+    EXPECT_EQ(executionCount, 1U);
+}
+} // namespace
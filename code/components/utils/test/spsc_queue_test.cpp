@@ -0,0 +1,90 @@
+/**
+ * @brief Unit test for class language::utils::SpscQueue.
+ */
+#include <cstddef>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "utils/spsc_queue.h"
+
+namespace 
+{
+using namespace language;
+
+/**
+ * @brief Verify that the queue rejects values when full and yields nothing when empty.
+ */
+TEST(SpscQueueTest, FullEmptyTest) 
+{
+    utils::SpscQueue<std::string, 4U> queue{};
+    std::string value{"unchanged"};
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(value));
+    EXPECT_EQ(value, "unchanged");
+
+    for (std::size_t i{}; i < 4U; ++i) { EXPECT_TRUE(queue.push(std::to_string(i))); }
+    EXPECT_FALSE(queue.push("4"));
+    EXPECT_FALSE(queue.empty());
+
+    // Expect the values in order, and a free slot after each pop.
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, "0");
+    EXPECT_TRUE(queue.push("4"));
+    for (std::size_t i{1U}; i <= 4U; ++i)
+    {
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, std::to_string(i));
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @brief Verify that the slots are reused in order when the positions wrap around the capacity.
+ */
+TEST(SpscQueueTest, WraparoundTest) 
+{
+    utils::SpscQueue<std::size_t, 4U> queue{};
+    std::size_t value{};
+    for (std::size_t i{}; i < 50U; ++i)
+    {
+        ASSERT_TRUE(queue.push(2U * i));
+        ASSERT_TRUE(queue.push(2U * i + 1U));
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, 2U * i);
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, 2U * i + 1U);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @brief Verify that all values pass from a producer to a consumer thread in order.
+ */
+TEST(SpscQueueTest, ThreadTest) 
+{
+    constexpr std::size_t kValueCount{100000U};
+    utils::SpscQueue<std::size_t, 8U> queue{};
+    std::thread producer{[&queue]()
+    {
+        for (std::size_t i{}; i < kValueCount; ++i) { while (!queue.push(i)) { std::this_thread::yield(); } }
+    }};
+
+    std::size_t expected{};
+    std::size_t value{};
+    while (expected < kValueCount)
+    {
+        if (!queue.pop(value)) 
+        { 
+            std::this_thread::yield();
+            continue;
+        }
+        if (value != expected) { break; }
+        ++expected;
+    }
+    producer.join();
+    EXPECT_EQ(expected, kValueCount);
+    EXPECT_TRUE(queue.empty());
+}
+} // namespace
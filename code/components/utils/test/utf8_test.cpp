@@ -0,0 +1,172 @@
+/**
+ * @brief Unit test for the UTF-8 validation in namespace language::utils, comparing each
+ *        supported instruction set with a scalar decoder.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/scan.h"
+#include "utils/utf8.h"
+
+namespace
+{
+using namespace language;
+
+/** Valid and invalid sequences, and valid sequences missing their last bytes. */
+const std::vector<std::string> kSequences{
+    "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xE4\xB8\xAD", "\xED\x9F\xBF", "\xEE\x80\x80", "\xEF\xBF\xBF",
+    "\xF0\x90\x80\x80", "\xF3\xBF\xBF\xBF", "\xF4\x8F\xBF\xBF",
+    "\x80", "\xBF", "\xC0\x80", "\xC1\xBF", "\xE0\x80\x80", "\xE0\x9F\xBF", "\xED\xA0\x80", "\xED\xBF\xBF",
+    "\xF0\x80\x80\x80", "\xF0\x8F\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xF8\x88\x80\x80\x80",
+    "\xFE", "\xFF", "\xC2" "a", "\xE4\xE4\xB8\xAD", "\xC2\x80\x80", "\xF0\x90\x80\xC2\x80",
+    "\xC2", "\xE4\xB8", "\xF0\x90", "\xF0\x90\x80"};
+
+/** Valid texts the sequences are placed in, ASCII and sequences of two, three and four bytes. */
+const std::vector<std::string> kBackgrounds{"a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80"};
+
+/** The maximum size of the texts, several blocks of each instruction set. */
+constexpr std::size_t kMaxSize{70U};
+
+// -----------------------------------------------------------------------------
+std::size_t sequenceSize(const std::string &text, const std::size_t i)
+{
+    // Decode the sequence starting at i following the well-formed byte sequences of the Unicode
+    // standard (table 3-7), return 0 if it's invalid.
+    const auto byte = [&text](const std::size_t j) -> unsigned
+    {
+        return (j < text.size()) ? static_cast<unsigned char>(text[j]) : 0x100U;
+    };
+    const auto lead{byte(i)};
+    unsigned low{0x80U}, high{0xBFU};
+    std::size_t size{};
+    if (0x80U > lead) { return 1U; }
+    if ((0xC2U <= lead) && (0xDFU >= lead)) { size = 2U; }
+    else if ((0xE0U <= lead) && (0xEFU >= lead)) { size = 3U; }
+    else if ((0xF0U <= lead) && (0xF4U >= lead)) { size = 4U; }
+    else { return 0U; }
+    if (0xE0U == lead) { low = 0xA0U; }
+    if (0xEDU == lead) { high = 0x9FU; }
+    if (0xF0U == lead) { low = 0x90U; }
+    if (0xF4U == lead) { high = 0x8FU; }
+
+    for (std::size_t j{1U}; j < size; ++j)
+    {
+        const auto c{byte(i + j)};
+        if ((low > c) || (high < c)) { return 0U; }
+        low  = 0x80U;
+        high = 0xBFU;
+    }
+    return size;
+}
+
+// -----------------------------------------------------------------------------
+std::size_t findInvalid(const std::string &text)
+{
+    for (std::size_t i{}; i < text.size(); )
+    {
+        const auto size{sequenceSize(text, i)};
+        if (0U == size) { return i; }
+        i += size;
+    }
+    return text.size();
+}
+
+// -----------------------------------------------------------------------------
+std::vector<utils::SimdLevel> supportedLevels()
+{
+    std::vector<utils::SimdLevel> levels{};
+    const auto level{utils::simdLevel()};
+    for (const auto supported : {utils::SimdLevel::Scalar, utils::SimdLevel::Sse2, utils::SimdLevel::Avx2})
+    {
+        if (supported == utils::setSimdLevel(supported)) { levels.push_back(supported); }
+    }
+    utils::setSimdLevel(level);
+    return levels;
+}
+
+// -----------------------------------------------------------------------------
+void expectValidation(const std::string &text, const utils::SimdLevel level)
+{
+    const auto first{text.data()}, last{text.data() + text.size()};
+    const auto invalid{findInvalid(text)};
+    ASSERT_EQ(utils::findInvalidUtf8(first, last) - first, static_cast<std::ptrdiff_t>(invalid))
+        << "Level " << static_cast<int>(level) << ", size " << text.size();
+    ASSERT_EQ(utils::isValidUtf8(first, last), text.size() == invalid)
+        << "Level " << static_cast<int>(level) << ", size " << text.size();
+}
+
+/**
+ * @brief Verify the scalar decoder of the test itself.
+ */
+TEST(Utf8Test, DecoderTest)
+{
+    EXPECT_EQ(findInvalid("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"), 10U);
+    EXPECT_EQ(findInvalid("ab\xED\xA0\x80"), 2U);
+    EXPECT_EQ(findInvalid("abc\xF0\x90\x80"), 3U);
+    EXPECT_EQ(findInvalid("\x80"), 0U);
+}
+
+/**
+ * @brief Verify that each sequence is validated like the scalar decoder does at every offset,
+ *        across and at the end of the blocks of 16 and 32 bytes, cut off at the end of the text.
+ */
+TEST(Utf8Test, SequenceTest)
+{
+    const auto level{utils::simdLevel()};
+    for (const auto tested : supportedLevels())
+    {
+        utils::setSimdLevel(tested);
+        for (const auto &background : kBackgrounds)
+        {
+            for (std::size_t size{}; size <= kMaxSize; ++size)
+            {
+                std::string text{};
+                while (text.size() < size) { text += background; }
+                text.resize(size);
+                expectValidation(text, tested);
+
+                for (const auto &sequence : kSequences)
+                {
+                    for (std::size_t offset{}; offset < size; ++offset)
+                    {
+                        auto placed{text};
+                        placed.replace(offset, std::min(sequence.size(), size - offset), sequence, 0U,
+                                       std::min(sequence.size(), size - offset));
+                        expectValidation(placed, tested);
+                    }
+                }
+            }
+        }
+    }
+    utils::setSimdLevel(level);
+}
+
+/**
+ * @brief Verify that random texts, mostly of lead and continuation bytes, are validated like the
+ *        scalar decoder does.
+ */
+TEST(Utf8Test, RandomTest)
+{
+    const unsigned char bytes[]{'a', 0x7F, 0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF, 0xC0, 0xC2, 0xDF,
+                                0xE0, 0xE4, 0xED, 0xEF, 0xF0, 0xF3, 0xF4, 0xF5, 0xFF};
+    const auto level{utils::simdLevel()};
+    for (const auto tested : supportedLevels())
+    {
+        utils::setSimdLevel(tested);
+        std::mt19937 random{42U};
+        std::uniform_int_distribution<std::size_t> sizes{0U, 100U}, indexes{0U, sizeof(bytes) - 1U};
+        for (std::size_t i{}; i < 20000U; ++i)
+        {
+            std::string text(sizes(random), 'a');
+            for (auto &c : text) { c = static_cast<char>(bytes[indexes(random)]); }
+            expectValidation(text, tested);
+        }
+    }
+    utils::setSimdLevel(level);
+}
+} // namespace
@@ -0,0 +1,105 @@
+/**
+ * @brief Unit test for the word-level alignment in namespace language::utils.
+ */
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/word_alignment.h"
+
+namespace 
+{
+using namespace language;
+using Type = utils::WordDifference::Type;
+
+/**
+ * @brief Verify that the shortest edits are found around the common prefix and suffix.
+ */
+TEST(WordAlignmentTest, DiffTest) 
+{
+    EXPECT_TRUE(utils::diffTokens({1U, 2U, 3U}, {1U, 2U, 3U}).empty());
+
+    // Expect a deleted and an inserted token in the middle, and only insertions into an empty sequence.
+    const auto edits{utils::diffTokens({1U, 2U, 3U, 4U}, {1U, 3U, 5U, 4U})};
+    ASSERT_EQ(edits.size(), 2U);
+    EXPECT_EQ(edits[0U].type, utils::TokenEdit::Type::Delete);
+    EXPECT_EQ(edits[0U].sourcePosition, 1U);
+    EXPECT_EQ(edits[1U].type, utils::TokenEdit::Type::Insert);
+    EXPECT_EQ(edits[1U].destinationPosition, 2U);
+
+    const auto inserts{utils::diffTokens({}, {7U, 8U})};
+    ASSERT_EQ(inserts.size(), 2U);
+    EXPECT_EQ(inserts[1U].type, utils::TokenEdit::Type::Insert);
+    EXPECT_EQ(inserts[1U].destinationPosition, 1U);
+}
+
+/**
+ * @brief Verify that missing, extra and swapped words are classified.
+ */
+TEST(WordAlignmentTest, ClassifyTest) 
+{
+    EXPECT_TRUE(utils::alignWords("I like green tea", "I  like green tea ").empty());
+
+    const auto missing{utils::alignWords("I green tea", "I like green tea")};
+    ASSERT_EQ(missing.size(), 1U);
+    EXPECT_EQ(missing[0U].type, Type::Missing);
+    EXPECT_EQ(missing[0U].answerWord, "like");
+    EXPECT_EQ(missing[0U].answerPosition, 1U);
+
+    const auto extra{utils::alignWords("I really like green tea", "I like green tea")};
+    ASSERT_EQ(extra.size(), 1U);
+    EXPECT_EQ(extra[0U].type, Type::Extra);
+    EXPECT_EQ(extra[0U].guessWord, "really");
+    EXPECT_EQ(extra[0U].guessPosition, 1U);
+
+    const auto swapped{utils::alignWords("I green like tea", "I like green tea")};
+    ASSERT_EQ(swapped.size(), 1U);
+    EXPECT_EQ(swapped[0U].type, Type::Swapped);
+    EXPECT_EQ(swapped[0U].answerWord, swapped[0U].guessWord);
+}
+
+/**
+ * @brief Verify that only similar words are reported as misspelled.
+ */
+TEST(WordAlignmentTest, MisspelledTest) 
+{
+    const auto misspelled{utils::alignWords("I lkie green tae", "I like green tea")};
+    ASSERT_EQ(misspelled.size(), 2U);
+    EXPECT_EQ(misspelled[0U].type, Type::Misspelled);
+    EXPECT_EQ(misspelled[0U].answerWord, "like");
+    EXPECT_EQ(misspelled[0U].guessWord, "lkie");
+    EXPECT_EQ(misspelled[1U].type, Type::Misspelled);
+
+    // Expect short words without a common character to be missing and extra, not misspelled.
+    const auto disjoint{utils::alignWords("x y z", "a b c")};
+    ASSERT_EQ(disjoint.size(), 6U);
+    std::size_t missingCount{}, extraCount{};
+    for (const auto &difference : disjoint)
+    {
+        EXPECT_NE(difference.type, Type::Misspelled);
+        missingCount += (Type::Missing == difference.type) ? 1U : 0U;
+        extraCount   += (Type::Extra == difference.type) ? 1U : 0U;
+    }
+    EXPECT_EQ(missingCount, 3U);
+    EXPECT_EQ(extraCount, 3U);
+
+    const auto unrelated{utils::alignWords("I like green coffee", "I like green tea")};
+    ASSERT_EQ(unrelated.size(), 2U);
+    EXPECT_NE(unrelated[0U].type, Type::Misspelled);
+}
+} // namespace
+
+/**
+ * @brief Run tests.
+ * 
+ * @param[in] argc The number of input arguments entered from the terminal at runtime.
+ * @param[in] argv Vector storing all input arguments entered from the terminal at runtime.
+ * 
+ * @return Success code 0 if all tests succeeded, otherwise a non-zero value.
+ */
+int main(int argc, char **argv) 
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
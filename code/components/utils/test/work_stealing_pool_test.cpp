@@ -0,0 +1,70 @@
+/**
+ * @brief Unit test for class language::utils::WorkStealingPool.
+ */
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/work_stealing_pool.h"
+
+namespace
+{
+using namespace language;
+
+/** The number of tasks submitted from outside the pool. */
+constexpr std::size_t kTaskCount{1000U};
+
+/**
+ * @brief Verify that each submitted task runs exactly once on a valid thread, for any number
+ *        of threads, including tasks submitted from tasks and tasks submitted after a wait.
+ */
+TEST(WorkStealingPoolTest, CompletenessTest)
+{
+    for (const std::size_t threadCount : {1U, 2U, 4U, 8U})
+    {
+        utils::WorkStealingPool pool{threadCount};
+        ASSERT_EQ(pool.threadCount(), threadCount);
+
+        // Each task runs a nested task, counted in the second half of the run counts.
+        std::vector<std::atomic<std::size_t>> runCounts(2U * kTaskCount);
+        std::atomic<bool> validThreads{true};
+        for (std::size_t i{}; i < kTaskCount; ++i)
+        {
+            pool.submit([&, i](const std::size_t thread)
+            {
+                if (thread >= threadCount) { validThreads = false; }
+                ++runCounts[i];
+                pool.submit([&, i](const std::size_t nestedThread)
+                {
+                    if (nestedThread >= threadCount) { validThreads = false; }
+                    ++runCounts[kTaskCount + i];
+                });
+            });
+        }
+        pool.wait();
+        EXPECT_TRUE(validThreads);
+        for (std::size_t i{}; i < runCounts.size(); ++i) { EXPECT_EQ(runCounts[i], 1U) << "Task " << i; }
+
+        // Expect the pool to be reusable after a wait.
+        std::atomic<std::size_t> runCount{};
+        for (std::size_t i{}; i < kTaskCount; ++i) { pool.submit([&](std::size_t) { ++runCount; }); }
+        pool.wait();
+        EXPECT_EQ(runCount, kTaskCount);
+    }
+}
+
+/**
+ * @brief Verify that the destructor waits for all submitted tasks.
+ */
+TEST(WorkStealingPoolTest, DestructorTest)
+{
+    std::atomic<std::size_t> runCount{};
+    {
+        utils::WorkStealingPool pool{4U};
+        for (std::size_t i{}; i < kTaskCount; ++i) { pool.submit([&](std::size_t) { ++runCount; }); }
+    }
+    EXPECT_EQ(runCount, kTaskCount);
+}
+} // namespace
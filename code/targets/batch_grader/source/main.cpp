@@ -0,0 +1,79 @@
+/**
+ * @brief Grade exported answer sheets offline with the rules of the game.
+ *
+ *        Enter the phrase file path after the run command, followed by the answer files.
+ *        Each row of an answer file holds a phrase ID, i.e. the position of the phrase in the
+ *        phrase file counted from 1, and the guess, separated by a tab. For example, to grade
+ *        the answers in 'monday.tsv' and 'tuesday.tsv' to the phrases in 'file.txt':
+ *
+ *        ./BatchGrader file.txt monday.tsv tuesday.tsv --output=statistics.tsv
+ *
+ *        The statistics per phrase are written to the output file, or printed if no output
+ *        file is given. Use the '--reverse' option to grade translations from the target to
+ *        the primary language, the '--header' option to skip the first row of each answer file,
+ *        and the '--threads' option to limit the number of grading threads.
+ */
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "dictionary/adapter.h"
+#include "dictionary/dictionary.h"
+#include "game/batch_grader.h"
+#include "utils/arguments.h"
+
+using namespace language;
+
+/**
+ * @brief Grade the answer files and write the statistics per phrase.
+ *
+ * @param argc  Number of input arguments from the terminal.
+ * @param argv  Vector of input arguments from the terminal.
+ * @return      Return 0 if all answer files were graded, else return 1.
+ */
+int main(const int argc, const char** argv) 
+{
+    const utils::Arguments args{argc, argv};
+    const auto &positional{args.positional()};
+
+    if (3U > args.positionalCount())
+    {
+        std::cerr << "Usage: " << positional[0U] << " <phrase file> <answer file> [answer files...] "
+                  << "[--reverse] [--header] [--threads=<count>] [--output=<file>]\n";
+        return 1;
+    }
+    dictionary::Adapter adapter{positional[1U]};
+    dictionary::Dictionary dictionary{adapter};
+    if (dictionary.empty()) { return 1; }
+
+    const auto start{std::chrono::steady_clock::now()};
+    game::BatchGrader grader{dictionary, args.hasOption("reverse"), args.numericOption("threads", 0U)};
+    bool graded{true};
+
+    for (auto path{positional.begin() + 2U}; path != positional.end(); ++path)
+    {
+        if (!grader.grade(*path, args.hasOption("header")))
+        {
+            std::cerr << "File \"" << *path << "\" wasn't found!\n";
+            graded = false;
+        }
+    }
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+
+    if (const auto outputPath{args.option("output")}; !outputPath.empty())
+    {
+        std::ofstream ostream{outputPath};
+        grader.write(ostream);
+        if (!ostream) 
+        { 
+            std::cerr << "Failed to write statistics to \"" << outputPath << "\"!\n";
+            return 1;
+        }
+    }
+    else { grader.write(std::cout); }
+
+    std::cerr << grader.answerCount() << " answer(s) graded in " << elapsed.count() << " s, " 
+              << grader.invalidRowCount() << " row(s) with an invalid phrase ID skipped.\n";
+    return graded ? 0 : 1;
+}
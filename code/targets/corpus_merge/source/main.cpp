@@ -0,0 +1,55 @@
+/**
+ * @brief Merge phrase files into one file without duplicates, for corpora larger than memory.
+ *
+ *        Enter the output file path after the run command, followed by the files to merge.
+ *        Each phrase pair is kept once, in order of its first occurrence in the input files.
+ *        For example, to merge 'alice.txt' and 'bob.csv' into 'master.txt' with at most
+ *        512 MB of memory, use the following command:
+ *
+ *        ./CorpusMerge master.txt alice.txt bob.csv --memory=512
+ *
+ *        Pairs are sorted in runs on disk, use the '--temp' option to select the directory
+ *        for the runs, and the '--threads' option to limit the number of sorting threads.
+ *        Use the '--header' option to skip the first record of tabular files.
+ *        Use the '--trace=<file>' option to write a timeline of the sorting threads at exit.
+ */
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "dictionary/corpus_merge.h"
+#include "utils/arguments.h"
+#include "utils/trace.h"
+
+using namespace language;
+
+/**
+ * @brief Merge the input files into the output file.
+ *
+ * @param argc  Number of input arguments from the terminal.
+ * @param argv  Vector of input arguments from the terminal.
+ * @return      Return 0 if the files were merged, else return 1.
+ */
+int main(const int argc, const char** argv) 
+{
+    const utils::Arguments args{argc, argv};
+    const auto &positional{args.positional()};
+    if (args.hasOption("trace")) { utils::trace::writeAtExit(args.option("trace")); }
+
+    if (3U > args.positionalCount())
+    {
+        std::cerr << "Usage: " << positional[0U] << " <output file> <input file> [input files...] "
+                  << "[--memory=<MB>] [--threads=<count>] [--temp=<directory>] [--header] [--trace=<file>]\n";
+        return 1;
+    }
+    const auto memoryBudget{args.numericOption("memory", dictionary::CorpusMerge::kDefaultMemoryBudget >> 20U) << 20U};
+    dictionary::CorpusMerge merge{memoryBudget, args.numericOption("threads", 0U), args.option("temp", "")};
+
+    const std::vector<std::string> inputPaths{positional.begin() + 2U, positional.end()};
+    if (!merge.merge(inputPaths, positional[1U], args.hasOption("header"))) { return 1; }
+
+    std::cout << merge.phraseCount() << " phrase pair(s) read, " << merge.uniquePhraseCount() 
+              << " unique pair(s) written to \"" << positional[1U] << "\" using " << merge.runCount() 
+              << " run(s).\n";
+    return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * @brief Generate a header embedding the phrases of a phrase file into an executable.
+ *
+ *        Enter the phrase file path after the run command, followed by the header path.
+ *        For example, to embed the phrases in 'kiosk.txt' as header 'embedded_corpus.h':
+ *
+ *        ./EmbedCorpus kiosk.txt embedded_corpus.h
+ *
+ *        The phrase file is read like in the game, annotation lines starting with '#' and
+ *        duplicate pairs are removed and invalid UTF-8 is repaired. The tool is run by the
+ *        build when 'LanguageGame' is configured with option LANGUAGE_EMBEDDED_CORPUS.
+ */
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "dictionary/embedded_adapter.h"
+#include "utils/utf8.h"
+#include "utils/utils.h"
+
+using namespace language;
+
+/**
+ * @brief Load and prepare the phrases of a phrase file, then write them as a header.
+ *
+ * @param argc  Number of input arguments from the terminal.
+ * @param argv  Vector of input arguments from the terminal.
+ * @return      Return 0 if the header was written, else return 1.
+ */
+int main(const int argc, const char** argv) 
+{
+    if (3 != argc)
+    {
+        std::cerr << "Usage: " << argv[0] << " <phrase file> <header file>\n";
+        return 1;
+    }
+    std::vector<std::string> lines{};
+    std::vector<std::size_t> invalidLines{};
+    if (!utils::retrieveFromFile(argv[1], lines, utils::Utf8Policy::Repair, invalidLines))
+    {
+        std::cerr << "File \"" << argv[1] << "\" wasn't found!\n";
+        return 1;
+    }
+    for (const auto line : invalidLines)
+    {
+        std::cerr << "Invalid UTF-8 repaired on line " << line << " of \"" << argv[1] << "\".\n";
+    }
+    const auto phrases{dictionary::embeddablePhrases(lines)};
+    if (phrases.empty())
+    {
+        std::cerr << "File \"" << argv[1] << "\" contains no phrases to embed!\n";
+        return 1;
+    }
+    std::ofstream ostream{argv[2], std::ios::binary};
+    dictionary::writeEmbeddedPhrases(ostream, phrases, std::filesystem::path{argv[1]}.filename().string());
+    ostream.close();
+
+    if (!ostream)
+    {
+        std::cerr << "Failed to write \"" << argv[2] << "\"!\n";
+        return 1;
+    }
+    std::cout << phrases.size() << " phrase pair(s) embedded from \"" << argv[1] << "\".\n";
+    return 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * @brief Find the phrases missed most often in the error files written by the game.
+ *
+ *        Enter the directory holding the error files after the run command, followed by the
+ *        path of the phrase file to write. For example, to write the 50 phrases missed most
+ *        often in the files 'errors<N>.txt' in directory 'dir' to 'hardest.txt':
+ *
+ *        ./ErrorAnalytics dir hardest.txt --top=50
+ *
+ *        The files are scanned in parallel, use the '--threads' option to limit the number
+ *        of threads.
+ */
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "dictionary/error_statistics.h"
+#include "utils/arguments.h"
+#include "utils/phrase.h"
+#include "utils/utils.h"
+
+using namespace language;
+
+/** Default number of phrases to write. */
+constexpr std::size_t kDefaultPhraseCount{100U};
+
+/**
+ * @brief Scan the error files and write the phrases missed most often.
+ *
+ * @param argc  Number of input arguments from the terminal.
+ * @param argv  Vector of input arguments from the terminal.
+ * @return      Return 0 if the phrases were written, else return 1.
+ */
+int main(const int argc, const char** argv) 
+{
+    const utils::Arguments args{argc, argv};
+    const auto &positional{args.positional()};
+
+    if (3U != args.positionalCount())
+    {
+        std::cerr << "Usage: " << positional[0U] << " <error file directory> <output file> "
+                  << "[--top=<count>] [--threads=<count>]\n";
+        return 1;
+    }
+    const auto start{std::chrono::steady_clock::now()};
+    dictionary::ErrorStatistics statistics{args.numericOption("threads", 0U)};
+    if (!statistics.scan(positional[1U]))
+    {
+        std::cerr << "Directory \"" << positional[1U] << "\" wasn't found!\n";
+        return 1;
+    }
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+
+    // Write the hardest phrases as a phrase file, ready to be played.
+    std::vector<Phrase> phrases{};
+    for (auto &missedPhrase : statistics.hardest(args.numericOption("top", kDefaultPhraseCount)))
+    {
+        phrases.push_back(std::move(missedPhrase.phrase));
+    }
+    if (phrases.empty() || !utils::writePhrasesToFile(positional[2U], phrases))
+    {
+        std::cerr << "No phrases written to \"" << positional[2U] << "\"!\n";
+        return 1;
+    }
+    std::cout << statistics.fileCount() << " error file(s) with " << statistics.missCount() 
+              << " missed phrase(s) scanned in " << elapsed.count() << " s, the " << phrases.size() 
+              << " phrase(s) missed most often out of " << statistics.phraseCount() 
+              << " written to \"" << positional[2U] << "\".\n";
+    return 0;
+}
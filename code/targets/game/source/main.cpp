@@ -14,12 +14,75 @@
  *        aforementioned file, use the following command:
  * 
  *        ./LanguageGame dir/file.txt 10
+ *
+ *        Optionally set the status mode printed between prompts to full (default), compact
+ *        or quiet. For example, to print the status on a single line, use the following command:
+ *
+ *        ./LanguageGame dir/file.txt --status=compact
+ *
+ *        Optionally play in multiple-choice mode with a given number of answer options:
+ *
+ *        ./LanguageGame dir/file.txt --choices=4
+ *
+ *        To limit the time per prompt and per round in seconds, use the following command:
+ *
+ *        ./LanguageGame dir/file.txt --timed=5 --round-time=60
+ *
+ *        Optionally save the session to 'session.checkpoint' after each answer, and resume it
+ *        after the game has been closed by adding the resume option to the same command:
+ *
+ *        ./LanguageGame dir/file.txt 10 --checkpoint
+ *        ./LanguageGame dir/file.txt 10 --resume
+ *
+ *        Optionally record the session to 'session.log', to replay it with 'SessionReplay':
+ *
+ *        ./LanguageGame dir/file.txt 10 --record=session.log
+ *
+ *        Optionally partition the phrases by hash across worker processes, each storing and
+ *        indexing only its shard, for corpora too large to load in a single process:
+ *
+ *        ./LanguageGame dir/file.txt 10 --shards=4
+ *
+ *        Optionally write timers and counters to 'metrics.json' and 'metrics.prom' at exit,
+ *        or whenever the process receives SIGUSR1:
+ *
+ *        ./LanguageGame dir/file.txt --metrics=metrics
+ *
+ *        Optionally write a timeline of loading, rounds and prompts to 'trace.json' at exit,
+ *        which can be opened with chrome://tracing or https://ui.perfetto.dev:
+ *
+ *        ./LanguageGame dir/file.txt --trace=trace.json
+ *
+ *        If the game was built with a phrase file embedded (CMake option LANGUAGE_EMBEDDED_CORPUS),
+ *        the file path is omitted and the embedded phrases are played instead:
+ *
+ *        ./LanguageGame 10 --status=compact
  */
+#ifdef LANGUAGE_EMBEDDED_CORPUS
+#include "embedded_corpus.h"
+#include "dictionary/embedded_adapter.h"
+#else
 #include "dictionary/adapter.h"
+#include "dictionary/sharded_adapter.h"
+#endif
 #include "game/game.h"
+#include "game/options.h"
+#include "utils/arguments.h"
+#include "utils/metrics.h"
+#include "utils/trace.h"
 
 using namespace language;
 
+namespace
+{
+// ---------------------------------------------------------------------------
+int play(dictionary::AdapterInterface &adapter, const int argc, const char **argv)
+{
+    game::Game game{adapter, game::parseOptions(argc, argv)};
+    return game.play() ? 0 : 1;
+}
+} // namespace
+
 /**
  * @brief Load phrases from file and translate from primary to target language.
  *        After finishing, choose to translate from target to primary language before exit.
@@ -31,7 +94,20 @@ using namespace language;
  */
 int main(const int argc, const char** argv) 
 {
+    // Start the metrics export before any other thread is created.
+    const utils::Arguments args{argc, argv};
+    if (args.hasOption("metrics")) { utils::metrics::dumpAtExit(args.option("metrics")); }
+    if (args.hasOption("trace")) { utils::trace::writeAtExit(args.option("trace")); }
+
+#ifdef LANGUAGE_EMBEDDED_CORPUS
+    dictionary::EmbeddedAdapter adapter{embedded::kPhrases, argc, argv};
+#else
+    if (args.hasOption("shards"))
+    {
+        dictionary::ShardedAdapter shardedAdapter{argc, argv};
+        return play(shardedAdapter, argc, argv);
+    }
     dictionary::Adapter adapter{argc, argv};
-    game::Game game{adapter};
-    return game.play() ? 0 : 1;
+#endif
+    return play(adapter, argc, argv);
 }
@@ -1,43 +1,125 @@
-/**
- * @brief Print phrases loaded from a file. Set the number of phrases and print interval as needed.
- * 
- *        Store the phrases to print in a text file, one pair per line. 
- *        Please use a blank line between each pair.
- *        
- *        Enter the file path after the run command. For example, to print phrases from 'file.txt'
- *        in directory 'dir' when running 'PhrasePrinter', use the following command:
- *
- *        ./PhrasePrinter dir/file.txt
- * 
- *        Print all loaded phrases by default. Optionally limit the number of phrases to print
- *        after the file path. For example, to translate only ten phrases from the aforementioned 
- *        file, use the following command:
- * 
- *        ./PhrasePrinter dir/file.txt 10
- *
- *        Optionally set the print interval in ms after the number of phrases. For example, 
- *        to print ten phrases with a 500 ms interval, use the following command:
- * 
- *        ./PhasePrinter dir/file.txt 10 500
- */
-#include "dictionary/adapter.h"
-#include "dictionary/dictionary.h"
-
-using namespace language;
-
-/**
- * @brief Load phrases from file and print the selected number with the chosen print interval.
- *        Print all phrases with a 2000 ms interval by default.
- *
- * @param argc  Number of input arguments from the terminal.
- * @param argv  Vector of input arguments from the terminal.
- * @return      Return 0 if the program ran successfully, else return 1.
- */
-int main(const int argc, const char** argv) 
-{
-    dictionary::Adapter adapter{argc, argv};
-    dictionary::Dictionary dictionary{adapter};
-    if (dictionary.empty()) { return 1; }
-    dictionary.print();
-    return 0;
-}
+/**
+ * @brief Print phrases loaded from a file. Set the number of phrases and print interval as needed.
+ * 
+ *        Store the phrases to print in a text file, one pair per line. 
+ *        Please use a blank line between each pair.
+ *        
+ *        Enter the file path after the run command. For example, to print phrases from 'file.txt'
+ *        in directory 'dir' when running 'PhrasePrinter', use the following command:
+ *
+ *        ./PhrasePrinter dir/file.txt
+ * 
+ *        Print all loaded phrases by default. Optionally limit the number of phrases to print
+ *        after the file path. For example, to translate only ten phrases from the aforementioned 
+ *        file, use the following command:
+ * 
+ *        ./PhrasePrinter dir/file.txt 10
+ *
+ *        Optionally set the print interval in ms after the number of phrases. For example, 
+ *        to print ten phrases with a 500 ms interval, use the following command:
+ * 
+ *        ./PhasePrinter dir/file.txt 10 500
+ *
+ *        Optionally export the phrases without delay in large buffered blocks:
+ *
+ *        ./PhasePrinter dir/file.txt 10 --no-delay
+ *
+ *        Optionally stream the phrases directly from the file with constant memory usage,
+ *        and skip duplicates with an approximate dedupe using a 16 MB filter:
+ *
+ *        ./PhasePrinter dir/file.txt --stream --dedupe=16
+ *
+ *        Optionally only print phrases containing a given substring in either language.
+ *        The suffix array used for the search is saved next to the file as 'file.txt.sa':
+ *
+ *        ./PhasePrinter dir/file.txt --search=schaft
+ *
+ *        Optionally write timers and counters to 'metrics.json' and 'metrics.prom' at exit,
+ *        or whenever the process receives SIGUSR1:
+ *
+ *        ./PhasePrinter dir/file.txt --metrics=metrics
+ *
+ *        Optionally write a timeline of loading and the worker threads to 'trace.json' at exit,
+ *        which can be opened with chrome://tracing or https://ui.perfetto.dev:
+ *
+ *        ./PhasePrinter dir/file.txt --trace=trace.json
+ */
+#include "dictionary/adapter.h"
+#include "dictionary/dictionary.h"
+#include "dictionary/stream_printer.h"
+#include "search/index.h"
+#include "search/suffix_array.h"
+#include "utils/arguments.h"
+#include "utils/metrics.h"
+#include "utils/output.h"
+#include "utils/trace.h"
+
+using namespace language;
+
+namespace
+{
+/**
+ * @brief Print phrases containing a substring, using a suffix array saved next to the file.
+ *
+ * @param filePath    Path to the file the dictionary was loaded from.
+ * @param dictionary  The dictionary to search.
+ * @param substring   The substring to search for.
+ * @return            Return 0 if at least one phrase was found, else return 1.
+ */
+int printMatches(const std::string& filePath, const dictionary::Dictionary& dictionary, 
+                 const std::string& substring)
+{
+    // Load the saved suffix array if it matches the phrases, otherwise build and save a new one.
+    const auto suffixArrayPath{filePath + ".sa"};
+    search::SuffixArray suffixArray{};
+
+    if (!suffixArray.load(suffixArrayPath, search::Index::fingerprint(dictionary)))
+    {
+        suffixArray.build(dictionary);
+        suffixArray.save(suffixArrayPath);
+    }
+    const auto matches{suffixArray.find(substring)};
+    utils::Output output{};
+    std::size_t printedPhrases{};
+
+    for (const auto match : matches)
+    {
+        if (dictionary.phraseCountToUse() <= printedPhrases++) { break; }
+        const auto phrase{dictionary.phrase(match)};
+        output << phrase.primary << "\n" << phrase.target << "\n\n";
+    }
+    return matches.empty() ? 1 : 0;
+}
+} // namespace
+
+/**
+ * @brief Load phrases from file and print the selected number with the chosen print interval.
+ *        Print all phrases with a 2000 ms interval by default.
+ *
+ * @param argc  Number of input arguments from the terminal.
+ * @param argv  Vector of input arguments from the terminal.
+ * @return      Return 0 if the program ran successfully, else return 1.
+ */
+int main(const int argc, const char** argv) 
+{
+    // Print phrases while reading the file in streaming mode.
+    const utils::Arguments args{argc, argv};
+    if (args.hasOption("metrics")) { utils::metrics::dumpAtExit(args.option("metrics")); }
+    if (args.hasOption("trace")) { utils::trace::writeAtExit(args.option("trace")); }
+    if (args.hasOption("stream"))
+    {
+        dictionary::StreamPrinter printer{argc, argv};
+        return printer.print() ? 0 : 1;
+    }
+    dictionary::Adapter adapter{argc, argv};
+    dictionary::Dictionary dictionary{adapter};
+    if (dictionary.empty()) { return 1; }
+
+    // Only print phrases containing the substring in search mode.
+    if (args.hasOption("search")) 
+    { 
+        return printMatches(args.positional()[1U], dictionary, args.option("search")); 
+    }
+    dictionary.print();
+    return 0;
+}
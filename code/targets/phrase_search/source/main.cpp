@@ -0,0 +1,77 @@
+/**
+ * @brief Find phrases containing given words, in either language.
+ * 
+ *        Store the phrases to search in a text file, one pair per line. 
+ *        Please use a blank line between each pair.
+ *        
+ *        Enter the file path after the run command, followed by the words to search for.
+ *        For example, to find all phrases in 'file.txt' in directory 'dir' containing both
+ *        "der" and "frosch" when running 'PhraseSearch', use the following command:
+ *
+ *        ./PhraseSearch dir/file.txt der frosch
+ * 
+ *        The word index is saved next to the phrase file as 'file.txt.idx' and reused on the
+ *        next launch as long as the phrases are unchanged. Use the '--rebuild' option to
+ *        force the index to be rebuilt.
+ */
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "dictionary/adapter.h"
+#include "dictionary/dictionary.h"
+#include "search/index.h"
+#include "utils/arguments.h"
+#include "utils/output.h"
+
+using namespace language;
+
+/**
+ * @brief Load phrases and the word index, then print all phrases containing the given words.
+ *
+ * @param argc  Number of input arguments from the terminal.
+ * @param argv  Vector of input arguments from the terminal.
+ * @return      Return 0 if at least one phrase was found, else return 1.
+ */
+int main(const int argc, const char** argv) 
+{
+    const utils::Arguments args{argc, argv};
+    const auto &positional{args.positional()};
+
+    if (3U > args.positionalCount())
+    {
+        std::cerr << "Usage: " << positional[0U] << " <phrase file> <word> [words...] [--rebuild]\n";
+        return 1;
+    }
+    dictionary::Adapter adapter{positional[1U]};
+    dictionary::Dictionary dictionary{adapter};
+    if (dictionary.empty()) { return 1; }
+
+    // Load the saved index if it matches the phrases, otherwise build and save a new one.
+    const auto indexPath{positional[1U] + ".idx"};
+    search::Index index{};
+
+    if (args.hasOption("rebuild") || 
+        !index.load(indexPath, search::Index::fingerprint(dictionary)))
+    {
+        index.build(dictionary);
+        if (!index.save(indexPath)) 
+        { 
+            std::cerr << "Failed to save index to \"" << indexPath << "\"!\n\n"; 
+        }
+    }
+    const std::vector<std::string> terms{positional.begin() + 2U, positional.end()};
+    std::string query{};
+    for (const auto &term : terms) { query += term + " "; }
+    const auto matches{index.find(query)};
+
+    // Print the matching phrases in order of appearance.
+    utils::Output output{};
+    for (const auto match : matches)
+    {
+        const auto phrase{dictionary.phrase(match)};
+        output << phrase.primary << "\n" << phrase.target << "\n\n";
+    }
+    output << matches.size() << " matching phrase(s) found.\n";
+    return matches.empty() ? 1 : 0;
+}
@@ -0,0 +1,155 @@
+/**
+ * @brief Replay a session recorded by the game and report the time the game spends per event.
+ *
+ *        Record a session by playing with the '--record' option, then enter the phrase file and
+ *        the log after the run command. For example, to replay 'session.log' recorded with the
+ *        phrases of 'file.txt' in directory 'dir':
+ *
+ *        ./LanguageGame dir/file.txt 10 --record=session.log
+ *        ./SessionReplay dir/file.txt session.log
+ *
+ *        The input is fed to the game as fast as possible and its output is discarded, unless
+ *        written to a file with the '--output' option. Use the '--events' option to write the
+ *        time spent on each event as tab-separated values. Options for loading the phrases,
+ *        such as '--tokenize', '--columns' or '--shards', must match the recorded session.
+ */
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dictionary/adapter.h"
+#include "dictionary/sharded_adapter.h"
+#include "game/session_log.h"
+#include "game/session_replayer.h"
+#include "utils/arguments.h"
+#include "utils/latency_histogram.h"
+
+using namespace language;
+
+namespace
+{
+/** Options of the replayer, which aren't passed to the dictionary adapter. */
+const std::vector<std::string> kReplayOptions{"--events", "--output"};
+
+// ---------------------------------------------------------------------------
+bool isReplayOption(const std::string &arg)
+{
+    for (const auto &option : kReplayOptions)
+    {
+        if ((0U == arg.compare(0U, option.size(), option)) &&
+            ((arg.size() == option.size()) || ('=' == arg[option.size()])))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+const char *eventTypeName(const game::InputEventType type)
+{
+    if (game::InputEventType::Timeout == type) { return "timeout"; }
+    return (game::InputEventType::Closed == type) ? "closed" : "line";
+}
+
+// ---------------------------------------------------------------------------
+bool writeEvents(const std::string &filePath, const game::SessionLog &log,
+                 const std::vector<std::uint64_t> &engineTimes)
+{
+    std::ofstream ostream{filePath};
+    ostream << "event\ttype\tdelay_us\tengine_ns\n";
+    for (std::size_t i{}; i < engineTimes.size(); ++i)
+    {
+        ostream << i + 1U << '\t' << eventTypeName(log.events[i].type) << '\t' << log.events[i].delay
+                << '\t' << engineTimes[i] << '\n';
+    }
+    return static_cast<bool>(ostream);
+}
+} // namespace
+
+/**
+ * @brief Replay a recorded session and print the time spent by the game.
+ *
+ * @param argc  Number of input arguments from the terminal.
+ * @param argv  Vector of input arguments from the terminal.
+ * @return      Return 0 if the session was replayed like it was recorded, else return 1.
+ */
+int main(const int argc, const char** argv)
+{
+    const utils::Arguments args{argc, argv};
+    const auto &positional{args.positional()};
+
+    if (3U != args.positionalCount())
+    {
+        std::cerr << "Usage: " << positional[0U] << " <phrase file> <session log> "
+                  << "[--events=<file>] [--output=<file>] [phrase file options]\n";
+        return 1;
+    }
+    game::SessionLog log{};
+    if (!game::readSessionLog(positional[2U], log))
+    {
+        std::cerr << "\"" << positional[2U] << "\" is not a session log!\n";
+        return 1;
+    }
+
+    // Load the phrases like the game, with the recorded number of phrases to play.
+    const auto phraseCount{std::to_string(log.header.phraseCountToUse)};
+    std::vector<const char *> adapterArgs{argv[0], positional[1U].c_str(), phraseCount.c_str()};
+    for (int i{1}; i < argc; ++i)
+    {
+        const std::string arg{argv[i]};
+        if ((0U == arg.rfind("--", 0U)) && !isReplayOption(arg)) { adapterArgs.push_back(argv[i]); }
+    }
+    // Shard the phrases like the recorded session, sharded phrases are numbered shard by shard.
+    std::unique_ptr<dictionary::AdapterInterface> adapter{};
+    const auto adapterArgc{static_cast<int>(adapterArgs.size())};
+    if (args.hasOption("shards")) { adapter = std::make_unique<dictionary::ShardedAdapter>(adapterArgc, adapterArgs.data()); }
+    else { adapter = std::make_unique<dictionary::Adapter>(adapterArgc, adapterArgs.data()); }
+
+    // Discard the output unless asked for, the stream then fails all writes.
+    std::ofstream output{};
+    if (args.hasOption("output")) { output.open(args.option("output")); }
+    std::ostream ostream{args.hasOption("output") ? output.rdbuf() : nullptr};
+
+    game::SessionReplayer replayer{*adapter, log};
+    const auto start{std::chrono::steady_clock::now()};
+    const auto result{replayer.replay(ostream)};
+    const std::chrono::duration<double, std::milli> elapsed{std::chrono::steady_clock::now() - start};
+    if (game::ReplayResult::PhrasesChanged == result)
+    {
+        std::cerr << "The phrases differ from the phrases of the recorded session!\n";
+        return 1;
+    }
+
+    utils::LatencyHistogram engineTimes{};
+    std::uint64_t totalTime{};
+    for (const auto engineTime : replayer.engineTimes())
+    {
+        engineTimes.record(engineTime / 1000U);
+        totalTime += engineTime;
+    }
+    std::cout << "Replayed " << replayer.engineTimes().size() << " of " << log.events.size()
+              << " event(s) with seed " << log.header.seed << " in " << elapsed.count() << " ms.\n";
+    std::cout << "Setup time:\t\t" << utils::formatLatency(replayer.setupTime() / 1000U) << "\n";
+    std::cout << "Engine time per event:\tp50 " << utils::formatLatency(engineTimes.percentile(50.0))
+              << ", p90 " << utils::formatLatency(engineTimes.percentile(90.0))
+              << ", p99 " << utils::formatLatency(engineTimes.percentile(99.0))
+              << ", max " << utils::formatLatency(engineTimes.max())
+              << ", total " << utils::formatLatency(totalTime / 1000U) << "\n";
+
+    if (args.hasOption("events") && !writeEvents(args.option("events"), log, replayer.engineTimes()))
+    {
+        std::cerr << "Events couldn't be written to \"" << args.option("events") << "\"!\n";
+        return 1;
+    }
+    if (game::ReplayResult::Diverged == result)
+    {
+        std::cerr << "The game didn't consume exactly the recorded events, it took another path than recorded!\n";
+        return 1;
+    }
+    return 0;
+}